@@ -214,23 +214,22 @@ void *mostFrequentArrValueH(void *arr, int length, int elemSize, int (*cmp)(cons
 
     }
 
-    Entry **mapEntries = hashMapToEntryArray(countingMap);
     void *mostFreqValue = NULL;
     int mostFreq = -1;
-    int entriesLength = hashMapGetLength(countingMap);
 
-    for (int i = 0; i < entriesLength; i++) {
+    HashMapIterator iterator;
+    hashMapIteratorBegin(countingMap, &iterator);
 
-        if (mostFreq < *(int *)mapEntries[i]->item) {
-            mostFreqValue = mapEntries[i]->key;
-            mostFreq = *(int *)mapEntries[i]->item;
-        }
+    while (hashMapIteratorNext(&iterator)) {
 
-        hashMapDelete(countingMap, mapEntries[i]->key);
+        int currentFreq = *(int *) hashMapIteratorValue(&iterator);
+        if (mostFreq < currentFreq) {
+            mostFreqValue = hashMapIteratorKey(&iterator);
+            mostFreq = currentFreq;
+        }
 
     }
 
-    free(mapEntries);
     destroyHashMap(countingMap);
 
     return mostFreqValue;
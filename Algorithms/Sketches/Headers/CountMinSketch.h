@@ -0,0 +1,54 @@
+#ifndef C_DATASTRUCTURES_COUNTMINSKETCH_H
+#define C_DATASTRUCTURES_COUNTMINSKETCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct CountMinSketch
+*  @brief This structure implements a count-min sketch, that estimates the frequency of the stream items with a fixed memory.
+*  The estimate never goes below the real count, and it goes above it by at most epsilon * total with probability 1 - delta.
+*  @var CountMinSketch::counters
+*  Member 'counters' is a pointer to the counters matrix, that has depth rows and width columns.
+*  @var CountMinSketch::width
+*  Member 'width' holds the number of counters in one row.
+*  @var CountMinSketch::depth
+*  Member 'depth' holds the number of rows, and every row uses a different hash.
+*  @var CountMinSketch::total
+*  Member 'total' holds the sum of all the added counts.
+*  @var CountMinSketch::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the item.
+*/
+
+typedef struct CountMinSketch {
+    uint64_t *counters;
+    int width;
+    int depth;
+    uint64_t total;
+    int (*hashFun)(const void *);
+} CountMinSketch;
+
+
+CountMinSketch *countMinSketchInitialization(double epsilon, double delta, int (*hashFun)(const void *));
+
+void countMinSketchAdd(CountMinSketch *sketch, void *item, uint64_t count);
+
+uint64_t countMinSketchEstimate(CountMinSketch *sketch, void *item);
+
+void countMinSketchMerge(CountMinSketch *sketch, CountMinSketch *otherSketch);
+
+uint64_t countMinSketchGetTotal(CountMinSketch *sketch);
+
+void clearCountMinSketch(CountMinSketch *sketch);
+
+void destroyCountMinSketch(CountMinSketch *sketch);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_COUNTMINSKETCH_H
@@ -0,0 +1,84 @@
+#ifndef C_DATASTRUCTURES_HEAVYHITTERS_H
+#define C_DATASTRUCTURES_HEAVYHITTERS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct HeavyHitters
+*  @brief This structure implements the SpaceSaving algorithm, that finds the most frequent stream items with a fixed number of counters.
+*  Every item that appeared more than total / capacity times is guaranteed to be monitored,
+*  and the count of a monitored item is bigger than it's real count by at most it's error.
+*  @var HeavyHitters::items
+*  Member 'items' is a pointer to the monitored items copies, and every copy takes elemSize bytes.
+*  @var HeavyHitters::counts
+*  Member 'counts' is a pointer to the monitored items counts.
+*  @var HeavyHitters::errors
+*  Member 'errors' is a pointer to the monitored items errors, that is the count that the item inherited when it replaced another item.
+*  @var HeavyHitters::hashes
+*  Member 'hashes' is a pointer to the monitored items mixed hashes.
+*  @var HeavyHitters::heap
+*  Member 'heap' is a pointer to a min heap of the slots indices, ordered by their counts, so the smallest counter is found in O(1).
+*  @var HeavyHitters::heapPositions
+*  Member 'heapPositions' is a pointer to the position of every slot in the heap.
+*  @var HeavyHitters::table
+*  Member 'table' is a pointer to the open addressing table that maps the items to their slots, and it holds the slot index plus one or zero if empty.
+*  @var HeavyHitters::tableMask
+*  Member 'tableMask' holds the table length minus one, and the table length is a power of two.
+*  @var HeavyHitters::capacity
+*  Member 'capacity' holds the maximum number of the monitored items.
+*  @var HeavyHitters::count
+*  Member 'count' holds the current number of the monitored items.
+*  @var HeavyHitters::elemSize
+*  Member 'elemSize' holds the size of one item in bytes.
+*  @var HeavyHitters::total
+*  Member 'total' holds the sum of all the added counts.
+*  @var HeavyHitters::itemComp
+*  Member 'itemComp' is a pointer to the item comparator function, that compare the items.
+*  @var HeavyHitters::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the item.
+*/
+
+typedef struct HeavyHitters {
+    char *items;
+    uint64_t *counts;
+    uint64_t *errors;
+    uint32_t *hashes;
+    int *heap;
+    int *heapPositions;
+    int *table;
+    int tableMask;
+    int capacity;
+    int count;
+    int elemSize;
+    uint64_t total;
+    int (*itemComp)(const void *, const void *);
+    int (*hashFun)(const void *);
+} HeavyHitters;
+
+
+HeavyHitters *heavyHittersInitialization(int capacity, int elemSize, int (*itemComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void heavyHittersAdd(HeavyHitters *heavyHitters, void *item, uint64_t count);
+
+uint64_t heavyHittersEstimate(HeavyHitters *heavyHitters, void *item);
+
+int heavyHittersGetTop(HeavyHitters *heavyHitters, void *items, uint64_t *counts, int length);
+
+void heavyHittersMerge(HeavyHitters *heavyHitters, HeavyHitters *otherHeavyHitters);
+
+uint64_t heavyHittersGetTotal(HeavyHitters *heavyHitters);
+
+void clearHeavyHitters(HeavyHitters *heavyHitters);
+
+void destroyHeavyHitters(HeavyHitters *heavyHitters);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_HEAVYHITTERS_H
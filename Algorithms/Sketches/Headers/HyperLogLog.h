@@ -0,0 +1,49 @@
+#ifndef C_DATASTRUCTURES_HYPERLOGLOG_H
+#define C_DATASTRUCTURES_HYPERLOGLOG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct HyperLogLog
+*  @brief This structure implements a HyperLogLog counter, that estimates the number of distinct stream items with a fixed memory.
+*  The standard error of the estimate is about 1.04 / sqrt(registersNum).
+*  @var HyperLogLog::registers
+*  Member 'registers' is a pointer to the registers array, and every register holds the longest zeros run that it has seen plus one.
+*  @var HyperLogLog::precision
+*  Member 'precision' holds the number of hash bits that choose the register.
+*  @var HyperLogLog::registersNum
+*  Member 'registersNum' holds the number of registers, and it equals two to the power of the precision.
+*  @var HyperLogLog::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the item.
+*/
+
+typedef struct HyperLogLog {
+    uint8_t *registers;
+    int precision;
+    int registersNum;
+    int (*hashFun)(const void *);
+} HyperLogLog;
+
+
+HyperLogLog *hyperLogLogInitialization(int precision, int (*hashFun)(const void *));
+
+void hyperLogLogAdd(HyperLogLog *counter, void *item);
+
+double hyperLogLogEstimate(HyperLogLog *counter);
+
+void hyperLogLogMerge(HyperLogLog *counter, HyperLogLog *otherCounter);
+
+void clearHyperLogLog(HyperLogLog *counter);
+
+void destroyHyperLogLog(HyperLogLog *counter);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_HYPERLOGLOG_H
@@ -0,0 +1,357 @@
+#include "../Headers/CountMinSketch.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+#include <math.h>
+
+
+
+uint64_t countMinSketchHashCal(CountMinSketch *sketch, void *item);
+
+int countMinSketchIndex(CountMinSketch *sketch, uint64_t hash, int row);
+
+
+
+
+
+/** This function will take the wanted error, the wanted failure probability, and the hashing function as a parameters,
+ * then it will allocate a new count-min sketch, and it will return it's address.
+ *
+ * Note: the sketch will have ceil(e / epsilon) counters in every row, and ceil(ln(1 / delta)) rows,
+ * so the memory doesn't depend on the stream length.
+ *
+ * @param epsilon the wanted error as a fraction of the total count, and it should be between zero and one
+ * @param delta the probability that an estimate exceeds the error, and it should be between zero and one
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new sketch address
+ */
+
+CountMinSketch *countMinSketchInitialization(double epsilon, double delta, int (*hashFun)(const void *)) {
+    if (epsilon <= 0 || epsilon >= 1) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "epsilon", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (delta <= 0 || delta >= 1) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "delta", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    CountMinSketch *sketch = (CountMinSketch *) malloc(sizeof(CountMinSketch));
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "sketch", "count-min sketch");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    sketch->width = (int) ceil(exp(1) / epsilon);
+    sketch->depth = (int) ceil(log(1 / delta));
+    if (sketch->depth < 1)
+        sketch->depth = 1;
+
+    sketch->counters = (uint64_t *) calloc((size_t) sketch->width * sketch->depth, sizeof(uint64_t));
+    if (sketch->counters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(sketch);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "counters", "count-min sketch");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    sketch->total = 0;
+    sketch->hashFun = hashFun;
+
+    return sketch;
+
+}
+
+
+
+
+
+/** This function will take the sketch address, the item address, and a count as a parameters,
+ * then it will add the count to the item counters.
+ *
+ * @param sketch the sketch address
+ * @param item the item address
+ * @param count the number of times that the item appeared
+ */
+
+void countMinSketchAdd(CountMinSketch *sketch, void *item, uint64_t count) {
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint64_t hash = countMinSketchHashCal(sketch, item);
+
+    for (int row = 0; row < sketch->depth; row++)
+        sketch->counters[(size_t) row * sketch->width + countMinSketchIndex(sketch, hash, row)] += count;
+
+    sketch->total += count;
+
+}
+
+
+
+
+
+/** This function will take the sketch address, and the item address as a parameters,
+ * then it will return the estimated count of the item, that is the smallest counter of the item.
+ *
+ * Note: the estimate is never smaller than the real count.
+ *
+ * @param sketch the sketch address
+ * @param item the item address
+ * @return it will return the estimated count of the item
+ */
+
+uint64_t countMinSketchEstimate(CountMinSketch *sketch, void *item) {
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return 0;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint64_t hash = countMinSketchHashCal(sketch, item);
+    uint64_t estimate = UINT64_MAX;
+
+    for (int row = 0; row < sketch->depth; row++) {
+        uint64_t counter = sketch->counters[(size_t) row * sketch->width + countMinSketchIndex(sketch, hash, row)];
+        if (counter < estimate)
+            estimate = counter;
+
+    }
+
+    return estimate;
+
+}
+
+
+
+
+
+/** This function will take two sketches addresses as a parameters,
+ * then it will add the counters of the second sketch to the first sketch.
+ *
+ * Note: the two sketches should have the same width, depth, and hashing function,
+ * so a sketch that was filled by every thread can be merged into one sketch.
+ *
+ * @param sketch the sketch address that will hold the merge result
+ * @param otherSketch the sketch address that will be merged, and it will not be changed
+ */
+
+void countMinSketchMerge(CountMinSketch *sketch, CountMinSketch *otherSketch) {
+    if (sketch == NULL || otherSketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (sketch->width != otherSketch->width || sketch->depth != otherSketch->depth) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "sketch size (the sketches should have the same size)", "count-min sketch");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    size_t countersNum = (size_t) sketch->width * sketch->depth;
+    for (size_t i = 0; i < countersNum; i++)
+        sketch->counters[i] += otherSketch->counters[i];
+
+    sketch->total += otherSketch->total;
+
+}
+
+
+
+
+
+/** This function will take the sketch address as a parameter,
+ * then it will return the sum of all the added counts.
+ *
+ * @param sketch the sketch address
+ * @return it will return the sum of all the added counts
+ */
+
+uint64_t countMinSketchGetTotal(CountMinSketch *sketch) {
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return sketch->total;
+
+}
+
+
+
+
+
+/** This function will take the sketch address as a parameter,
+ * then it will set all the sketch counters to zero.
+ *
+ * @param sketch the sketch address
+ */
+
+void clearCountMinSketch(CountMinSketch *sketch) {
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    memset(sketch->counters, 0, sizeof(uint64_t) * sketch->width * sketch->depth);
+    sketch->total = 0;
+
+}
+
+
+
+
+
+/** This function will take the sketch address as a parameter,
+ * then it will destroy and free the sketch.
+ *
+ * @param sketch the sketch address
+ */
+
+void destroyCountMinSketch(CountMinSketch *sketch) {
+    if (sketch == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "sketch", "count-min sketch");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(sketch->counters);
+    free(sketch);
+
+}
+
+
+
+
+
+/** This function will take the sketch address, and the item address as a parameters,
+ * then it will call the sketch hashing function and spread the returned value over 64 bits.
+ *
+ * Note: this function should only be called from the count-min sketch functions.
+ *
+ * @param sketch the sketch address
+ * @param item the item address
+ * @return it will return the mixed 64 bits hash
+ */
+
+uint64_t countMinSketchHashCal(CountMinSketch *sketch, void *item) {
+    uint64_t hash = (uint32_t) sketch->hashFun(item);
+
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+
+    return hash;
+
+}
+
+
+
+
+
+/** This function will take the sketch address, the item mixed hash, and a row index as a parameters,
+ * then it will return the item counter index in the row.
+ *
+ * Note: the rows hashes are built from the two halves of the mixed hash (h1 + row * h2),
+ * so the item is hashed only one time for all the rows.
+ *
+ * Note: this function should only be called from the count-min sketch functions.
+ *
+ * @param sketch the sketch address
+ * @param hash the item mixed hash
+ * @param row the row index
+ * @return it will return the counter index in the row
+ */
+
+int countMinSketchIndex(CountMinSketch *sketch, uint64_t hash, int row) {
+    uint32_t rowHash = (uint32_t) hash + (uint32_t) row * ((uint32_t) (hash >> 32) | 1);
+    return (int) (((uint64_t) rowHash * (uint64_t) sketch->width) >> 32);
+}
@@ -0,0 +1,794 @@
+#include "../Headers/HeavyHitters.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+/** @struct HeavyHittersCandidate
+*  @brief This structure holds one item while merging or sorting the monitored items.
+*  @var HeavyHittersCandidate::item
+*  Member 'item' is a pointer to the item copy.
+*  @var HeavyHittersCandidate::hash
+*  Member 'hash' holds the item mixed hash.
+*  @var HeavyHittersCandidate::count
+*  Member 'count' holds the item count.
+*  @var HeavyHittersCandidate::error
+*  Member 'error' holds the item error.
+*/
+
+typedef struct HeavyHittersCandidate {
+    char *item;
+    uint32_t hash;
+    uint64_t count;
+    uint64_t error;
+} HeavyHittersCandidate;
+
+
+
+uint32_t heavyHittersHashCal(HeavyHitters *heavyHitters, void *item);
+
+int heavyHittersFindSlot(HeavyHitters *heavyHitters, void *item, uint32_t hash);
+
+void heavyHittersTableInsert(HeavyHitters *heavyHitters, int slot);
+
+void heavyHittersTableRemove(HeavyHitters *heavyHitters, int slot);
+
+void heavyHittersHeapSwap(HeavyHitters *heavyHitters, int firstPosition, int secondPosition);
+
+void heavyHittersSiftUp(HeavyHitters *heavyHitters, int position);
+
+void heavyHittersSiftDown(HeavyHitters *heavyHitters, int position);
+
+uint64_t heavyHittersMinCount(HeavyHitters *heavyHitters);
+
+int heavyHittersCandidatesComp(const void *firstCandidate, const void *secondCandidate);
+
+
+
+
+
+/** This function will take the number of counters, the size of one item, the item comparator function, and the hashing function as a parameters,
+ * then it will allocate a new heavy hitters counter, and it will return it's address.
+ *
+ * Note: the counter copies the items by value, so the items should be plain fixed size values,
+ * and all the memory is allocated here, so adding items will never allocate.
+ *
+ * Note: every item that appeared more than total / capacity times will be monitored,
+ * so to find the items that take more than 1% of the stream, use 100 counters or more.
+ *
+ * @param capacity the maximum number of the monitored items
+ * @param elemSize the size of one item in bytes
+ * @param itemComp the function address that will be called to compare two items
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new heavy hitters counter address
+ */
+
+HeavyHitters *heavyHittersInitialization(int capacity, int elemSize, int (*itemComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    if (capacity <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "capacity", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (elemSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "element size", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (itemComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item comparator function pointer", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    HeavyHitters *heavyHitters = (HeavyHitters *) malloc(sizeof(HeavyHitters));
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // the table is kept at most half full, so the probing stays short.
+    int tableLength = 2;
+    while (tableLength < capacity * 2)
+        tableLength <<= 1;
+
+    // all the arrays live in one block, and the items are first so freeing them frees the block.
+    size_t itemsSize = ((size_t) capacity * elemSize + 7) & ~(size_t) 7;
+    size_t blockSize = itemsSize + sizeof(uint64_t) * 2 * capacity + sizeof(uint32_t) * capacity
+                       + sizeof(int) * (2 * (size_t) capacity + tableLength);
+
+    char *block = (char *) calloc(1, blockSize);
+    if (block == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(heavyHitters);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "counters", "heavy hitters algorithm");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    heavyHitters->items = block;
+    heavyHitters->counts = (uint64_t *) (block + itemsSize);
+    heavyHitters->errors = heavyHitters->counts + capacity;
+    heavyHitters->hashes = (uint32_t *) (heavyHitters->errors + capacity);
+    heavyHitters->heap = (int *) (heavyHitters->hashes + capacity);
+    heavyHitters->heapPositions = heavyHitters->heap + capacity;
+    heavyHitters->table = heavyHitters->heapPositions + capacity;
+    heavyHitters->tableMask = tableLength - 1;
+    heavyHitters->capacity = capacity;
+    heavyHitters->count = 0;
+    heavyHitters->elemSize = elemSize;
+    heavyHitters->total = 0;
+    heavyHitters->itemComp = itemComp;
+    heavyHitters->hashFun = hashFun;
+
+    return heavyHitters;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, the item address, and a count as a parameters,
+ * then it will add the count to the item counter.
+ *
+ * Note: if the item isn't monitored and all the counters are used, the item will replace the item with the smallest count,
+ * and it will inherit that count as it's error.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param item the item address
+ * @param count the number of times that the item appeared
+ */
+
+void heavyHittersAdd(HeavyHitters *heavyHitters, void *item, uint64_t count) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint32_t hash = heavyHittersHashCal(heavyHitters, item);
+    int slot = heavyHittersFindSlot(heavyHitters, item, hash);
+    heavyHitters->total += count;
+
+    if (slot != -1) {
+        heavyHitters->counts[slot] += count;
+        heavyHittersSiftDown(heavyHitters, heavyHitters->heapPositions[slot]);
+        return;
+    }
+
+    if (heavyHitters->count < heavyHitters->capacity) {
+        slot = heavyHitters->count++;
+        heavyHitters->errors[slot] = 0;
+        heavyHitters->counts[slot] = count;
+        heavyHitters->heap[slot] = slot;
+        heavyHitters->heapPositions[slot] = slot;
+    } else {
+        slot = heavyHitters->heap[0];
+        heavyHittersTableRemove(heavyHitters, slot);
+        heavyHitters->errors[slot] = heavyHitters->counts[slot];
+        heavyHitters->counts[slot] += count;
+    }
+
+    memcpy(heavyHitters->items + (size_t) slot * heavyHitters->elemSize, item, heavyHitters->elemSize);
+    heavyHitters->hashes[slot] = hash;
+    heavyHittersTableInsert(heavyHitters, slot);
+
+    heavyHittersSiftUp(heavyHitters, heavyHitters->heapPositions[slot]);
+    heavyHittersSiftDown(heavyHitters, heavyHitters->heapPositions[slot]);
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and the item address as a parameters,
+ * then it will return an upper bound of the item count.
+ *
+ * Note: if the item isn't monitored, it will return the smallest monitored count,
+ * because an item that appeared more than that would be monitored.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param item the item address
+ * @return it will return the estimated count of the item
+ */
+
+uint64_t heavyHittersEstimate(HeavyHitters *heavyHitters, void *item) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return 0;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int slot = heavyHittersFindSlot(heavyHitters, item, heavyHittersHashCal(heavyHitters, item));
+
+    return slot != -1 ? heavyHitters->counts[slot] : heavyHittersMinCount(heavyHitters);
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, an items array, a counts array, and the arrays length as a parameters,
+ * then it will copy the most frequent monitored items and their counts into the arrays, ordered from the biggest count,
+ * and it will return the number of the copied items.
+ *
+ * Note: the items array should have a place for length items of elemSize bytes, and the counts array can be NULL.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param items the array that the items will be copied to
+ * @param counts the array that the counts will be copied to, or NULL
+ * @param length the maximum number of items to copy
+ * @return it will return the number of the copied items
+ */
+
+int heavyHittersGetTop(HeavyHitters *heavyHitters, void *items, uint64_t *counts, int length) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "length", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    HeavyHittersCandidate *candidates = (HeavyHittersCandidate *) malloc(sizeof(HeavyHittersCandidate) * (heavyHitters->count + 1));
+    if (candidates == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return -1;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "sorting array", "heavy hitters algorithm");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    for (int i = 0; i < heavyHitters->count; i++) {
+        candidates[i].item = heavyHitters->items + (size_t) i * heavyHitters->elemSize;
+        candidates[i].count = heavyHitters->counts[i];
+    }
+
+    qsort(candidates, heavyHitters->count, sizeof(HeavyHittersCandidate), heavyHittersCandidatesComp);
+
+    if (length > heavyHitters->count)
+        length = heavyHitters->count;
+
+    for (int i = 0; i < length; i++) {
+        memcpy((char *) items + (size_t) i * heavyHitters->elemSize, candidates[i].item, heavyHitters->elemSize);
+        if (counts != NULL)
+            counts[i] = candidates[i].count;
+
+    }
+
+    free(candidates);
+
+    return length;
+
+}
+
+
+
+
+
+/** This function will take two heavy hitters addresses as a parameters,
+ * then it will merge the second one into the first one, so the first one will summarize the two streams.
+ *
+ * Note: an item that is missing from one of them gets that one smallest count, because it could have appeared that many times,
+ * then the items with the biggest counts are kept, so the merge result keeps the same guarantees.
+ *
+ * Note: the two should have the same element size and functions, so a counter that was filled by every thread can be merged into one.
+ *
+ * @param heavyHitters the heavy hitters address that will hold the merge result
+ * @param otherHeavyHitters the heavy hitters address that will be merged, and it will not be changed
+ */
+
+void heavyHittersMerge(HeavyHitters *heavyHitters, HeavyHitters *otherHeavyHitters) {
+    if (heavyHitters == NULL || otherHeavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (heavyHitters->elemSize != otherHeavyHitters->elemSize) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "element size (the two should have the same element size)", "heavy hitters algorithm");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int candidatesNum = 0;
+    int elemSize = heavyHitters->elemSize;
+    HeavyHittersCandidate *candidates = (HeavyHittersCandidate *) malloc(sizeof(HeavyHittersCandidate) * (heavyHitters->count + otherHeavyHitters->count + 1));
+    char *itemsCopy = (char *) malloc((size_t) heavyHitters->capacity * elemSize);
+    if (candidates == NULL || itemsCopy == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(candidates);
+            free(itemsCopy);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "merging arrays", "heavy hitters algorithm");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    uint64_t minCount = heavyHittersMinCount(heavyHitters);
+    uint64_t otherMinCount = heavyHittersMinCount(otherHeavyHitters);
+
+    for (int i = 0; i < heavyHitters->count; i++) {
+        HeavyHittersCandidate *candidate = candidates + candidatesNum++;
+        candidate->item = heavyHitters->items + (size_t) i * elemSize;
+        candidate->hash = heavyHitters->hashes[i];
+
+        int otherSlot = heavyHittersFindSlot(otherHeavyHitters, candidate->item, candidate->hash);
+        if (otherSlot != -1) {
+            candidate->count = heavyHitters->counts[i] + otherHeavyHitters->counts[otherSlot];
+            candidate->error = heavyHitters->errors[i] + otherHeavyHitters->errors[otherSlot];
+        } else {
+            candidate->count = heavyHitters->counts[i] + otherMinCount;
+            candidate->error = heavyHitters->errors[i] + otherMinCount;
+        }
+
+    }
+
+    for (int i = 0; i < otherHeavyHitters->count; i++) {
+        char *item = otherHeavyHitters->items + (size_t) i * elemSize;
+        if (heavyHittersFindSlot(heavyHitters, item, otherHeavyHitters->hashes[i]) != -1)
+            continue;
+
+        HeavyHittersCandidate *candidate = candidates + candidatesNum++;
+        candidate->item = item;
+        candidate->hash = otherHeavyHitters->hashes[i];
+        candidate->count = otherHeavyHitters->counts[i] + minCount;
+        candidate->error = otherHeavyHitters->errors[i] + minCount;
+    }
+
+    qsort(candidates, candidatesNum, sizeof(HeavyHittersCandidate), heavyHittersCandidatesComp);
+
+    if (candidatesNum > heavyHitters->capacity)
+        candidatesNum = heavyHitters->capacity;
+
+    // the candidates point into the current items, so they are copied out before the rebuilding.
+    for (int i = 0; i < candidatesNum; i++)
+        memcpy(itemsCopy + (size_t) i * elemSize, candidates[i].item, elemSize);
+
+    memcpy(heavyHitters->items, itemsCopy, (size_t) candidatesNum * elemSize);
+    memset(heavyHitters->table, 0, sizeof(int) * (heavyHitters->tableMask + 1));
+
+    for (int i = 0; i < candidatesNum; i++) {
+        heavyHitters->counts[i] = candidates[i].count;
+        heavyHitters->errors[i] = candidates[i].error;
+        heavyHitters->hashes[i] = candidates[i].hash;
+        heavyHittersTableInsert(heavyHitters, i);
+
+        // the candidates are sorted from the biggest count, so the heap is filled in reverse order.
+        heavyHitters->heap[candidatesNum - 1 - i] = i;
+        heavyHitters->heapPositions[i] = candidatesNum - 1 - i;
+    }
+
+    heavyHitters->count = candidatesNum;
+    heavyHitters->total += otherHeavyHitters->total;
+
+    free(candidates);
+    free(itemsCopy);
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address as a parameter,
+ * then it will return the sum of all the added counts.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @return it will return the sum of all the added counts
+ */
+
+uint64_t heavyHittersGetTotal(HeavyHitters *heavyHitters) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return heavyHitters->total;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address as a parameter,
+ * then it will remove all the monitored items.
+ *
+ * @param heavyHitters the heavy hitters address
+ */
+
+void clearHeavyHitters(HeavyHitters *heavyHitters) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    memset(heavyHitters->table, 0, sizeof(int) * (heavyHitters->tableMask + 1));
+    heavyHitters->count = 0;
+    heavyHitters->total = 0;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address as a parameter,
+ * then it will destroy and free the heavy hitters counter.
+ *
+ * @param heavyHitters the heavy hitters address
+ */
+
+void destroyHeavyHitters(HeavyHitters *heavyHitters) {
+    if (heavyHitters == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "heavy hitters", "heavy hitters algorithm");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(heavyHitters->items);
+    free(heavyHitters);
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and the item address as a parameters,
+ * then it will call the hashing function and mix the returned value.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param item the item address
+ * @return it will return the mixed hash
+ */
+
+uint32_t heavyHittersHashCal(HeavyHitters *heavyHitters, void *item) {
+    uint32_t hash = (uint32_t) heavyHitters->hashFun(item);
+
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    return hash ^ (hash >> 16);
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, the item address, and the item mixed hash as a parameters,
+ * then it will return the slot index of the item if it's monitored, other wise it will return -1.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param item the item address
+ * @param hash the item mixed hash
+ * @return it will return the item slot index, or -1 if it's not monitored
+ */
+
+int heavyHittersFindSlot(HeavyHitters *heavyHitters, void *item, uint32_t hash) {
+    int tableIndex = (int) (hash & (uint32_t) heavyHitters->tableMask);
+
+    while (heavyHitters->table[tableIndex] != 0) {
+        int slot = heavyHitters->table[tableIndex] - 1;
+        if (heavyHitters->hashes[slot] == hash
+            && heavyHitters->itemComp(item, heavyHitters->items + (size_t) slot * heavyHitters->elemSize) == 0)
+            return slot;
+
+        tableIndex = (tableIndex + 1) & heavyHitters->tableMask;
+    }
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and a slot index as a parameters,
+ * then it will add the slot to the table, at the first empty place after it's hash place.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param slot the slot index
+ */
+
+void heavyHittersTableInsert(HeavyHitters *heavyHitters, int slot) {
+    int tableIndex = (int) (heavyHitters->hashes[slot] & (uint32_t) heavyHitters->tableMask);
+
+    while (heavyHitters->table[tableIndex] != 0)
+        tableIndex = (tableIndex + 1) & heavyHitters->tableMask;
+
+    heavyHitters->table[tableIndex] = slot + 1;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and a slot index as a parameters,
+ * then it will remove the slot from the table, and it will shift the following entries back,
+ * so the table doesn't need deletion marks.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param slot the slot index
+ */
+
+void heavyHittersTableRemove(HeavyHitters *heavyHitters, int slot) {
+    int mask = heavyHitters->tableMask;
+    int emptyIndex = (int) (heavyHitters->hashes[slot] & (uint32_t) mask);
+
+    while (heavyHitters->table[emptyIndex] != slot + 1)
+        emptyIndex = (emptyIndex + 1) & mask;
+
+    int tableIndex = emptyIndex;
+    while (1) {
+        tableIndex = (tableIndex + 1) & mask;
+        if (heavyHitters->table[tableIndex] == 0)
+            break;
+
+        int homeIndex = (int) (heavyHitters->hashes[heavyHitters->table[tableIndex] - 1] & (uint32_t) mask);
+
+        // the entry can move back only if the empty place is between it's home place and it's current place.
+        if (((tableIndex - homeIndex) & mask) >= ((tableIndex - emptyIndex) & mask)) {
+            heavyHitters->table[emptyIndex] = heavyHitters->table[tableIndex];
+            emptyIndex = tableIndex;
+        }
+
+    }
+
+    heavyHitters->table[emptyIndex] = 0;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and two heap positions as a parameters,
+ * then it will swap the two heap entries, and it will update their slots positions.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param firstPosition the first heap position
+ * @param secondPosition the second heap position
+ */
+
+void heavyHittersHeapSwap(HeavyHitters *heavyHitters, int firstPosition, int secondPosition) {
+    int firstSlot = heavyHitters->heap[firstPosition];
+    int secondSlot = heavyHitters->heap[secondPosition];
+
+    heavyHitters->heap[firstPosition] = secondSlot;
+    heavyHitters->heap[secondPosition] = firstSlot;
+    heavyHitters->heapPositions[secondSlot] = firstPosition;
+    heavyHitters->heapPositions[firstSlot] = secondPosition;
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and a heap position as a parameters,
+ * then it will move the entry up while it's count is smaller than it's parent count.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param position the heap position
+ */
+
+void heavyHittersSiftUp(HeavyHitters *heavyHitters, int position) {
+    while (position > 0) {
+        int parent = (position - 1) / 2;
+        if (heavyHitters->counts[heavyHitters->heap[parent]] <= heavyHitters->counts[heavyHitters->heap[position]])
+            return;
+
+        heavyHittersHeapSwap(heavyHitters, parent, position);
+        position = parent;
+    }
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address, and a heap position as a parameters,
+ * then it will move the entry down while one of it's children has a smaller count.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @param position the heap position
+ */
+
+void heavyHittersSiftDown(HeavyHitters *heavyHitters, int position) {
+    uint64_t *counts = heavyHitters->counts;
+    int *heap = heavyHitters->heap;
+
+    while (1) {
+        int smallest = position;
+        int left = position * 2 + 1, right = left + 1;
+
+        if (left < heavyHitters->count && counts[heap[left]] < counts[heap[smallest]])
+            smallest = left;
+
+        if (right < heavyHitters->count && counts[heap[right]] < counts[heap[smallest]])
+            smallest = right;
+
+        if (smallest == position)
+            return;
+
+        heavyHittersHeapSwap(heavyHitters, position, smallest);
+        position = smallest;
+    }
+
+}
+
+
+
+
+
+/** This function will take the heavy hitters address as a parameter,
+ * then it will return the smallest monitored count if all the counters are used, other wise it will return zero.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param heavyHitters the heavy hitters address
+ * @return it will return the count that any not monitored item can't exceed
+ */
+
+uint64_t heavyHittersMinCount(HeavyHitters *heavyHitters) {
+    if (heavyHitters->count < heavyHitters->capacity)
+        return 0;
+
+    return heavyHitters->counts[heavyHitters->heap[0]];
+
+}
+
+
+
+
+
+/** This function will take two candidates addresses as a parameters,
+ * then it will compare their counts, so the candidates will be sorted from the biggest count.
+ *
+ * Note: this function should only be called from the heavy hitters functions.
+ *
+ * @param firstCandidate the first candidate address
+ * @param secondCandidate the second candidate address
+ * @return it will return a negative number if the first count is bigger, a positive number if it's smaller, and zero if they are equal
+ */
+
+int heavyHittersCandidatesComp(const void *firstCandidate, const void *secondCandidate) {
+    uint64_t firstCount = ((HeavyHittersCandidate *) firstCandidate)->count;
+    uint64_t secondCount = ((HeavyHittersCandidate *) secondCandidate)->count;
+
+    return (firstCount < secondCount) - (firstCount > secondCount);
+
+}
@@ -0,0 +1,313 @@
+#include "../Headers/HyperLogLog.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+#include <math.h>
+
+
+/// The smallest allowed precision.
+#define HYPER_LOG_LOG_MIN_PRECISION 4
+
+/// The biggest allowed precision.
+#define HYPER_LOG_LOG_MAX_PRECISION 18
+
+
+
+uint64_t hyperLogLogHashCal(HyperLogLog *counter, void *item);
+
+
+
+
+
+/** This function will take the precision, and the hashing function as a parameters,
+ * then it will allocate a new HyperLogLog counter with two to the power of the precision registers,
+ * and it will return the counter address.
+ *
+ * Note: every register takes one byte, so precision 14 takes 16 KB and gives about 0.8% standard error.
+ *
+ * @param precision the number of hash bits that choose the register, and it should be between 4 and 18
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new counter address
+ */
+
+HyperLogLog *hyperLogLogInitialization(int precision, int (*hashFun)(const void *)) {
+    if (precision < HYPER_LOG_LOG_MIN_PRECISION || precision > HYPER_LOG_LOG_MAX_PRECISION) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "precision", "hyperloglog counter");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "hyperloglog counter");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    HyperLogLog *counter = (HyperLogLog *) malloc(sizeof(HyperLogLog));
+    if (counter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "counter", "hyperloglog counter");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    counter->precision = precision;
+    counter->registersNum = 1 << precision;
+    counter->registers = (uint8_t *) calloc(counter->registersNum, sizeof(uint8_t));
+    if (counter->registers == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(counter);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "registers", "hyperloglog counter");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    counter->hashFun = hashFun;
+
+    return counter;
+
+}
+
+
+
+
+
+/** This function will take the counter address, and the item address as a parameters,
+ * then it will add the item to the counter.
+ *
+ * Note: adding the same item more than one time will not change the estimate.
+ *
+ * @param counter the counter address
+ * @param item the item address
+ */
+
+void hyperLogLogAdd(HyperLogLog *counter, void *item) {
+    if (counter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "counter", "hyperloglog counter");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "hyperloglog counter");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint64_t hash = hyperLogLogHashCal(counter, item);
+    uint64_t registerIndex = hash >> (64 - counter->precision);
+
+    // the rest of the bits, with a stop bit so the zeros run can't pass them.
+    uint64_t remainingBits = (hash << counter->precision) | ((uint64_t) 1 << (counter->precision - 1));
+    uint8_t rank = 1;
+    while ((remainingBits & ((uint64_t) 1 << 63)) == 0) {
+        remainingBits <<= 1;
+        rank++;
+    }
+
+    if (rank > counter->registers[registerIndex])
+        counter->registers[registerIndex] = rank;
+
+}
+
+
+
+
+
+/** This function will take the counter address as a parameter,
+ * then it will return the estimated number of the distinct added items.
+ *
+ * Note: small estimates are corrected by linear counting over the empty registers.
+ *
+ * @param counter the counter address
+ * @return it will return the estimated number of the distinct items
+ */
+
+double hyperLogLogEstimate(HyperLogLog *counter) {
+    if (counter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "counter", "hyperloglog counter");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    double registersNum = counter->registersNum;
+    double sum = 0;
+    int emptyRegisters = 0;
+
+    for (int i = 0; i < counter->registersNum; i++) {
+        sum += ldexp(1.0, -counter->registers[i]);
+        if (counter->registers[i] == 0)
+            emptyRegisters++;
+
+    }
+
+    double alpha;
+    if (counter->registersNum == 16)
+        alpha = 0.673;
+    else if (counter->registersNum == 32)
+        alpha = 0.697;
+    else if (counter->registersNum == 64)
+        alpha = 0.709;
+    else
+        alpha = 0.7213 / (1 + 1.079 / registersNum);
+
+    double estimate = alpha * registersNum * registersNum / sum;
+
+    if (estimate <= 2.5 * registersNum && emptyRegisters != 0)
+        estimate = registersNum * log(registersNum / emptyRegisters);
+
+    return estimate;
+
+}
+
+
+
+
+
+/** This function will take two counters addresses as a parameters,
+ * then it will merge the second counter into the first one, so the first counter will estimate the union of the two streams.
+ *
+ * Note: the two counters should have the same precision and hashing function,
+ * so a counter that was filled by every thread can be merged into one counter.
+ *
+ * @param counter the counter address that will hold the merge result
+ * @param otherCounter the counter address that will be merged, and it will not be changed
+ */
+
+void hyperLogLogMerge(HyperLogLog *counter, HyperLogLog *otherCounter) {
+    if (counter == NULL || otherCounter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "counter", "hyperloglog counter");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (counter->precision != otherCounter->precision) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "precision (the counters should have the same precision)", "hyperloglog counter");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (int i = 0; i < counter->registersNum; i++) {
+        if (otherCounter->registers[i] > counter->registers[i])
+            counter->registers[i] = otherCounter->registers[i];
+
+    }
+
+}
+
+
+
+
+
+/** This function will take the counter address as a parameter,
+ * then it will remove all the added items from the counter.
+ *
+ * @param counter the counter address
+ */
+
+void clearHyperLogLog(HyperLogLog *counter) {
+    if (counter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "counter", "hyperloglog counter");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    memset(counter->registers, 0, counter->registersNum);
+
+}
+
+
+
+
+
+/** This function will take the counter address as a parameter,
+ * then it will destroy and free the counter.
+ *
+ * @param counter the counter address
+ */
+
+void destroyHyperLogLog(HyperLogLog *counter) {
+    if (counter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "counter", "hyperloglog counter");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(counter->registers);
+    free(counter);
+
+}
+
+
+
+
+
+/** This function will take the counter address, and the item address as a parameters,
+ * then it will call the counter hashing function and spread the returned value over 64 bits.
+ *
+ * Note: HyperLogLog needs the hash bits to look random, so the value is mixed even if the hashing function is the identity.
+ *
+ * Note: this function should only be called from the HyperLogLog functions.
+ *
+ * @param counter the counter address
+ * @param item the item address
+ * @return it will return the mixed 64 bits hash
+ */
+
+uint64_t hyperLogLogHashCal(HyperLogLog *counter, void *item) {
+    uint64_t hash = (uint32_t) counter->hashFun(item);
+
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+
+    return hash;
+
+}
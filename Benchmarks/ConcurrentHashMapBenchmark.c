@@ -0,0 +1,245 @@
+#include <pthread.h>
+#include <time.h>
+#include "../System/Utils.h"
+#include "../DataStructure/Tables/Headers/HashMap.h"
+#include "../DataStructure/Tables/Headers/ConcurrentHashMap.h"
+
+
+
+/** This benchmark compares the throughput of a HashMap that is guarded by one global mutex,
+ * against the ConcurrentHashMap, while many threads are reading and overriding the same keys.
+ *
+ * usage: ConcurrentHashMapBenchmark [threads number] [operations per thread] [keys number]
+ */
+
+
+
+#define BENCHMARK_WRITE_PERCENT 10
+
+
+
+/** The parameters of every benchmark worker thread. */
+
+typedef struct BenchmarkArgs {
+    HashMap *map;
+    pthread_mutex_t *mapLock;
+    ConcurrentHashMap *cMap;
+    int opsNum;
+    int keysNum;
+    unsigned int seed;
+} BenchmarkArgs;
+
+
+
+/** This function will allocate a new integer that holds the passed value and return it's pointer.
+ *
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerBench(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+/** This function will compare two integers pointers, and it will return zero if they are equal.
+ *
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return the difference between the two integers
+ */
+
+int compareIntPointersBench(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+/** This function will return the value of the passed integer pointer as it's hash.
+ *
+ * @param integer the integer pointer
+ * @return it will return the integer value
+ */
+
+int intHashFunBench(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+/** This function will add the value of the passed integer item to the passed sum,
+ * and it's called while the item segment is locked, so the item can't be freed by a writer thread.
+ *
+ * @param item the integer item pointer
+ * @param sum the sum address
+ */
+
+void addToSumVisitBench(const void *item, void *sum) {
+    *(long *) sum += *(const int *) item;
+}
+
+
+
+/** This function will take the thread random seed address, then it will update it and return the next pseudo random number.
+ *
+ * @param seed the random seed address
+ * @return it will return the next pseudo random number
+ */
+
+unsigned int nextRandomBench(unsigned int *seed) {
+    *seed = *seed * 1103515245U + 12345U;
+    return *seed >> 8;
+}
+
+
+
+/** This function will return the current monotonic time in seconds.
+ *
+ * @return it will return the current time in seconds
+ */
+
+double currentSecondsBench() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+
+
+/** This function will do the benchmark operations on the hash map, while locking the global mutex around every operation.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the read items, so the reads can't be optimized away
+ */
+
+void *lockedHashMapWorker(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->opsNum; i++) {
+        unsigned int random = nextRandomBench(&benchArgs->seed);
+        int key = (int) (random % benchArgs->keysNum);
+
+        pthread_mutex_lock(benchArgs->mapLock);
+
+        if (random % 100 < BENCHMARK_WRITE_PERCENT)
+            hashMapInsert(benchArgs->map, generateIntPointerBench(key), generateIntPointerBench(key));
+        else
+            sum += *(int *) hashMapGet(benchArgs->map, &key);
+
+        pthread_mutex_unlock(benchArgs->mapLock);
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will do the benchmark operations on the concurrent hash map.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the read items, so the reads can't be optimized away
+ */
+
+void *concurrentHashMapWorker(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->opsNum; i++) {
+        unsigned int random = nextRandomBench(&benchArgs->seed);
+        int key = (int) (random % benchArgs->keysNum);
+
+        if (random % 100 < BENCHMARK_WRITE_PERCENT)
+            concurrentHashMapInsert(benchArgs->cMap, generateIntPointerBench(key), generateIntPointerBench(key));
+        else
+            concurrentHashMapVisit(benchArgs->cMap, &key, addToSumVisitBench, &sum);
+
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will start the passed number of threads on the worker function, then it will wait for them and return the elapsed time.
+ *
+ * @param worker the worker function address
+ * @param templateArgs the arguments that will be copied to every thread
+ * @param threadsNum the number of threads
+ * @return it will return the elapsed time in seconds
+ */
+
+double runBenchmark(void *(*worker)(void *), BenchmarkArgs *templateArgs, int threadsNum) {
+    pthread_t *threads = (pthread_t *) malloc(sizeof(pthread_t) * threadsNum);
+    BenchmarkArgs *args = (BenchmarkArgs *) malloc(sizeof(BenchmarkArgs) * threadsNum);
+
+    double start = currentSecondsBench();
+
+    for (int i = 0; i < threadsNum; i++) {
+        args[i] = *templateArgs;
+        args[i].seed = (unsigned int) i * 7919U + 1;
+        pthread_create(threads + i, NULL, worker, args + i);
+    }
+
+    for (int i = 0; i < threadsNum; i++)
+        pthread_join(threads[i], NULL);
+
+    double seconds = currentSecondsBench() - start;
+
+    free(threads);
+    free(args);
+
+    return seconds;
+
+}
+
+
+
+int main(int argc, char **argv) {
+    int threadsNum = argc > 1 ? atoi(argv[1]) : 4;
+    int opsNum = argc > 2 ? atoi(argv[2]) : 200000;
+    int keysNum = argc > 3 ? atoi(argv[3]) : 4096;
+
+    if (threadsNum <= 0 || opsNum <= 0 || keysNum <= 0) {
+        fprintf(stderr, "usage: %s [threads number] [operations per thread] [keys number]\n", argv[0]);
+        return INVALID_ARG;
+    }
+
+    pthread_mutex_t mapLock;
+    pthread_mutex_init(&mapLock, NULL);
+
+    BenchmarkArgs args;
+    args.map = hashMapInitialization(free, free, compareIntPointersBench, intHashFunBench);
+    args.mapLock = &mapLock;
+    args.cMap = concurrentHashMapInitialization(threadsNum * 4, free, free, compareIntPointersBench, intHashFunBench);
+    args.opsNum = opsNum;
+    args.keysNum = keysNum;
+
+    for (int i = 0; i < keysNum; i++) {
+        hashMapInsert(args.map, generateIntPointerBench(i), generateIntPointerBench(i));
+        concurrentHashMapInsert(args.cMap, generateIntPointerBench(i), generateIntPointerBench(i));
+    }
+
+    double totalOps = (double) threadsNum * opsNum;
+    double lockedSeconds = runBenchmark(lockedHashMapWorker, &args, threadsNum);
+    double concurrentSeconds = runBenchmark(concurrentHashMapWorker, &args, threadsNum);
+
+    printf("threads: %d, operations per thread: %d, keys: %d, writes: %d%%\n", threadsNum, opsNum, keysNum, BENCHMARK_WRITE_PERCENT);
+    printf("global mutex hash map: %.3f s, %.0f ops/s\n", lockedSeconds, totalOps / lockedSeconds);
+    printf("concurrent hash map:   %.3f s, %.0f ops/s\n", concurrentSeconds, totalOps / concurrentSeconds);
+
+    destroyHashMap(args.map);
+    destroyConcurrentHashMap(args.cMap);
+    pthread_mutex_destroy(&mapLock);
+
+    return 0;
+
+}
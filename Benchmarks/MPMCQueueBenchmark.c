@@ -0,0 +1,302 @@
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../System/Utils.h"
+#include "../DataStructure/Queues/Headers/Queue.h"
+#include "../DataStructure/Queues/Headers/MPMCQueue.h"
+
+
+
+/** This benchmark compares a Queue that is guarded by one mutex against the MPMCQueue,
+ * while the same number of producer and consumer threads are passing pointers through one queue.
+ * The MPMCQueue is measured with the try functions and with the blocking functions,
+ * and it's contention counters are printed after every run.
+ *
+ * Note: the retries and the failed tries are only counted when the benchmark is compiled with -DMPMC_QUEUE_STATS,
+ * and counting them adds shared atomic writes to the measured paths.
+ *
+ * Note: every failed try yields the processor, so the benchmark still progresses when the threads share cores.
+ *
+ * usage: MPMCQueueBenchmark [threads number per side] [items per producer] [queue capacity]
+ */
+
+
+
+/** The parameters of every benchmark thread. */
+
+typedef struct BenchmarkArgs {
+    Queue *queue;
+    pthread_mutex_t *queueLock;
+    MPMCQueue *mpmcQueue;
+    int itemsNum;
+    int capacity;
+} BenchmarkArgs;
+
+
+
+/** This function will do nothing, and it's used as the queues freeing function,
+ * because the benchmark items are numbers that are casted to pointers.
+ *
+ * @param item the item pointer
+ */
+
+void freeNothingBench(void *item) {
+    (void) item;
+}
+
+
+
+/** This function will return the current monotonic time in seconds.
+ *
+ * @return it will return the current time in seconds
+ */
+
+double currentSecondsBench() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+
+
+/** This function will enqueue the items into the mutex queue, and it will wait while the queue holds the capacity,
+ * so the mutex queue is bounded like the mpmc queue.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *lockedQueueProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 1; i <= benchArgs->itemsNum;) {
+        pthread_mutex_lock(benchArgs->queueLock);
+
+        int enqueued = queueGetLength(benchArgs->queue) < benchArgs->capacity;
+        if (enqueued)
+            queueEnqueue(benchArgs->queue, (void *) (intptr_t) i++);
+
+        pthread_mutex_unlock(benchArgs->queueLock);
+
+        if (!enqueued)
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue the items of one producer from the mutex queue.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *lockedQueueConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        pthread_mutex_lock(benchArgs->queueLock);
+
+        void *item = queueIsEmpty(benchArgs->queue) ? NULL : queueDequeue(benchArgs->queue);
+
+        pthread_mutex_unlock(benchArgs->queueLock);
+
+        if (item != NULL) {
+            sum += (intptr_t) item;
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will enqueue the items into the mpmc queue using the try function.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *mpmcQueueTryProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 1; i <= benchArgs->itemsNum;) {
+        if (mpmcQueueTryEnqueue(benchArgs->mpmcQueue, (void *) (intptr_t) i))
+            i++;
+        else
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue the items of one producer from the mpmc queue using the try function.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *mpmcQueueTryConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        void *item = mpmcQueueTryDequeue(benchArgs->mpmcQueue);
+        if (item != NULL) {
+            sum += (intptr_t) item;
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will enqueue the items into the mpmc queue using the blocking function.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *mpmcQueueBlockingProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 1; i <= benchArgs->itemsNum; i++)
+        mpmcQueueEnqueue(benchArgs->mpmcQueue, (void *) (intptr_t) i);
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue the items of one producer from the mpmc queue using the blocking function.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *mpmcQueueBlockingConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum; i++)
+        sum += (intptr_t) mpmcQueueDequeue(benchArgs->mpmcQueue);
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will start the passed number of producer and consumer threads,
+ * then it will wait for them and return the elapsed time.
+ *
+ * @param producer the producer function address
+ * @param consumer the consumer function address
+ * @param args the benchmark arguments pointer
+ * @param threadsNum the number of threads per side
+ * @return it will return the elapsed time in seconds
+ */
+
+double runBenchmark(void *(*producer)(void *), void *(*consumer)(void *), BenchmarkArgs *args, int threadsNum) {
+    pthread_t *threads = (pthread_t *) malloc(sizeof(pthread_t) * threadsNum * 2);
+
+    double start = currentSecondsBench();
+
+    for (int i = 0; i < threadsNum; i++) {
+        pthread_create(threads + i, NULL, consumer, args);
+        pthread_create(threads + threadsNum + i, NULL, producer, args);
+    }
+
+    for (int i = 0; i < threadsNum * 2; i++)
+        pthread_join(threads[i], NULL);
+
+    double seconds = currentSecondsBench() - start;
+
+    free(threads);
+
+    return seconds;
+
+}
+
+
+
+/** This function will print the mpmc queue contention counters, then it will reset them for the next run.
+ *
+ * @param queue the queue address
+ */
+
+void printAndResetStatsBench(MPMCQueue *queue) {
+    MPMCQueueStats stats;
+    mpmcQueueGetStats(queue, &stats);
+
+    printf("    retries: %lu enqueue, %lu dequeue | failed tries: %lu full, %lu empty | parks: %lu producer, %lu consumer\n",
+           stats.enqueueRetries, stats.dequeueRetries, stats.fullFailures, stats.emptyFailures,
+           stats.producerParks, stats.consumerParks);
+
+    mpmcQueueResetStats(queue);
+
+}
+
+
+
+int main(int argc, char **argv) {
+    int threadsNum = argc > 1 ? atoi(argv[1]) : 8;
+    int itemsNum = argc > 2 ? atoi(argv[2]) : 200000;
+    int capacity = argc > 3 ? atoi(argv[3]) : 1024;
+
+    if (threadsNum <= 0 || itemsNum <= 0 || capacity <= 0) {
+        fprintf(stderr, "usage: %s [threads number per side] [items per producer] [queue capacity]\n", argv[0]);
+        return INVALID_ARG;
+    }
+
+    pthread_mutex_t queueLock;
+    pthread_mutex_init(&queueLock, NULL);
+
+    BenchmarkArgs args;
+    args.queue = queueInitialization(freeNothingBench);
+    args.queueLock = &queueLock;
+    args.mpmcQueue = mpmcQueueInitialization(capacity, freeNothingBench);
+    args.itemsNum = itemsNum;
+    args.capacity = capacity;
+
+    double totalItems = (double) threadsNum * itemsNum;
+    double lockedSeconds = runBenchmark(lockedQueueProducer, lockedQueueConsumer, &args, threadsNum);
+
+    printf("producers: %d, consumers: %d, items per producer: %d, capacity: %d\n", threadsNum, threadsNum, itemsNum, capacity);
+    printf("mutex queue:         %.3f s, %.0f items/s\n", lockedSeconds, totalItems / lockedSeconds);
+
+    double trySeconds = runBenchmark(mpmcQueueTryProducer, mpmcQueueTryConsumer, &args, threadsNum);
+    printf("mpmc queue try:      %.3f s, %.0f items/s\n", trySeconds, totalItems / trySeconds);
+    printAndResetStatsBench(args.mpmcQueue);
+
+    double blockingSeconds = runBenchmark(mpmcQueueBlockingProducer, mpmcQueueBlockingConsumer, &args, threadsNum);
+    printf("mpmc queue blocking: %.3f s, %.0f items/s\n", blockingSeconds, totalItems / blockingSeconds);
+    printAndResetStatsBench(args.mpmcQueue);
+
+    queueDestroy(args.queue);
+    destroyMPMCQueue(args.mpmcQueue);
+    pthread_mutex_destroy(&queueLock);
+
+    return 0;
+
+}
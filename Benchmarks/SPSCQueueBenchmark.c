@@ -0,0 +1,423 @@
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../System/Utils.h"
+#include "../DataStructure/Queues/Headers/Queue.h"
+#include "../DataStructure/Queues/Headers/SPSCQueue.h"
+
+
+
+/** This benchmark compares a Queue that is guarded by one mutex against the SPSCQueue,
+ * while one producer thread is passing pointers to one consumer thread.
+ * The throughput is measured by streaming the items through one queue,
+ * and the latency is measured by bouncing one item between two threads over two queues.
+ *
+ * Note: every failed try yields the processor, so the benchmark still progresses when the threads share one core.
+ *
+ * usage: SPSCQueueBenchmark [items number] [queue capacity] [batch length] [round trips number]
+ */
+
+
+
+#define BENCHMARK_MAX_BATCH_LENGTH 256
+
+
+
+/** The parameters of every benchmark thread. */
+
+typedef struct BenchmarkArgs {
+    Queue *queue;
+    pthread_mutex_t *queueLock;
+    SPSCQueue *spscQueue;
+    Queue *replyQueue;
+    pthread_mutex_t *replyLock;
+    SPSCQueue *spscReplyQueue;
+    int itemsNum;
+    int capacity;
+    int batchLength;
+} BenchmarkArgs;
+
+
+
+/** This function will do nothing, and it's used as the queues freeing function,
+ * because the benchmark items are numbers that are casted to pointers.
+ *
+ * @param item the item pointer
+ */
+
+void freeNothingBench(void *item) {
+    (void) item;
+}
+
+
+
+/** This function will return the current monotonic time in seconds.
+ *
+ * @return it will return the current time in seconds
+ */
+
+double currentSecondsBench() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+
+
+/** This function will enqueue the items into the mutex queue, and it will wait while the queue holds the capacity,
+ * so the mutex queue is bounded like the spsc queue.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *lockedQueueProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 1; i <= benchArgs->itemsNum;) {
+        pthread_mutex_lock(benchArgs->queueLock);
+
+        int enqueued = queueGetLength(benchArgs->queue) < benchArgs->capacity;
+        if (enqueued)
+            queueEnqueue(benchArgs->queue, (void *) (intptr_t) i++);
+
+        pthread_mutex_unlock(benchArgs->queueLock);
+
+        if (!enqueued)
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue all the items from the mutex queue.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *lockedQueueConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        pthread_mutex_lock(benchArgs->queueLock);
+
+        void *item = queueIsEmpty(benchArgs->queue) ? NULL : queueDequeue(benchArgs->queue);
+
+        pthread_mutex_unlock(benchArgs->queueLock);
+
+        if (item != NULL) {
+            sum += (intptr_t) item;
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will enqueue the items into the spsc queue one by one.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *spscQueueProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 1; i <= benchArgs->itemsNum;) {
+        if (spscQueueTryEnqueue(benchArgs->spscQueue, (void *) (intptr_t) i))
+            i++;
+        else
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue all the items from the spsc queue one by one.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *spscQueueConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        void *item = spscQueueTryDequeue(benchArgs->spscQueue);
+        if (item != NULL) {
+            sum += (intptr_t) item;
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will enqueue the items into the spsc queue in batches.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *spscQueueBatchProducer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    void *batch[BENCHMARK_MAX_BATCH_LENGTH];
+
+    for (int i = 1; i <= benchArgs->itemsNum;) {
+        int batchLength = 0;
+        while (batchLength < benchArgs->batchLength && i + batchLength <= benchArgs->itemsNum) {
+            batch[batchLength] = (void *) (intptr_t) (i + batchLength);
+            batchLength++;
+        }
+
+        int enqueuedCount = spscQueueEnqueueBatch(benchArgs->spscQueue, batch, batchLength);
+        if (enqueuedCount == 0)
+            sched_yield();
+
+        i += enqueuedCount;
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will dequeue all the items from the spsc queue in batches.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return the sum of the items, so the dequeues can't be optimized away
+ */
+
+void *spscQueueBatchConsumer(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+    void *batch[BENCHMARK_MAX_BATCH_LENGTH];
+    long sum = 0;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        int batchLength = spscQueueDequeueBatch(benchArgs->spscQueue, batch, benchArgs->batchLength);
+        if (batchLength == 0)
+            sched_yield();
+
+        for (int j = 0; j < batchLength; j++)
+            sum += (intptr_t) batch[j];
+
+        i += batchLength;
+    }
+
+    return (void *) sum;
+
+}
+
+
+
+/** This function will send every item back through the reply mutex queue as soon as it arrives.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *lockedQueueEcho(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        void *item = NULL;
+
+        pthread_mutex_lock(benchArgs->queueLock);
+        if (!queueIsEmpty(benchArgs->queue))
+            item = queueDequeue(benchArgs->queue);
+
+        pthread_mutex_unlock(benchArgs->queueLock);
+
+        if (item != NULL) {
+            pthread_mutex_lock(benchArgs->replyLock);
+            queueEnqueue(benchArgs->replyQueue, item);
+            pthread_mutex_unlock(benchArgs->replyLock);
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will send every item back through the reply spsc queue as soon as it arrives.
+ *
+ * @param args the benchmark arguments pointer
+ * @return it will return NULL
+ */
+
+void *spscQueueEcho(void *args) {
+    BenchmarkArgs *benchArgs = (BenchmarkArgs *) args;
+
+    for (int i = 0; i < benchArgs->itemsNum;) {
+        void *item = spscQueueTryDequeue(benchArgs->spscQueue);
+        if (item != NULL) {
+            while (!spscQueueTryEnqueue(benchArgs->spscReplyQueue, item))
+                sched_yield();
+
+            i++;
+        } else
+            sched_yield();
+
+    }
+
+    return NULL;
+
+}
+
+
+
+/** This function will start the producer and the consumer threads, then it will wait for them and return the elapsed time.
+ *
+ * @param producer the producer function address
+ * @param consumer the consumer function address
+ * @param args the benchmark arguments pointer
+ * @return it will return the elapsed time in seconds
+ */
+
+double runThroughputBenchmark(void *(*producer)(void *), void *(*consumer)(void *), BenchmarkArgs *args) {
+    pthread_t producerThread, consumerThread;
+
+    double start = currentSecondsBench();
+
+    pthread_create(&consumerThread, NULL, consumer, args);
+    pthread_create(&producerThread, NULL, producer, args);
+
+    pthread_join(producerThread, NULL);
+    pthread_join(consumerThread, NULL);
+
+    return currentSecondsBench() - start;
+
+}
+
+
+
+/** This function will bounce one item between the calling thread and the echo thread for the passed number of round trips,
+ * then it will return the average round trip time in nanoseconds.
+ *
+ * @param echo the echo function address
+ * @param args the benchmark arguments pointer, and it's items number is used as the round trips number
+ * @param useSPSC one to use the spsc queues, or zero to use the mutex queues
+ * @return it will return the average round trip time in nanoseconds
+ */
+
+double runLatencyBenchmark(void *(*echo)(void *), BenchmarkArgs *args, int useSPSC) {
+    pthread_t echoThread;
+    pthread_create(&echoThread, NULL, echo, args);
+
+    double start = currentSecondsBench();
+
+    for (int i = 1; i <= args->itemsNum; i++) {
+        void *item = (void *) (intptr_t) i, *reply = NULL;
+
+        if (useSPSC) {
+            spscQueueTryEnqueue(args->spscQueue, item);
+            while ((reply = spscQueueTryDequeue(args->spscReplyQueue)) == NULL)
+                sched_yield();
+
+        } else {
+            pthread_mutex_lock(args->queueLock);
+            queueEnqueue(args->queue, item);
+            pthread_mutex_unlock(args->queueLock);
+
+            while (reply == NULL) {
+                pthread_mutex_lock(args->replyLock);
+                if (!queueIsEmpty(args->replyQueue))
+                    reply = queueDequeue(args->replyQueue);
+
+                pthread_mutex_unlock(args->replyLock);
+
+                if (reply == NULL)
+                    sched_yield();
+
+            }
+        }
+
+    }
+
+    double seconds = currentSecondsBench() - start;
+    pthread_join(echoThread, NULL);
+
+    return seconds / args->itemsNum * 1e9;
+
+}
+
+
+
+int main(int argc, char **argv) {
+    int itemsNum = argc > 1 ? atoi(argv[1]) : 5000000;
+    int capacity = argc > 2 ? atoi(argv[2]) : 1024;
+    int batchLength = argc > 3 ? atoi(argv[3]) : 32;
+    int roundTripsNum = argc > 4 ? atoi(argv[4]) : 100000;
+
+    if (itemsNum <= 0 || capacity <= 0 || batchLength <= 0 || batchLength > BENCHMARK_MAX_BATCH_LENGTH || roundTripsNum <= 0) {
+        fprintf(stderr, "usage: %s [items number] [queue capacity] [batch length (1 - %d)] [round trips number]\n",
+                argv[0], BENCHMARK_MAX_BATCH_LENGTH);
+        return INVALID_ARG;
+    }
+
+    pthread_mutex_t queueLock, replyLock;
+    pthread_mutex_init(&queueLock, NULL);
+    pthread_mutex_init(&replyLock, NULL);
+
+    BenchmarkArgs args;
+    args.queue = queueInitialization(freeNothingBench);
+    args.queueLock = &queueLock;
+    args.spscQueue = spscQueueInitialization(capacity, freeNothingBench);
+    args.replyQueue = queueInitialization(freeNothingBench);
+    args.replyLock = &replyLock;
+    args.spscReplyQueue = spscQueueInitialization(capacity, freeNothingBench);
+    args.itemsNum = itemsNum;
+    args.capacity = capacity;
+    args.batchLength = batchLength;
+
+    double lockedSeconds = runThroughputBenchmark(lockedQueueProducer, lockedQueueConsumer, &args);
+    double spscSeconds = runThroughputBenchmark(spscQueueProducer, spscQueueConsumer, &args);
+    double spscBatchSeconds = runThroughputBenchmark(spscQueueBatchProducer, spscQueueBatchConsumer, &args);
+
+    args.itemsNum = roundTripsNum;
+    double lockedLatency = runLatencyBenchmark(lockedQueueEcho, &args, 0);
+    double spscLatency = runLatencyBenchmark(spscQueueEcho, &args, 1);
+
+    printf("items: %d, capacity: %d, batch length: %d, round trips: %d\n", itemsNum, capacity, batchLength, roundTripsNum);
+    printf("mutex queue:      %.3f s, %.0f items/s, %.0f ns round trip\n", lockedSeconds, itemsNum / lockedSeconds, lockedLatency);
+    printf("spsc queue:       %.3f s, %.0f items/s, %.0f ns round trip\n", spscSeconds, itemsNum / spscSeconds, spscLatency);
+    printf("spsc queue batch: %.3f s, %.0f items/s\n", spscBatchSeconds, itemsNum / spscBatchSeconds);
+
+    queueDestroy(args.queue);
+    queueDestroy(args.replyQueue);
+    destroySPSCQueue(args.spscQueue);
+    destroySPSCQueue(args.spscReplyQueue);
+    pthread_mutex_destroy(&queueLock);
+    pthread_mutex_destroy(&replyLock);
+
+    return 0;
+
+}
@@ -1,6 +1,8 @@
 #ifndef C_DATASTRUCTURES_DLINKEDLISTDEQUE_H
 #define C_DATASTRUCTURES_DLINKEDLISTDEQUE_H
 
+#include "../../LinkedLists/Headers/DoublyLinkedList.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,6 +37,8 @@ void *dLDequePeekRear(DLDeque *deque);
 
 void **dLDequeToArray(DLDeque *deque);
 
+void dLDequeCursorInitialization(DoublyLinkedListCursor *cursor, DLDeque *deque);
+
 int dLDequeGetLength(DLDeque *deque);
 
 int dLDequeIsEmpty(DLDeque *deque);
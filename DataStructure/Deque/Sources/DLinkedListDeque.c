@@ -400,6 +400,41 @@ int dLDequeIsEmpty(DLDeque *deque) {
 
 
 
+/** This function will take the cursor address, and the deque address as a parameters,
+ * then it will initialize the cursor on the front item of the deque,
+ * so the deque items can be walked in both directions without copying them to an array.
+ *
+ * Note: moving the cursor previous from the front item reaches the end position, and one more move reaches the rear item.
+ *
+ * @param cursor the cursor address
+ * @param deque the deque pointer
+ */
+
+void dLDequeCursorInitialization(DoublyLinkedListCursor *cursor, DLDeque *deque) {
+    if (deque == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "deque", "doubly linked list deque data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    doublyLinkedListCursorInitialization(cursor, deque->linkedList);
+
+}
+
+
+
+
+
+
+
+
+
+
 /** This function will clear and free all the deque items,
  * without freeing the deque.
  *
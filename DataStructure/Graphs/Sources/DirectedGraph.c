@@ -1,5 +1,6 @@
 #include "../Headers/DirectedGraph.h"
 #include "../../Lists/Headers/ArrayList.h"
+#include "../../Lists/Headers/SmallVector.h"
 #include "../../Tables/Headers/HashMap.h"
 #include "../../Tables/Headers/HashSet.h"
 #include "../../Stacks/Headers/Stack.h"
@@ -15,14 +16,14 @@
 *  @var DirGraphNode::value
 *  Member 'value' is a pointer to the node value.
 *  @var DirGraphNode::adjacentNodes
-*  Member 'adjacentNodes' is a pointer to the adjacent nodes array list.
+*  Member 'adjacentNodes' is the adjacent nodes small vector, that is embedded in the node so a node with few edges needs no extra allocation.
 *  @var DirGraphNode::valueCompFun
 *  Member 'valueCompFun' is a pointer to the comparator function, that will compare the graph values.
 */
 
 typedef struct DirGraphNode {
     void *value;
-    struct ArrayList *adjacentNodes;
+    SmallVector adjacentNodes;
     int (*valueCompFun)(const void *, const void *);
 } DirGraphNode;
 
@@ -52,15 +53,7 @@ void freeDGraphNode(void *node) {
 
     DirGraphNode *nodeToFree =  (DirGraphNode *) node;
 
-    if (nodeToFree->adjacentNodes != NULL) {
-
-        for (int i = arrayListGetLength(nodeToFree->adjacentNodes) - 1; i >= 0; i--)
-            arrayListRemoveWtFr(nodeToFree->adjacentNodes);
-
-
-        destroyArrayList(nodeToFree->adjacentNodes);
-
-    }
+    clearSmallVectorWtFr(&nodeToFree->adjacentNodes);
 
     free(nodeToFree);
 
@@ -209,7 +202,7 @@ void dirGraphAddNode(DirectedGraph *graph, void *value) {
     DirGraphNode *newNode = (DirGraphNode *) malloc(sizeof(DirGraphNode));
     newNode->value = value;
     newNode->valueCompFun = graph->valueComp;
-    newNode->adjacentNodes = arrayListInitialization(5, freeDGraphNode, dGraphNodeComp);
+    smallVectorEmbeddedInitialization(&newNode->adjacentNodes, freeDGraphNode, dGraphNodeComp);
     hashMapInsert(graph->nodes, value, newNode);
 
 }
@@ -262,9 +255,9 @@ void dirGraphRemoveNode(DirectedGraph *graph, void *value) {
     DirGraphNode **hashMapNodes = (DirGraphNode **) hashMapToArray(graph->nodes);
 
     for (int i = 0; i < hashMapGetLength(graph->nodes); i++) {
-        int index = arrayListGetIndex( hashMapNodes[i]->adjacentNodes, nodeToDelete );
+        int index = smallVectorGetIndex( &hashMapNodes[i]->adjacentNodes, nodeToDelete );
         if (index != -1)
-            arrayListRemoveAtIndexWtFr( hashMapNodes[i]->adjacentNodes, index );
+            smallVectorRemoveAtIndexWtFr( &hashMapNodes[i]->adjacentNodes, index );
 
     }
 
@@ -322,9 +315,9 @@ void *dirGraphRemoveNodeWtoFr(DirectedGraph *graph, void *value) {
     DirGraphNode **hashMapNodes = (DirGraphNode **) hashMapToArray(graph->nodes);
 
     for (int i = 0; i < hashMapGetLength(graph->nodes); i++) {
-        int index = arrayListGetIndex( hashMapNodes[i]->adjacentNodes, nodeToDelete );
+        int index = smallVectorGetIndex( &hashMapNodes[i]->adjacentNodes, nodeToDelete );
         if (index != -1)
-            arrayListRemoveAtIndexWtFr( hashMapNodes[i]->adjacentNodes, index );
+            smallVectorRemoveAtIndexWtFr( &hashMapNodes[i]->adjacentNodes, index );
 
     }
 
@@ -391,8 +384,8 @@ void dirGraphAddEdge(DirectedGraph *graph, void *fromVal, void *toVal) {
         return;
 
 
-    if (!arrayListContains(fromNode->adjacentNodes, toNode))
-        arrayListAdd(fromNode->adjacentNodes, toNode);
+    if (!smallVectorContains(&fromNode->adjacentNodes, toNode))
+        smallVectorAdd(&fromNode->adjacentNodes, toNode);
 
 }
 
@@ -451,9 +444,9 @@ void dirGraphRemoveEdge(DirectedGraph *graph, void *fromVal, void *toVal) {
     if (fromNode == NULL || toNode == NULL)
         return;
 
-    int toNodeIndex = arrayListGetIndex(fromNode->adjacentNodes, toNode);
+    int toNodeIndex = smallVectorGetIndex(&fromNode->adjacentNodes, toNode);
     if (toNodeIndex != -1)
-        arrayListRemoveAtIndexWtFr(fromNode->adjacentNodes, toNodeIndex);
+        smallVectorRemoveAtIndexWtFr(&fromNode->adjacentNodes, toNodeIndex);
 
 }
 
@@ -556,7 +549,7 @@ int dirGraphContainsEdge(DirectedGraph *graph, void *fromVal, void *toVal) {
     if (fromNode == NULL || toNode == NULL)
         return 0;
 
-    return arrayListContains(fromNode->adjacentNodes, toNode);
+    return smallVectorContains(&fromNode->adjacentNodes, toNode);
 
 }
 
@@ -749,9 +742,9 @@ void dirGraphPrint(DirectedGraph *graph, void (*printVal)(void *)) {
                 printf("\nIs connected to:\n");
             #endif
 
-        for (int j = 0; j < arrayListGetLength(arr[i]->adjacentNodes); j++) {
+        for (int j = 0; j < smallVectorGetLength(&arr[i]->adjacentNodes); j++) {
 
-            printVal( ((DirGraphNode *) arrayListGet(arr[i]->adjacentNodes, j))->value );
+            printVal( ((DirGraphNode *) smallVectorGet(&arr[i]->adjacentNodes, j))->value );
 
             #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
             #else
@@ -888,8 +881,8 @@ void dirGraphDepthFirstTraversal(DirectedGraph *graph, void *startVal, void (*pr
         currentNode = stackPop(nodesStack);
         printVal(currentNode->value);
 
-        for (int i = 0; i < arrayListGetLength(currentNode->adjacentNodes); i++) {
-            DirGraphNode *adjNode = (DirGraphNode *) arrayListGet(currentNode->adjacentNodes, i);
+        for (int i = 0; i < smallVectorGetLength(&currentNode->adjacentNodes); i++) {
+            DirGraphNode *adjNode = (DirGraphNode *) smallVectorGet(&currentNode->adjacentNodes, i);
             int *adjNodeValAddress = (int *) malloc(sizeof(int));
             *adjNodeValAddress = (int) adjNode->value;
             if (!hashSetContains(visitedNodes, adjNodeValAddress)) {
@@ -973,8 +966,8 @@ void dirGraphBreadthFirstTraversal(DirectedGraph *graph, void *startVal, void (*
         currentNode = queueDequeue(nodesQueue);
         printVal(currentNode->value);
 
-        for (int i = 0; i < arrayListGetLength(currentNode->adjacentNodes); i++) {
-            DirGraphNode *adjNode = (DirGraphNode *) arrayListGet(currentNode->adjacentNodes, i);
+        for (int i = 0; i < smallVectorGetLength(&currentNode->adjacentNodes); i++) {
+            DirGraphNode *adjNode = (DirGraphNode *) smallVectorGet(&currentNode->adjacentNodes, i);
             int *adjNodeValAddress = (int *) malloc(sizeof(int));
             *adjNodeValAddress = (int) adjNode->value;
             if (!hashSetContains(visitedNodes, adjNodeValAddress)) {
@@ -1067,8 +1060,8 @@ void dirGraphTopologicalSortR(DirGraphNode *node, HashSet *visitedNodes, Stack *
 
     hashSetInsert(visitedNodes, nodeValueAddress);
 
-    for (int i = 0; i < arrayListGetLength(node->adjacentNodes); i++)
-        dirGraphTopologicalSortR(arrayListGet(node->adjacentNodes, i), visitedNodes, sortStack);
+    for (int i = 0; i < smallVectorGetLength(&node->adjacentNodes); i++)
+        dirGraphTopologicalSortR(smallVectorGet(&node->adjacentNodes, i), visitedNodes, sortStack);
 
 
     stackPush(sortStack, node);
@@ -1151,9 +1144,9 @@ int dirGraphNodeIsPartOfCycleR(DirGraphNode *node, HashSet *visitedNodes) {
 
     hashSetInsert(visitedNodes, nodeValueAddress);
 
-    for (int i = 0; i < arrayListGetLength(node->adjacentNodes); i++) {
+    for (int i = 0; i < smallVectorGetLength(&node->adjacentNodes); i++) {
 
-        if (dirGraphNodeIsPartOfCycleR(arrayListGet(node->adjacentNodes, i), visitedNodes))
+        if (dirGraphNodeIsPartOfCycleR(smallVectorGet(&node->adjacentNodes, i), visitedNodes))
             return 1;
 
     }
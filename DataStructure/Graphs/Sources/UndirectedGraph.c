@@ -5,6 +5,7 @@
 #include "../../Queues/Headers/Queue.h"
 #include "../../Queues/Headers/PriorityQueue.h"
 #include "../../Lists/Headers/ArrayList.h"
+#include "../../Lists/Headers/SmallVector.h"
 #include "../../../System/Utils.h"
 #include "../../../Unit Test/CuTest/CuTest.h"
 
@@ -17,7 +18,7 @@
 *  @var UDGraphNode::value
 *  Member 'value' is a pointer to the node value.
 *  @var UDGraphNode::adjacentNodes
-*  Member 'adjacentNodes' is a pointer to the adjacent nodes array list.
+*  Member 'adjacentNodes' is the adjacent nodes small vector, that is embedded in the node so a node with few edges needs no extra allocation.
 * @var UDGraphNode::freeFun
 *  Member 'freeFun' is a pointer to the free function, that will free the graph values.
 *  @var UDGraphNode::compFun
@@ -26,7 +27,7 @@
 
 typedef struct UDGraphNode {
     void *value;
-    ArrayList *adjacentNodes;
+    SmallVector adjacentNodes;
     void (*freeFun)(void *);
     int (*compFun)(const void *, const void*);
 } UDGraphNode;
@@ -88,7 +89,7 @@ int UDGraphNodePartOfCycleR(UDGraphNode *prevNode, UDGraphNode *currentNode, Has
 
 void UDGraphNodeFreeFun(void *node) {
     UDGraphNode *nodeToFree = (UDGraphNode *) node;
-    destroyArrayList(nodeToFree->adjacentNodes);
+    clearSmallVector(&nodeToFree->adjacentNodes);
     free(node);
 }
 
@@ -286,7 +287,7 @@ void udGraphAddNode(UndirectedGraph *graph, void *value) {
     newNode->value = value;
     newNode->freeFun = graph->freeFun;
     newNode->compFun = graph->compFun;
-    newNode->adjacentNodes = arrayListInitialization(5, UDGraphEdgeFreeFun, UDGraphEdgeComp);
+    smallVectorEmbeddedInitialization(&newNode->adjacentNodes, UDGraphEdgeFreeFun, UDGraphEdgeComp);
 
     hashMapInsert(graph->nodes, value, newNode);
 
@@ -376,11 +377,11 @@ void udGraphAddEdge(UndirectedGraph *graph, void *fValue, void *sValue, int edge
     sNewEdge->node = fNode;
     sNewEdge->weight = edgeWeight;
 
-    int fEdgeIndex = arrayListGetIndex(fNode->adjacentNodes, fNewEdge);
-    int sEdgeIndex = arrayListGetIndex(sNode->adjacentNodes, sNewEdge);
+    int fEdgeIndex = smallVectorGetIndex(&fNode->adjacentNodes, fNewEdge);
+    int sEdgeIndex = smallVectorGetIndex(&sNode->adjacentNodes, sNewEdge);
     if (fEdgeIndex >= 0 && sEdgeIndex >= 0) {
-        UDGraphEdge *fTempEdge = arrayListGet(fNode->adjacentNodes, fEdgeIndex);
-        UDGraphEdge *sTempEdge = arrayListGet(sNode->adjacentNodes, sEdgeIndex);
+        UDGraphEdge *fTempEdge = smallVectorGet(&fNode->adjacentNodes, fEdgeIndex);
+        UDGraphEdge *sTempEdge = smallVectorGet(&sNode->adjacentNodes, sEdgeIndex);
         fTempEdge->weight = sTempEdge->weight = edgeWeight;
 
         free(fNewEdge);
@@ -389,8 +390,8 @@ void udGraphAddEdge(UndirectedGraph *graph, void *fValue, void *sValue, int edge
     }
 
 
-    arrayListAdd(fNode->adjacentNodes, fNewEdge);
-    arrayListAdd(sNode->adjacentNodes, sNewEdge);
+    smallVectorAdd(&fNode->adjacentNodes, fNewEdge);
+    smallVectorAdd(&sNode->adjacentNodes, sNewEdge);
 
 }
 
@@ -439,9 +440,9 @@ void udGraphRemoveNode(UndirectedGraph *graph, void *value) {
     UDGraphEdge *tempNodeEdge = (UDGraphEdge *) malloc(sizeof(UDGraphEdge));
     tempNodeEdge->node = node;
 
-    for (int i = 0; i < arrayListGetLength(node->adjacentNodes); i++) {
-        UDGraphEdge *tempEdge = (UDGraphEdge *) arrayListGet(node->adjacentNodes, i);
-        arrayListRemoveAtIndex(tempEdge->node->adjacentNodes, arrayListGetIndex(tempEdge->node->adjacentNodes, tempNodeEdge));
+    for (int i = 0; i < smallVectorGetLength(&node->adjacentNodes); i++) {
+        UDGraphEdge *tempEdge = (UDGraphEdge *) smallVectorGet(&node->adjacentNodes, i);
+        smallVectorRemoveAtIndex(&tempEdge->node->adjacentNodes, smallVectorGetIndex(&tempEdge->node->adjacentNodes, tempNodeEdge));
 
     }
 
@@ -497,9 +498,9 @@ void *udGraphRemoveNodeWtoFr(UndirectedGraph *graph, void *value) {
     UDGraphEdge *tempNodeEdge = (UDGraphEdge *) malloc(sizeof(UDGraphEdge));
     tempNodeEdge->node = node;
 
-    for (int i = 0; i < arrayListGetLength(node->adjacentNodes); i++) {
-        UDGraphEdge *tempEdge = (UDGraphEdge *) arrayListGet(node->adjacentNodes, i);
-        arrayListRemoveAtIndex(tempEdge->node->adjacentNodes, arrayListGetIndex(tempEdge->node->adjacentNodes, tempNodeEdge));
+    for (int i = 0; i < smallVectorGetLength(&node->adjacentNodes); i++) {
+        UDGraphEdge *tempEdge = (UDGraphEdge *) smallVectorGet(&node->adjacentNodes, i);
+        smallVectorRemoveAtIndex(&tempEdge->node->adjacentNodes, smallVectorGetIndex(&tempEdge->node->adjacentNodes, tempNodeEdge));
 
     }
 
@@ -574,11 +575,11 @@ void udGraphRemoveEdge(UndirectedGraph *graph, void *fValue, void *sValue) {
     fNewEdge->node = sNode;
     sNewEdge->node = fNode;
 
-    int fEdgeIndex = arrayListGetIndex(fNode->adjacentNodes, fNewEdge);
-    int sEdgeIndex = arrayListGetIndex(sNode->adjacentNodes, sNewEdge);
+    int fEdgeIndex = smallVectorGetIndex(&fNode->adjacentNodes, fNewEdge);
+    int sEdgeIndex = smallVectorGetIndex(&sNode->adjacentNodes, sNewEdge);
     if (fEdgeIndex >= 0 && sEdgeIndex >= 0) {
-        arrayListRemoveAtIndex(fNode->adjacentNodes, fEdgeIndex);
-        arrayListRemoveAtIndex(sNode->adjacentNodes, sEdgeIndex);
+        smallVectorRemoveAtIndex(&fNode->adjacentNodes, fEdgeIndex);
+        smallVectorRemoveAtIndex(&sNode->adjacentNodes, sEdgeIndex);
     }
 
     free(fNewEdge);
@@ -700,8 +701,8 @@ int udGraphContainsEdge(UndirectedGraph *graph, void *fValue, void *sValue) {
     fNewEdge->node = fNode;
     sNewEdge->node = sNode;
 
-    int fEdgeIndex = arrayListGetIndex(fNode->adjacentNodes, sNewEdge);
-    int sEdgeIndex = arrayListGetIndex(sNode->adjacentNodes, fNewEdge);
+    int fEdgeIndex = smallVectorGetIndex(&fNode->adjacentNodes, sNewEdge);
+    int sEdgeIndex = smallVectorGetIndex(&sNode->adjacentNodes, fNewEdge);
 
     free(fNewEdge);
     free(sNewEdge);
@@ -765,7 +766,7 @@ int udGraphGetEdgeWeight(UndirectedGraph *graph, void *fValue, void *sValue) {
 
     UDGraphEdge *tempEdge = (UDGraphEdge *) malloc(sizeof(UDGraphEdge));
     tempEdge->node = sNode;
-    UDGraphEdge *targetEdge = (UDGraphEdge *) arrayListGet(fNode->adjacentNodes, arrayListGetIndex(fNode->adjacentNodes, tempEdge));
+    UDGraphEdge *targetEdge = (UDGraphEdge *) smallVectorGet(&fNode->adjacentNodes, smallVectorGetIndex(&fNode->adjacentNodes, tempEdge));
 
     UDGraphEdgeFreeFun(tempEdge);
 
@@ -837,9 +838,9 @@ void printUDGraph(UndirectedGraph *graph, void (*printFun)(void *)) {
                 printf("\nIs connected to:\n");
             #endif
 
-        for (int j = 0; j < arrayListGetLength(nodesArray[i]->adjacentNodes); j++) {
+        for (int j = 0; j < smallVectorGetLength(&nodesArray[i]->adjacentNodes); j++) {
 
-            UDGraphEdge *tempEdge = (UDGraphEdge *)arrayListGet(nodesArray[i]->adjacentNodes, j);
+            UDGraphEdge *tempEdge = (UDGraphEdge *)smallVectorGet(&nodesArray[i]->adjacentNodes, j);
             printFun(tempEdge->node->value);
 
             #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
@@ -1096,8 +1097,8 @@ void UDGraphDepthFirstTraversal(UndirectedGraph *graph, void *startVal, void (*p
         UDGraphNode *tempNode = stackPop(nodesStack);
         printFun(tempNode->value);
 
-        for (int i = 0; i < arrayListGetLength(tempNode->adjacentNodes); i++) {
-            UDGraphNode *adjNode = ((UDGraphEdge *) arrayListGet(tempNode->adjacentNodes, i))->node;
+        for (int i = 0; i < smallVectorGetLength(&tempNode->adjacentNodes); i++) {
+            UDGraphNode *adjNode = ((UDGraphEdge *) smallVectorGet(&tempNode->adjacentNodes, i))->node;
             int *adjNodeValAddress = (int *) malloc(sizeof(int));
             *adjNodeValAddress = (int) adjNode->value;
             if (!hashSetContains(visitedNodes, adjNodeValAddress)) {
@@ -1179,8 +1180,8 @@ void UDGraphBreadthFirstTraversal(UndirectedGraph *graph, void *startVal, void (
         UDGraphNode *tempNode = queueDequeue(nodesQueue);
         printFun(tempNode->value);
 
-        for (int i = 0; i < arrayListGetLength(tempNode->adjacentNodes); i++) {
-            UDGraphNode *adjNode = ((UDGraphEdge *) arrayListGet(tempNode->adjacentNodes, i))->node;
+        for (int i = 0; i < smallVectorGetLength(&tempNode->adjacentNodes); i++) {
+            UDGraphNode *adjNode = ((UDGraphEdge *) smallVectorGet(&tempNode->adjacentNodes, i))->node;
             int *adjNodeValAddress = (int *) malloc(sizeof(int));
             *adjNodeValAddress = (int) adjNode->value;
             if (!hashSetContains(visitedNodes, adjNodeValAddress)) {
@@ -1575,8 +1576,8 @@ HashMap *UDGraphGenerateDistancesMap(UDGraphNode *startNode) {
         UDGraphNode *currentNode = currentHolder->toNode;
         hashSetInsert(visitedNodes, generateNodeValAddress(currentNode));
 
-        for (int i = 0; i < arrayListGetLength(currentNode->adjacentNodes); i++) {
-            UDGraphEdge *edge = (UDGraphEdge *) arrayListGet(currentNode->adjacentNodes, i);
+        for (int i = 0; i < smallVectorGetLength(&currentNode->adjacentNodes); i++) {
+            UDGraphEdge *edge = (UDGraphEdge *) smallVectorGet(&currentNode->adjacentNodes, i);
             int *childNodeValAddress = generateNodeValAddress(edge->node);
 
             if (!hashSetContains(visitedNodes, childNodeValAddress)) {
@@ -1754,8 +1755,8 @@ int UDGraphNodePartOfCycleR(UDGraphNode *prevNode, UDGraphNode *currentNode, Has
 
     hashSetInsert(visitedNodes, currentNodeValAddress);
 
-    for (int i = 0; i < arrayListGetLength(currentNode->adjacentNodes); i++) {
-        UDGraphEdge *edge = (UDGraphEdge *) arrayListGet(currentNode->adjacentNodes, i);
+    for (int i = 0; i < smallVectorGetLength(&currentNode->adjacentNodes); i++) {
+        UDGraphEdge *edge = (UDGraphEdge *) smallVectorGet(&currentNode->adjacentNodes, i);
         if (edge->node == prevNode)
             continue;
 
@@ -1832,8 +1833,8 @@ UndirectedGraph *udGraphMinimumSpanningGraph(UndirectedGraph *graph, void *start
 
     PriorityQueue *disHolderPQueue = priorityQueueInitialization(distanceHolderFreeFun, distanceHolderComp);
 
-    for (int i = 0; i < arrayListGetLength(startNode->adjacentNodes); i++) {
-        UDGraphEdge *edge = (UDGraphEdge *) arrayListGet(startNode->adjacentNodes, i);
+    for (int i = 0; i < smallVectorGetLength(&startNode->adjacentNodes); i++) {
+        UDGraphEdge *edge = (UDGraphEdge *) smallVectorGet(&startNode->adjacentNodes, i);
         DistanceHolder *holder = generateDisHolder(startNode, edge->node, edge->weight);
         pQueueEnqueue(disHolderPQueue, holder);
     }
@@ -1852,8 +1853,8 @@ UndirectedGraph *udGraphMinimumSpanningGraph(UndirectedGraph *graph, void *start
 
         udGraphAddEdge(newGraph, currentHolder->fromNode->value, currentHolder->toNode->value, currentHolder->distance);
 
-        for (int i = 0; i < arrayListGetLength(currentHolder->toNode->adjacentNodes); i++) {
-            UDGraphEdge *edge = (UDGraphEdge *) arrayListGet(currentHolder->toNode->adjacentNodes, i);
+        for (int i = 0; i < smallVectorGetLength(&currentHolder->toNode->adjacentNodes); i++) {
+            UDGraphEdge *edge = (UDGraphEdge *) smallVectorGet(&currentHolder->toNode->adjacentNodes, i);
 
             if (!udGraphContainsNode(newGraph, edge->node->value)) {
                 DistanceHolder *holder = generateDisHolder(currentHolder->toNode, edge->node, edge->weight);
@@ -1,6 +1,8 @@
 #ifndef C_DATASTRUCTURES_DOUBLYLINKEDLIST_H
 #define C_DATASTRUCTURES_DOUBLYLINKEDLIST_H
 
+#include "NodePool.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,6 +18,10 @@ extern "C" {
 *  Member 'length' holds the number of the nodes.
 *  @var DoublyLinkedList::freeFun
 *  Member 'freeFun' the freeing item function pointer
+*  @var DoublyLinkedList::nodePool
+*  Member 'nodePool' is a pointer to the node pool that the nodes are allocated from.
+*  @var DoublyLinkedList::sharedNodePool
+*  Member 'sharedNodePool' holds one if the node pool is shared with other lists, other wise it holds zero.
 * @var DoublyLinkedList::comparator
 * Member 'comparator' the items comparator function pointer
 */
@@ -26,11 +32,32 @@ typedef struct DoublyLinkedList {
     int length;
     void (*freeFun)(void *);
     int (*comparator)(const void *, const void *);
+    NodePool *nodePool;
+    int sharedNodePool;
 } DoublyLinkedList;
 
 
+/** @struct DoublyLinkedListCursor
+*  @brief This structure points to a position in a doubly linked list,
+*  so the list can be walked in both directions, and changed at that position, without searching for it from the head every time.
+*  @var DoublyLinkedListCursor::linkedList
+*  Member 'linkedList' is a pointer to the linked list that the cursor walks.
+*  @var DoublyLinkedListCursor::currentNode
+*  Member 'currentNode' is a pointer to the current node, or NULL if the cursor is at the end of the list.
+*/
+
+typedef struct DoublyLinkedListCursor {
+    DoublyLinkedList *linkedList;
+    struct Node *currentNode;
+} DoublyLinkedListCursor;
+
+
 DoublyLinkedList *doublyLinkedListInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *));
 
+DoublyLinkedList *doublyLinkedListSharedPoolInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *), NodePool *nodePool);
+
+NodePool *doublyLinkedListNodePoolInitialization();
+
 void doublyLinkedListAddFirst(DoublyLinkedList *linkedList, void *item);
 
 void doublyLinkedListAddLast(DoublyLinkedList *linkedList, void *item);
@@ -63,6 +90,8 @@ void *doublyLinkedListGetLast(DoublyLinkedList *linkedList);
 
 void **doublyLinkedListToArray(DoublyLinkedList *linkedList);
 
+void doublyLinkedListSort(DoublyLinkedList *linkedList, int (*sortComp)(const void *, const void *));
+
 void *doublyLinkedListGet(DoublyLinkedList *linkedList, int index);
 
 int doublyLinkedListGetLength(DoublyLinkedList *linkedList);
@@ -75,6 +104,22 @@ void doublyLinkedListClear(DoublyLinkedList *linkedList);
 
 void destroyDoublyLinkedList(DoublyLinkedList *linkedList);
 
+void doublyLinkedListCursorInitialization(DoublyLinkedListCursor *cursor, DoublyLinkedList *linkedList);
+
+void doublyLinkedListCursorNext(DoublyLinkedListCursor *cursor);
+
+void doublyLinkedListCursorPrev(DoublyLinkedListCursor *cursor);
+
+void *doublyLinkedListCursorGet(DoublyLinkedListCursor *cursor);
+
+void doublyLinkedListCursorInsertBefore(DoublyLinkedListCursor *cursor, void *item);
+
+void doublyLinkedListCursorInsertAfter(DoublyLinkedListCursor *cursor, void *item);
+
+void doublyLinkedListCursorRemove(DoublyLinkedListCursor *cursor);
+
+void *doublyLinkedListCursorRemoveWtoFr(DoublyLinkedListCursor *cursor);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,8 @@
 #ifndef C_DATASTRUCTURES_LINKEDLIST_H
 #define C_DATASTRUCTURES_LINKEDLIST_H
 
+#include "NodePool.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,6 +17,10 @@ extern "C" {
 *  Member 'length' holds the number of the nodes.
 *  @var LinkedList::freeFun
 *  Member 'freeFun' the freeing item function pointer
+*  @var LinkedList::nodePool
+*  Member 'nodePool' is a pointer to the node pool that the nodes are allocated from.
+*  @var LinkedList::sharedNodePool
+*  Member 'sharedNodePool' holds one if the node pool is shared with other lists, other wise it holds zero.
 * @var LinkedList::comparator
 * Member 'comparator' the items comparator function pointer
 */
@@ -25,11 +31,35 @@ typedef struct LinkedList {
     int length;
     void (*freeFun)(void *);
     int (*comparator)(const void *, const void *);
+    NodePool *nodePool;
+    int sharedNodePool;
 } LinkedList;
 
 
+/** @struct LinkedListCursor
+*  @brief This structure points to a position in a linked list,
+*  so the list can be walked, and changed at that position, without searching for it from the head every time.
+*  @var LinkedListCursor::linkedList
+*  Member 'linkedList' is a pointer to the linked list that the cursor walks.
+*  @var LinkedListCursor::prevNode
+*  Member 'prevNode' is a pointer to the node before the current node, or NULL if the current node is the head.
+*  @var LinkedListCursor::currentNode
+*  Member 'currentNode' is a pointer to the current node, or NULL if the cursor is at the end of the list.
+*/
+
+typedef struct LinkedListCursor {
+    LinkedList *linkedList;
+    struct Node *prevNode;
+    struct Node *currentNode;
+} LinkedListCursor;
+
+
 LinkedList *linkedListInitialization(void (*freeFun)(void *),  int (*comparator)(const void *, const void *));
 
+LinkedList *linkedListSharedPoolInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *), NodePool *nodePool);
+
+NodePool *linkedListNodePoolInitialization();
+
 void linkedListAddFirst(LinkedList *linkedList, void *item);
 
 void linkedListAddLast(LinkedList *linkedList, void *item);
@@ -62,6 +92,8 @@ void *linkedListGetLast(LinkedList *linkedList);
 
 void **linkedListToArray(LinkedList *linkedList);
 
+void linkedListSort(LinkedList *linkedList, int (*sortComp)(const void *, const void *));
+
 void *linkedListGet(LinkedList *linkedList, int index);
 
 int linkedListGetLength(LinkedList *linkedList);
@@ -74,6 +106,20 @@ void linkedListClear(LinkedList *linkedList);
 
 void destroyLinkedList(LinkedList *linkedList);
 
+void linkedListCursorInitialization(LinkedListCursor *cursor, LinkedList *linkedList);
+
+void linkedListCursorNext(LinkedListCursor *cursor);
+
+void *linkedListCursorGet(LinkedListCursor *cursor);
+
+void linkedListCursorInsertBefore(LinkedListCursor *cursor, void *item);
+
+void linkedListCursorInsertAfter(LinkedListCursor *cursor, void *item);
+
+void linkedListCursorRemove(LinkedListCursor *cursor);
+
+void *linkedListCursorRemoveWtoFr(LinkedListCursor *cursor);
+
 #ifdef __cplusplus
 }
 #endif
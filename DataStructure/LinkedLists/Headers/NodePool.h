@@ -0,0 +1,61 @@
+#ifndef C_DATASTRUCTURES_NODEPOOL_H
+#define C_DATASTRUCTURES_NODEPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The number of nodes in the first slab of the pool.
+#define NODE_POOL_FIRST_SLAB_LENGTH 8
+
+/// The maximum number of nodes in one slab, and every new slab is double the previous one until it reaches this length.
+#define NODE_POOL_MAX_SLAB_LENGTH 1024
+
+
+/** @struct NodePool
+*  @brief This structure implements a slab allocator for fixed size nodes,
+*  that carves the nodes out of big memory blocks (slabs), and recycles the freed nodes through a free list.
+*  @var NodePool::slabs
+*  Member 'slabs' is a pointer to the last allocated slab, and every slab starts with a pointer to the previous slab.
+*  @var NodePool::freeNodes
+*  Member 'freeNodes' is a pointer to the first freed node, and every freed node starts with a pointer to the next freed node.
+*  @var NodePool::nextNode
+*  Member 'nextNode' is a pointer to the first node in the last slab that was never allocated.
+*  @var NodePool::slabEnd
+*  Member 'slabEnd' is a pointer to the end of the last slab.
+*  @var NodePool::nodeSize
+*  Member 'nodeSize' holds the size of one node in bytes, after aligning it to the pointer size.
+*  @var NodePool::nextSlabLength
+*  Member 'nextSlabLength' holds the number of nodes in the next slab.
+*  @var NodePool::usedCount
+*  Member 'usedCount' holds the number of the allocated nodes that are not freed.
+*/
+
+typedef struct NodePool {
+    void *slabs;
+    void *freeNodes;
+    char *nextNode;
+    char *slabEnd;
+    int nodeSize;
+    int nextSlabLength;
+    int usedCount;
+} NodePool;
+
+NodePool *nodePoolInitialization(int nodeSize);
+
+void *nodePoolAllocate(NodePool *pool);
+
+void nodePoolFree(NodePool *pool, void *node);
+
+int nodePoolGetUsedCount(NodePool *pool);
+
+void nodePoolReset(NodePool *pool);
+
+void destroyNodePool(NodePool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_NODEPOOL_H
@@ -0,0 +1,83 @@
+#ifndef C_DATASTRUCTURES_SKIPLIST_H
+#define C_DATASTRUCTURES_SKIPLIST_H
+
+#include "NodePool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The maximum number of levels in the skip list, and every level holds about a quarter of the level below it.
+#define SKIP_LIST_MAX_LEVEL 32
+
+
+/** @struct SkipList
+*  @brief This structure implements a generic ordered skip list, where every link holds the number of items that it jumps over (span),
+*  so the search, the rank of an item, and the item at an index are all found in logarithmic time.
+*  @var SkipList::head
+*  Member 'head' is a pointer to the head node, that holds (SKIP_LIST_MAX_LEVEL) links and no item.
+*  @var SkipList::level
+*  Member 'level' holds the number of the used levels.
+*  @var SkipList::count
+*  Member 'count' holds the number of items in the list.
+*  @var SkipList::randomState
+*  Member 'randomState' holds the state of the random generator that chooses the new nodes levels.
+*  @var SkipList::levelPools
+*  Member 'levelPools' is an array of the node pools that the nodes of every level are allocated from.
+*  @var SkipList::freeFn
+*  Member 'freeFn' is a pointer to the free function that is going to be used throughout the list.
+*  @var SkipList::cmp
+*  Member 'cmp' is a pointer to the comparison function that is going to be used to order the list items.
+*/
+
+typedef struct SkipList {
+    struct SkipListNode *head;
+    int level;
+    int count;
+    unsigned int randomState;
+    NodePool *levelPools[SKIP_LIST_MAX_LEVEL];
+    void (*freeFn)(void *);
+    int (*cmp)(const void *, const void *);
+} SkipList;
+
+
+SkipList *skipListInitialization(void (*freeFn)(void *), int (*cmp)(const void *, const void *));
+
+void skipListInsert(SkipList *list, void *item);
+
+void skipListInsertAll(SkipList *list, void **items, int length);
+
+void skipListDelete(SkipList *list, void *item);
+
+void *skipListDeleteWtoFr(SkipList *list, void *item);
+
+void skipListDeleteAtIndex(SkipList *list, int index);
+
+void *skipListDeleteAtIndexWtoFr(SkipList *list, int index);
+
+int skipListContains(SkipList *list, void *item);
+
+void *skipListGet(SkipList *list, void *item);
+
+int skipListGetIndex(SkipList *list, void *item);
+
+void *skipListGetAtIndex(SkipList *list, int index);
+
+void skipListForEachInRange(SkipList *list, void *fromItem, void *toItem, void (*action)(void *));
+
+int skipListGetSize(SkipList *list);
+
+int skipListIsEmpty(SkipList *list);
+
+void **skipListToArray(SkipList *list);
+
+void clearSkipList(SkipList *list);
+
+void destroySkipList(SkipList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_SKIPLIST_H
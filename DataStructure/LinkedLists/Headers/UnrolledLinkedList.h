@@ -0,0 +1,96 @@
+#ifndef C_DATASTRUCTURES_UNROLLEDLINKEDLIST_H
+#define C_DATASTRUCTURES_UNROLLEDLINKEDLIST_H
+
+#include "NodePool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The number of items that one node can hold, so the node with it's next pointer and items count fills a 64 bytes cache line.
+#define UNROLLED_LINKED_LIST_NODE_CAPACITY ((int) ((64 - 2 * sizeof(void *)) / sizeof(void *)))
+
+
+/** @struct UnrolledLinkedList
+*  @brief This structure implements a generic unrolled linked list,
+*  that stores up to (UNROLLED_LINKED_LIST_NODE_CAPACITY) items in every node,
+*  so the traversals jump between nodes once every many items instead of once every item.
+*  @var UnrolledLinkedList::head
+*  Member 'head' is a pointer to the first node.
+*  @var UnrolledLinkedList::tail
+*  Member 'tail' is a pointer to the last node.
+*  @var UnrolledLinkedList::length
+*  Member 'length' holds the number of items in the list.
+*  @var UnrolledLinkedList::nodesCount
+*  Member 'nodesCount' holds the number of nodes in the list.
+*  @var UnrolledLinkedList::freeFun
+*  Member 'freeFun' the freeing item function pointer
+*  @var UnrolledLinkedList::comparator
+*  Member 'comparator' the items comparator function pointer
+*  @var UnrolledLinkedList::nodePool
+*  Member 'nodePool' is a pointer to the node pool that the nodes are allocated from.
+*/
+
+typedef struct UnrolledLinkedList {
+    struct UnrolledNode *head;
+    struct UnrolledNode *tail;
+    int length;
+    int nodesCount;
+    void (*freeFun)(void *);
+    int (*comparator)(const void *, const void *);
+    NodePool *nodePool;
+} UnrolledLinkedList;
+
+
+UnrolledLinkedList *unrolledLinkedListInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *));
+
+void unrolledLinkedListAddFirst(UnrolledLinkedList *list, void *item);
+
+void unrolledLinkedListAddLast(UnrolledLinkedList *list, void *item);
+
+void unrolledLinkedListAddAtIndex(UnrolledLinkedList *list, int index, void *item);
+
+void unrolledLinkedListAddAll(UnrolledLinkedList *list, void **items, int itemsLength);
+
+void unrolledLinkedListDeleteFirst(UnrolledLinkedList *list);
+
+void *unrolledLinkedListDeleteFirstWtoFr(UnrolledLinkedList *list);
+
+void unrolledLinkedListDeleteLast(UnrolledLinkedList *list);
+
+void *unrolledLinkedListDeleteLastWtoFr(UnrolledLinkedList *list);
+
+void unrolledLinkedListDeleteAtIndex(UnrolledLinkedList *list, int index);
+
+void *unrolledLinkedListDeleteAtIndexWtoFr(UnrolledLinkedList *list, int index);
+
+int unrolledLinkedListContains(UnrolledLinkedList *list, void *item);
+
+int unrolledLinkedListGetIndex(UnrolledLinkedList *list, void *item);
+
+void *unrolledLinkedListGetItem(UnrolledLinkedList *list, void *item);
+
+void *unrolledLinkedListGetFirst(UnrolledLinkedList *list);
+
+void *unrolledLinkedListGetLast(UnrolledLinkedList *list);
+
+void **unrolledLinkedListToArray(UnrolledLinkedList *list);
+
+void *unrolledLinkedListGet(UnrolledLinkedList *list, int index);
+
+int unrolledLinkedListGetLength(UnrolledLinkedList *list);
+
+int unrolledLinkedListIsEmpty(UnrolledLinkedList *list);
+
+void printUnrolledLinkedList(UnrolledLinkedList *list, void (*printFun)(const void *));
+
+void unrolledLinkedListClear(UnrolledLinkedList *list);
+
+void destroyUnrolledLinkedList(UnrolledLinkedList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_UNROLLEDLINKEDLIST_H
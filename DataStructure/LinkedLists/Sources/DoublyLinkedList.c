@@ -11,11 +11,19 @@ typedef struct Node {
 
 
 
+Node *doublyLinkedListSortSplit(Node *start, int length);
+
+Node *doublyLinkedListSortMerge(Node *left, Node *right, Node *tail, int (*sortComp)(const void *, const void *));
+
+
+
 
 
 
 
 /** This function will allocate a new linked list in the memory, setup it's fields and return it.
+ *
+ * Note: the list nodes will be allocated from a private node pool, that will be released at once by the clear and destroy functions.
  *
  * @param freeFun the free function address that will be called to free the linked list items
  * @param comparator the comparator function address, that will be called to compare two items
@@ -33,6 +41,59 @@ DoublyLinkedList *doublyLinkedListInitialization(void (*freeFun)(void *), int (*
 
     }
 
+    NodePool *nodePool = doublyLinkedListNodePoolInitialization();
+    if (nodePool == NULL)
+        return NULL;
+
+    DoublyLinkedList *linkedList = doublyLinkedListSharedPoolInitialization(freeFun, comparator, nodePool);
+    if (linkedList == NULL) {
+        destroyNodePool(nodePool);
+        return NULL;
+    }
+
+    linkedList->sharedNodePool = 0;
+
+    return linkedList;
+}
+
+
+
+
+/** This function will take the freeing and comparator functions, and a node pool address as a parameters,
+ * then it will allocate a new doubly linked list that allocates it's nodes from the passed pool, setup it's fields and return it.
+ *
+ * Note: the pool can be shared by many lists, so it will not be released by the list,
+ * and it should be destroyed after destroying all the lists that use it.
+ *
+ * Note: the pool should be created using the doublyLinkedListNodePoolInitialization function.
+ *
+ * @param freeFun the free function address that will be called to free the linked list items
+ * @param comparator the comparator function address, that will be called to compare two items
+ * @param nodePool the node pool address
+ * @return it will return the initialized linked list pointer
+ */
+
+DoublyLinkedList *doublyLinkedListSharedPoolInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *), NodePool *nodePool) {
+    if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+     		fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "doubly linked list data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (nodePool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+     		fprintf(stderr, INVALID_ARG_MESSAGE, "node pool pointer", "doubly linked list data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    }
+
     DoublyLinkedList *linkedList = (DoublyLinkedList *) malloc(sizeof(DoublyLinkedList));
     if (linkedList == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
@@ -49,6 +110,8 @@ DoublyLinkedList *doublyLinkedListInitialization(void (*freeFun)(void *), int (*
     linkedList->length = 0;
     linkedList->freeFun = freeFun;
     linkedList->comparator = comparator;
+    linkedList->nodePool = nodePool;
+    linkedList->sharedNodePool = 1;
 
     return linkedList;
 }
@@ -57,6 +120,22 @@ DoublyLinkedList *doublyLinkedListInitialization(void (*freeFun)(void *), int (*
 
 
 
+/** This function will initialize a new node pool, that allocates nodes with the doubly linked list node size, and return it.
+ *
+ * Note: the pool can be passed to the doublyLinkedListSharedPoolInitialization function, so many lists can share it.
+ *
+ * @return it will return the initialized node pool pointer
+ */
+
+NodePool *doublyLinkedListNodePoolInitialization() {
+    return nodePoolInitialization(sizeof(Node));
+}
+
+
+
+
+
+
 
 
 
@@ -89,7 +168,7 @@ void doublyLinkedListAddFirst(DoublyLinkedList *linkedList, void *item) {
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -153,7 +232,7 @@ void doublyLinkedListAddLast(DoublyLinkedList *linkedList, void *item) {
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -225,7 +304,7 @@ void doublyLinkedListAddAtIndex(DoublyLinkedList *linkedList, int index, void *i
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -350,7 +429,7 @@ void doublyLinkedListDeleteFirst(DoublyLinkedList *linkedList) {
 
     linkedList->length--;
     linkedList->freeFun(nodeToFree->item);
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
 }
 
@@ -402,7 +481,7 @@ void *doublyLinkedListDeleteFirstWtoFr(DoublyLinkedList *linkedList) {
 
     linkedList->length--;
     void *returnItem = nodeToFree->item;
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
     return returnItem;
 
@@ -454,7 +533,7 @@ void doublyLinkedListDeleteLast(DoublyLinkedList *linkedList) {
 
     linkedList->length--;
     linkedList->freeFun(nodeToFree->item);
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
 }
 
@@ -505,7 +584,7 @@ void *doublyLinkedListDeleteLastWtoFr(DoublyLinkedList *linkedList) {
 
     linkedList->length--;
     void *returnItem = nodeToFree->item;
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
     return returnItem;
 }
@@ -571,7 +650,7 @@ void doublyLinkedListDeleteAtIndex(DoublyLinkedList *linkedList, int index) {
 
         linkedList->length--;
         linkedList->freeFun(currentNode->item);
-        free(currentNode);
+        nodePoolFree(linkedList->nodePool, currentNode);
     }
 
 }
@@ -638,7 +717,7 @@ void *doublyLinkedListDeleteAtIndexWtoFr(DoublyLinkedList *linkedList, int index
 
         linkedList->length--;
         void *returnItem = currentNode->item;
-        free(currentNode);
+        nodePoolFree(linkedList->nodePool, currentNode);
 
         return returnItem;
 
@@ -1039,6 +1118,72 @@ void **doublyLinkedListToArray(DoublyLinkedList *linkedList) {
 
 
 
+/** This function will take the linked list address, and the sort comparator function as a parameters,
+ * then it will sort the linked list items using a bottom up merge sort, that only changes the nodes links.
+ *
+ * Note: the items will be sent directly to the sort comparator function, like the linked list comparator function.
+ *
+ * Note: the sort is stable, so the equal items keep their order, and it doesn't allocate any memory.
+ *
+ * @param linkedList the linked list address
+ * @param sortComp the sorting comparator function address
+ */
+
+void doublyLinkedListSort(DoublyLinkedList *linkedList, int (*sortComp)(const void *, const void *)) {
+    if (linkedList == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "linked list pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (sortComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "sort comparator function", "doubly linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    Node dummy;
+    dummy.next = linkedList->head;
+
+    // every pass merges the sorted runs of (width) nodes in pairs, so the runs length is doubled.
+    for (int width = 1; width < linkedList->length; width *= 2) {
+        Node *remaining = dummy.next;
+        Node *mergedTail = &dummy;
+
+        while (remaining != NULL) {
+            Node *left = remaining;
+            Node *right = doublyLinkedListSortSplit(left, width);
+            remaining = doublyLinkedListSortSplit(right, width);
+
+            mergedTail = doublyLinkedListSortMerge(left, right, mergedTail, sortComp);
+        }
+
+        linkedList->tail = mergedTail;
+    }
+
+    linkedList->head = dummy.next;
+
+    // the sort only changes the next links, so the previous links are rebuilt in one pass.
+    Node *prevNode = NULL;
+    for (Node *currentNode = linkedList->head; currentNode != NULL; currentNode = currentNode->next) {
+        currentNode->prevNode = prevNode;
+        prevNode = currentNode;
+    }
+
+}
+
+
+
+
+
 /** This function will take the linked list address as a parameter,
  * the it will return the number of items in the linked list.
  *
@@ -1150,6 +1295,8 @@ void printDoublyLinkedList(DoublyLinkedList *linkedList, void (*printFun) (const
 /** This function will take the linked list address as a parameter,
  * then it will delete and free all the items from the linked list.
  *
+ * Note: if the node pool isn't shared, then it's slabs will be released at once instead of freeing the nodes one by one.
+ *
  * @param linkedList the linked list address
  */
 
@@ -1174,9 +1321,13 @@ void doublyLinkedListClear(DoublyLinkedList *linkedList) {
         currentNode = currentNode->next;
 
         linkedList->freeFun(nodeToFree->item);
-        free(nodeToFree);
+        if (linkedList->sharedNodePool)
+            nodePoolFree(linkedList->nodePool, nodeToFree);
     }
 
+    if (!linkedList->sharedNodePool)
+        nodePoolReset(linkedList->nodePool);
+
     linkedList->head = linkedList->tail = NULL;
     linkedList->length = 0;
 }
@@ -1210,6 +1361,420 @@ void destroyDoublyLinkedList(DoublyLinkedList *linkedList) {
     }
 
     doublyLinkedListClear(linkedList);
+    if (!linkedList->sharedNodePool)
+        destroyNodePool(linkedList->nodePool);
+
     free(linkedList);
 
-}
\ No newline at end of file
+}
+
+
+
+/** This function will take the cursor address, and the linked list address as a parameters,
+ * then it will initialize the cursor on the first item of the linked list.
+ *
+ * Note: the cursor can be embedded in another structure or declared on the stack, because it doesn't allocate any memory.
+ *
+ * Note: the end of the list is a position between the last and the first items,
+ * so moving next from the end reaches the first item, and moving previous from the end reaches the last item.
+ *
+ * Note: changing the linked list without the cursor functions may make the cursor invalid,
+ * except adding items, or deleting items that the cursor doesn't point to.
+ *
+ * @param cursor the cursor address
+ * @param linkedList the linked list address
+ */
+
+void doublyLinkedListCursorInitialization(DoublyLinkedListCursor *cursor, DoublyLinkedList *linkedList) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (linkedList == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "linked list pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cursor->linkedList = linkedList;
+    cursor->currentNode = linkedList->head;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will move the cursor to the next item.
+ *
+ * @param cursor the cursor address
+ */
+
+void doublyLinkedListCursorNext(DoublyLinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cursor->currentNode = cursor->currentNode == NULL ? cursor->linkedList->head : cursor->currentNode->next;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will move the cursor to the previous item.
+ *
+ * @param cursor the cursor address
+ */
+
+void doublyLinkedListCursorPrev(DoublyLinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cursor->currentNode = cursor->currentNode == NULL ? cursor->linkedList->tail : cursor->currentNode->prevNode;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will return the item that the cursor points to, or NULL if the cursor is at the end of the list.
+ *
+ * @param cursor the cursor address
+ * @return it will return the current item, or NULL if the cursor is at the end of the list
+ */
+
+void *doublyLinkedListCursorGet(DoublyLinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return cursor->currentNode == NULL ? NULL : cursor->currentNode->item;
+
+}
+
+
+
+
+/** This function will take the cursor address, and the item address as a parameters,
+ * then it will insert the item before the current item, and the cursor will stay on the current item.
+ *
+ * Note: if the cursor is at the end of the list, then the item will be added at the end of the list.
+ *
+ * @param cursor the cursor address
+ * @param item the new item address
+ */
+
+void doublyLinkedListCursorInsertBefore(DoublyLinkedListCursor *cursor, void *item) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "doubly linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    DoublyLinkedList *linkedList = cursor->linkedList;
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
+    if (newNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "doubly linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    Node *nextNode = cursor->currentNode;
+    Node *prevNode = nextNode == NULL ? linkedList->tail : nextNode->prevNode;
+
+    newNode->item = item;
+    newNode->prevNode = prevNode;
+    newNode->next = nextNode;
+
+    if (prevNode == NULL)
+        linkedList->head = newNode;
+    else
+        prevNode->next = newNode;
+
+    if (nextNode == NULL)
+        linkedList->tail = newNode;
+    else
+        nextNode->prevNode = newNode;
+
+    linkedList->length++;
+
+}
+
+
+
+
+/** This function will take the cursor address, and the item address as a parameters,
+ * then it will insert the item after the current item, and the cursor will stay on the current item.
+ *
+ * Note: if the cursor is at the end of the list, then the item will be added at the start of the list.
+ *
+ * @param cursor the cursor address
+ * @param item the new item address
+ */
+
+void doublyLinkedListCursorInsertAfter(DoublyLinkedListCursor *cursor, void *item) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "doubly linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    DoublyLinkedList *linkedList = cursor->linkedList;
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
+    if (newNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "doubly linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    Node *prevNode = cursor->currentNode;
+    Node *nextNode = prevNode == NULL ? linkedList->head : prevNode->next;
+
+    newNode->item = item;
+    newNode->prevNode = prevNode;
+    newNode->next = nextNode;
+
+    if (prevNode == NULL)
+        linkedList->head = newNode;
+    else
+        prevNode->next = newNode;
+
+    if (nextNode == NULL)
+        linkedList->tail = newNode;
+    else
+        nextNode->prevNode = newNode;
+
+    linkedList->length++;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will delete and free the current item, and the cursor will move to the next item.
+ *
+ * Note: if the cursor is at the end of the list, then the program will terminate.
+ *
+ * @param cursor the cursor address
+ */
+
+void doublyLinkedListCursorRemove(DoublyLinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (cursor->currentNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "doubly linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    void (*freeFun)(void *) = cursor->linkedList->freeFun;
+    freeFun(doublyLinkedListCursorRemoveWtoFr(cursor));
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will delete the current item without freeing it, and the cursor will move to the next item.
+ *
+ * Note: if the cursor is at the end of the list, then the program will terminate.
+ *
+ * @param cursor the cursor address
+ * @return it will return the deleted item
+ */
+
+void *doublyLinkedListCursorRemoveWtoFr(DoublyLinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "doubly linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (cursor->currentNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "doubly linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    DoublyLinkedList *linkedList = cursor->linkedList;
+    Node *nodeToFree = cursor->currentNode;
+    void *item = nodeToFree->item;
+
+    if (nodeToFree->prevNode == NULL)
+        linkedList->head = nodeToFree->next;
+    else
+        nodeToFree->prevNode->next = nodeToFree->next;
+
+    if (nodeToFree->next == NULL)
+        linkedList->tail = nodeToFree->prevNode;
+    else
+        nodeToFree->next->prevNode = nodeToFree->prevNode;
+
+    cursor->currentNode = nodeToFree->next;
+    nodePoolFree(linkedList->nodePool, nodeToFree);
+    linkedList->length--;
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the first node of a run, and the run length as a parameters,
+ * then it will cut the nodes after the run, and it will return the first node after the run.
+ *
+ * Note: this function should only be called from the doublyLinkedListSort function.
+ *
+ * @param start the first node of the run
+ * @param length the run length
+ * @return it will return the first node after the run, or NULL if there is no more nodes
+ */
+
+Node *doublyLinkedListSortSplit(Node *start, int length) {
+    for (int i = 1; start != NULL && i < length; i++)
+        start = start->next;
+
+    if (start == NULL)
+        return NULL;
+
+    Node *rest = start->next;
+    start->next = NULL;
+
+    return rest;
+
+}
+
+
+
+
+/** This function will take two sorted runs, the merged nodes tail, and the sort comparator function as a parameters,
+ * then it will merge the two runs after the merged nodes tail, and it will return the new tail.
+ *
+ * Note: the left node is taken when the two items are equal, so the sort stays stable.
+ *
+ * Note: this function should only be called from the doublyLinkedListSort function.
+ *
+ * @param left the first node of the left run
+ * @param right the first node of the right run
+ * @param tail the last merged node
+ * @param sortComp the sorting comparator function address
+ * @return it will return the last merged node
+ */
+
+Node *doublyLinkedListSortMerge(Node *left, Node *right, Node *tail, int (*sortComp)(const void *, const void *)) {
+    while (left != NULL && right != NULL) {
+        if (sortComp(left->item, right->item) <= 0) {
+            tail->next = left;
+            left = left->next;
+        } else {
+            tail->next = right;
+            right = right->next;
+        }
+
+        tail = tail->next;
+    }
+
+    tail->next = left != NULL ? left : right;
+    while (tail->next != NULL)
+        tail = tail->next;
+
+    return tail;
+
+}
@@ -12,8 +12,16 @@ typedef struct Node {
 
 
 
+Node *linkedListSortSplit(Node *start, int length);
+
+Node *linkedListSortMerge(Node *left, Node *right, Node *tail, int (*sortComp)(const void *, const void *));
+
+
+
 
 /** This function will allocate a new linked list in the memory, setup it's fields and return it.
+ *
+ * Note: the list nodes will be allocated from a private node pool, that will be released at once by the clear and destroy functions.
  *
  * @param freeFun the free function address that will be called to free the items in the linked list
  * @param comparator the comparator function address, that will be called to compare two items
@@ -32,6 +40,59 @@ LinkedList *linkedListInitialization(void (*freeFun)(void *),  int (*comparator)
 
     }
 
+    NodePool *nodePool = linkedListNodePoolInitialization();
+    if (nodePool == NULL)
+        return NULL;
+
+    LinkedList *linkedList = linkedListSharedPoolInitialization(freeFun, comparator, nodePool);
+    if (linkedList == NULL) {
+        destroyNodePool(nodePool);
+        return NULL;
+    }
+
+    linkedList->sharedNodePool = 0;
+
+    return linkedList;
+}
+
+
+
+
+/** This function will take the freeing and comparator functions, and a node pool address as a parameters,
+ * then it will allocate a new linked list that allocates it's nodes from the passed pool, setup it's fields and return it.
+ *
+ * Note: the pool can be shared by many lists, so it will not be released by the list,
+ * and it should be destroyed after destroying all the lists that use it.
+ *
+ * Note: the pool should be created using the linkedListNodePoolInitialization function.
+ *
+ * @param freeFun the free function address that will be called to free the linked list items
+ * @param comparator the comparator function address, that will be called to compare two items
+ * @param nodePool the node pool address
+ * @return it will return the initialized linked list pointer
+ */
+
+LinkedList *linkedListSharedPoolInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *), NodePool *nodePool) {
+    if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+     		fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "linked list data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (nodePool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+     		fprintf(stderr, INVALID_ARG_MESSAGE, "node pool pointer", "linked list data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    }
+
     LinkedList *linkedList = (LinkedList *) malloc(sizeof(LinkedList));
     if (linkedList == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
@@ -48,6 +109,8 @@ LinkedList *linkedListInitialization(void (*freeFun)(void *),  int (*comparator)
     linkedList->length = 0;
     linkedList->freeFun  = freeFun;
     linkedList->comparator = comparator;
+    linkedList->nodePool = nodePool;
+    linkedList->sharedNodePool = 1;
 
     return linkedList;
 }
@@ -56,6 +119,22 @@ LinkedList *linkedListInitialization(void (*freeFun)(void *),  int (*comparator)
 
 
 
+/** This function will initialize a new node pool, that allocates nodes with the linked list node size, and return it.
+ *
+ * Note: the pool can be passed to the linkedListSharedPoolInitialization function, so many lists can share it.
+ *
+ * @return it will return the initialized node pool pointer
+ */
+
+NodePool *linkedListNodePoolInitialization() {
+    return nodePoolInitialization(sizeof(Node));
+}
+
+
+
+
+
+
 /** This function will take the linked list address, and the item address as a parameters,
   * then it will add the item in the start of the linked list.
   *
@@ -84,7 +163,7 @@ void linkedListAddFirst(LinkedList *linkedList, void *item) {
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -139,7 +218,7 @@ void linkedListAddLast(LinkedList *linkedList, void *item) {
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -205,7 +284,7 @@ void linkedListAddAtIndex(LinkedList *linkedList, int index, void *item) {
 
     }
 
-    Node *newNode = (Node *) malloc(sizeof(Node));
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
     if (newNode == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
@@ -316,7 +395,7 @@ void linkedListDeleteFirst(LinkedList *linkedList) {
 
     linkedList->length--;
     linkedList->freeFun(nodeToFree->item);
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
 }
 
@@ -361,7 +440,7 @@ void *linkedListDeleteFirstWtoFr(LinkedList *linkedList) {
 
     linkedList->length--;
     void *returnItem = nodeToFree->item;
-    free(nodeToFree);
+    nodePoolFree(linkedList->nodePool, nodeToFree);
 
     return returnItem;
 
@@ -414,7 +493,7 @@ void linkedListDeleteLast(LinkedList *linkedList) {
 
     linkedList->length--;
     linkedList->freeFun(currentNode->item);
-    free(currentNode);
+    nodePoolFree(linkedList->nodePool, currentNode);
 
 }
 
@@ -466,7 +545,7 @@ void *linkedListDeleteLastWtoFr(LinkedList *linkedList) {
 
     linkedList->length--;
     void *returnItem = currentNode->item;
-    free(currentNode);
+    nodePoolFree(linkedList->nodePool, currentNode);
 
     return returnItem;
 
@@ -531,7 +610,7 @@ void linkedListDeleteAtIndex(LinkedList *linkedList, int index) {
 
         linkedList->length--;
         linkedList->freeFun(currentNode->item);
-        free(currentNode);
+        nodePoolFree(linkedList->nodePool, currentNode);
     }
 
 }
@@ -595,7 +674,7 @@ void *linkedListDeleteAtIndexWtoFr(LinkedList *linkedList, int index) {
 
         linkedList->length--;
         void *returnItem = currentNode->item;
-        free(currentNode);
+        nodePoolFree(linkedList->nodePool, currentNode);
 
         return returnItem;
 
@@ -950,6 +1029,65 @@ void **linkedListToArray(LinkedList *linkedList) {
 
 
 
+/** This function will take the linked list address, and the sort comparator function as a parameters,
+ * then it will sort the linked list items using a bottom up merge sort, that only changes the nodes links.
+ *
+ * Note: the items will be sent directly to the sort comparator function, like the linked list comparator function.
+ *
+ * Note: the sort is stable, so the equal items keep their order, and it doesn't allocate any memory.
+ *
+ * @param linkedList the linked list address
+ * @param sortComp the sorting comparator function address
+ */
+
+void linkedListSort(LinkedList *linkedList, int (*sortComp)(const void *, const void *)) {
+    if (linkedList == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "linked list pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (sortComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "sort comparator function", "linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    Node dummy;
+    dummy.next = linkedList->head;
+
+    // every pass merges the sorted runs of (width) nodes in pairs, so the runs length is doubled.
+    for (int width = 1; width < linkedList->length; width *= 2) {
+        Node *remaining = dummy.next;
+        Node *mergedTail = &dummy;
+
+        while (remaining != NULL) {
+            Node *left = remaining;
+            Node *right = linkedListSortSplit(left, width);
+            remaining = linkedListSortSplit(right, width);
+
+            mergedTail = linkedListSortMerge(left, right, mergedTail, sortComp);
+        }
+
+        linkedList->tail = mergedTail;
+    }
+
+    linkedList->head = dummy.next;
+
+}
+
+
+
+
+
 /** This function will take the linked list address as a parameter,
  * the it will return the number of items in the linked list.
  *
@@ -1045,6 +1183,8 @@ void printLinkedList(LinkedList *linkedList, void (*printFun) (const void *)) {
 /** This function will take the linked list address as a parameter,
  * then it will delete and free all the items from the linked list.
  *
+ * Note: if the node pool isn't shared, then it's slabs will be released at once instead of freeing the nodes one by one.
+ *
  * @param linkedList the linked list pointer
  */
 
@@ -1069,10 +1209,14 @@ void linkedListClear(LinkedList *linkedList) {
         currentNode = currentNode->next;
 
         linkedList->freeFun(nodeToFree->item);
-        free(nodeToFree);
+        if (linkedList->sharedNodePool)
+            nodePoolFree(linkedList->nodePool, nodeToFree);
 
     }
 
+    if (!linkedList->sharedNodePool)
+        nodePoolReset(linkedList->nodePool);
+
     linkedList->head = linkedList->tail = NULL;
     linkedList->length = 0;
 
@@ -1101,6 +1245,396 @@ void destroyLinkedList(LinkedList *linkedList) {
     }
 
     linkedListClear(linkedList);
+    if (!linkedList->sharedNodePool)
+        destroyNodePool(linkedList->nodePool);
+
     free(linkedList);
 
-}
\ No newline at end of file
+}
+
+
+
+/** This function will take the cursor address, and the linked list address as a parameters,
+ * then it will initialize the cursor on the first item of the linked list.
+ *
+ * Note: the cursor can be embedded in another structure or declared on the stack, because it doesn't allocate any memory.
+ *
+ * Note: the end of the list is a position between the last and the first items,
+ * so moving next from the last item reaches the end, and moving next from the end reaches the first item.
+ *
+ * Note: changing the linked list without the cursor functions may make the cursor invalid, except adding items at the end.
+ *
+ * @param cursor the cursor address
+ * @param linkedList the linked list pointer
+ */
+
+void linkedListCursorInitialization(LinkedListCursor *cursor, LinkedList *linkedList) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (linkedList == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "linked list pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cursor->linkedList = linkedList;
+    cursor->prevNode = NULL;
+    cursor->currentNode = linkedList->head;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will move the cursor to the next item.
+ *
+ * @param cursor the cursor address
+ */
+
+void linkedListCursorNext(LinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    if (cursor->currentNode == NULL) {
+        cursor->prevNode = NULL;
+        cursor->currentNode = cursor->linkedList->head;
+    } else {
+        cursor->prevNode = cursor->currentNode;
+        cursor->currentNode = cursor->currentNode->next;
+    }
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will return the item that the cursor points to, or NULL if the cursor is at the end of the list.
+ *
+ * @param cursor the cursor address
+ * @return it will return the current item, or NULL if the cursor is at the end of the list
+ */
+
+void *linkedListCursorGet(LinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return cursor->currentNode == NULL ? NULL : cursor->currentNode->item;
+
+}
+
+
+
+
+/** This function will take the cursor address, and the item address as a parameters,
+ * then it will insert the item before the current item, and the cursor will stay on the current item.
+ *
+ * Note: if the cursor is at the end of the list, then the item will be added at the end of the list.
+ *
+ * @param cursor the cursor address
+ * @param item the new item address
+ */
+
+void linkedListCursorInsertBefore(LinkedListCursor *cursor, void *item) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    LinkedList *linkedList = cursor->linkedList;
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
+    if (newNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // the node before the end of the list is the tail.
+    Node *prevNode = cursor->currentNode == NULL ? linkedList->tail : cursor->prevNode;
+
+    newNode->item = item;
+    newNode->next = cursor->currentNode;
+
+    if (prevNode == NULL)
+        linkedList->head = newNode;
+    else
+        prevNode->next = newNode;
+
+    if (cursor->currentNode == NULL)
+        linkedList->tail = newNode;
+
+    cursor->prevNode = newNode;
+    linkedList->length++;
+
+}
+
+
+
+
+/** This function will take the cursor address, and the item address as a parameters,
+ * then it will insert the item after the current item, and the cursor will stay on the current item.
+ *
+ * Note: if the cursor is at the end of the list, then the item will be added at the start of the list.
+ *
+ * @param cursor the cursor address
+ * @param item the new item address
+ */
+
+void linkedListCursorInsertAfter(LinkedListCursor *cursor, void *item) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    LinkedList *linkedList = cursor->linkedList;
+    Node *newNode = (Node *) nodePoolAllocate(linkedList->nodePool);
+    if (newNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    newNode->item = item;
+
+    if (cursor->currentNode == NULL) {
+        newNode->next = linkedList->head;
+        linkedList->head = newNode;
+        if (linkedList->tail == NULL)
+            linkedList->tail = newNode;
+
+    } else {
+        newNode->next = cursor->currentNode->next;
+        cursor->currentNode->next = newNode;
+        if (linkedList->tail == cursor->currentNode)
+            linkedList->tail = newNode;
+
+    }
+
+    linkedList->length++;
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will delete and free the current item, and the cursor will move to the next item.
+ *
+ * Note: if the cursor is at the end of the list, then the program will terminate.
+ *
+ * @param cursor the cursor address
+ */
+
+void linkedListCursorRemove(LinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (cursor->currentNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    void (*freeFun)(void *) = cursor->linkedList->freeFun;
+    freeFun(linkedListCursorRemoveWtoFr(cursor));
+
+}
+
+
+
+
+/** This function will take the cursor address as a parameter,
+ * then it will delete the current item without freeing it, and the cursor will move to the next item.
+ *
+ * Note: if the cursor is at the end of the list, then the program will terminate.
+ *
+ * @param cursor the cursor address
+ * @return it will return the deleted item
+ */
+
+void *linkedListCursorRemoveWtoFr(LinkedListCursor *cursor) {
+    if (cursor == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cursor pointer", "linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (cursor->currentNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    LinkedList *linkedList = cursor->linkedList;
+    Node *nodeToFree = cursor->currentNode;
+    void *item = nodeToFree->item;
+
+    if (cursor->prevNode == NULL)
+        linkedList->head = nodeToFree->next;
+    else
+        cursor->prevNode->next = nodeToFree->next;
+
+    if (linkedList->tail == nodeToFree)
+        linkedList->tail = cursor->prevNode;
+
+    cursor->currentNode = nodeToFree->next;
+    nodePoolFree(linkedList->nodePool, nodeToFree);
+    linkedList->length--;
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the first node of a run, and the run length as a parameters,
+ * then it will cut the nodes after the run, and it will return the first node after the run.
+ *
+ * Note: this function should only be called from the linkedListSort function.
+ *
+ * @param start the first node of the run
+ * @param length the run length
+ * @return it will return the first node after the run, or NULL if there is no more nodes
+ */
+
+Node *linkedListSortSplit(Node *start, int length) {
+    for (int i = 1; start != NULL && i < length; i++)
+        start = start->next;
+
+    if (start == NULL)
+        return NULL;
+
+    Node *rest = start->next;
+    start->next = NULL;
+
+    return rest;
+
+}
+
+
+
+
+/** This function will take two sorted runs, the merged nodes tail, and the sort comparator function as a parameters,
+ * then it will merge the two runs after the merged nodes tail, and it will return the new tail.
+ *
+ * Note: the left node is taken when the two items are equal, so the sort stays stable.
+ *
+ * Note: this function should only be called from the linkedListSort function.
+ *
+ * @param left the first node of the left run
+ * @param right the first node of the right run
+ * @param tail the last merged node
+ * @param sortComp the sorting comparator function address
+ * @return it will return the last merged node
+ */
+
+Node *linkedListSortMerge(Node *left, Node *right, Node *tail, int (*sortComp)(const void *, const void *)) {
+    while (left != NULL && right != NULL) {
+        if (sortComp(left->item, right->item) <= 0) {
+            tail->next = left;
+            left = left->next;
+        } else {
+            tail->next = right;
+            right = right->next;
+        }
+
+        tail = tail->next;
+    }
+
+    tail->next = left != NULL ? left : right;
+    while (tail->next != NULL)
+        tail = tail->next;
+
+    return tail;
+
+}
@@ -0,0 +1,247 @@
+#include "../Headers/NodePool.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+
+
+/** This function will take the node size as a parameter,
+ * then it will initialize a new node pool in the memory and set it's fields then return it.
+ *
+ * Note: the slabs will be allocated only when they are needed, so the new pool doesn't allocate any nodes memory.
+ *
+ * @param nodeSize the size of one node in bytes
+ * @return it will return the initialized pool pointer
+ */
+
+NodePool *nodePoolInitialization(int nodeSize) {
+    if (nodeSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "node size", "node pool data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    NodePool *pool = (NodePool *) malloc(sizeof(NodePool));
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "node pool data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // the node size is aligned to the pointer size, so every node can hold the free list pointer,
+    // and the nodes that are carved from the slab are aligned.
+    pool->nodeSize = (int) ((nodeSize + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *));
+    pool->slabs = NULL;
+    pool->freeNodes = NULL;
+    pool->nextNode = pool->slabEnd = NULL;
+    pool->nextSlabLength = NODE_POOL_FIRST_SLAB_LENGTH;
+    pool->usedCount = 0;
+
+    return pool;
+
+}
+
+
+
+
+
+/** This function will take the pool address as a parameter,
+ * then it will return a node from the free list if there is one, other wise it will carve a new node from the last slab,
+ * and it will allocate a new slab only when the last slab is full.
+ *
+ * @param pool the pool address
+ * @return it will return the new node address
+ */
+
+void *nodePoolAllocate(NodePool *pool) {
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "pool", "node pool data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void *node;
+
+    if (pool->freeNodes != NULL) {
+        node = pool->freeNodes;
+        pool->freeNodes = *(void **) node;
+    } else {
+        if (pool->nextNode == pool->slabEnd) {
+            char *newSlab = (char *) malloc(sizeof(void *) + (size_t) pool->nodeSize * pool->nextSlabLength);
+            if (newSlab == NULL) {
+                #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                    ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                    return NULL;
+                #else
+                    fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "slab", "node pool data structure");
+                    exit(FAILED_ALLOCATION);
+                #endif
+
+            }
+
+            *(void **) newSlab = pool->slabs;
+            pool->slabs = newSlab;
+            pool->nextNode = newSlab + sizeof(void *);
+            pool->slabEnd = pool->nextNode + (size_t) pool->nodeSize * pool->nextSlabLength;
+
+            if (pool->nextSlabLength < NODE_POOL_MAX_SLAB_LENGTH)
+                pool->nextSlabLength *= 2;
+
+        }
+
+        node = pool->nextNode;
+        pool->nextNode += pool->nodeSize;
+    }
+
+    pool->usedCount++;
+
+    return node;
+
+}
+
+
+
+
+
+/** This function will take the pool address, and the node address as a parameters,
+ * then it will push the node to the free list, so it can be reused by the next allocation.
+ *
+ * Note: the node should be allocated from the same pool.
+ *
+ * @param pool the pool address
+ * @param node the node address
+ */
+
+void nodePoolFree(NodePool *pool, void *node) {
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "pool", "node pool data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (node == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "node pointer", "node pool data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    *(void **) node = pool->freeNodes;
+    pool->freeNodes = node;
+    pool->usedCount--;
+
+}
+
+
+
+
+
+/** This function will take the pool address as a parameter,
+ * then it will return the number of the allocated nodes that are not freed.
+ *
+ * @param pool the pool address
+ * @return it will return the number of the used nodes
+ */
+
+int nodePoolGetUsedCount(NodePool *pool) {
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "pool", "node pool data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return pool->usedCount;
+
+}
+
+
+
+
+
+/** This function will take the pool address as a parameter,
+ * then it will free all the slabs at once, so all the nodes of the pool will be freed without visiting them.
+ *
+ * Note: all the nodes that were allocated from the pool will not be valid after calling this function.
+ *
+ * @param pool the pool address
+ */
+
+void nodePoolReset(NodePool *pool) {
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "pool", "node pool data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    while (pool->slabs != NULL) {
+        void *slabToFree = pool->slabs;
+        pool->slabs = *(void **) slabToFree;
+        free(slabToFree);
+    }
+
+    pool->freeNodes = NULL;
+    pool->nextNode = pool->slabEnd = NULL;
+    pool->nextSlabLength = NODE_POOL_FIRST_SLAB_LENGTH;
+    pool->usedCount = 0;
+
+}
+
+
+
+
+
+/** This function will take the pool address as a parameter,
+ * then it will destroy and free the pool and all it's slabs.
+ *
+ * @param pool the pool address
+ */
+
+void destroyNodePool(NodePool *pool) {
+    if (pool == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "pool", "node pool data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    nodePoolReset(pool);
+    free(pool);
+
+}
@@ -0,0 +1,938 @@
+#include "../Headers/SkipList.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+/** @struct SkipListLink
+*  @brief This structure holds one level link of a skip list node.
+*  @var SkipListLink::next
+*  Member 'next' is a pointer to the next node in the level.
+*  @var SkipListLink::span
+*  Member 'span' holds the number of items that the link jumps over, including the next node item.
+*/
+
+typedef struct SkipListLink {
+    struct SkipListNode *next;
+    int span;
+} SkipListLink;
+
+
+
+/** @struct SkipListNode
+*  @brief This structure holds one item of the skip list with it's levels links.
+*  @var SkipListNode::item
+*  Member 'item' is a pointer to the node item.
+*  @var SkipListNode::links
+*  Member 'links' is the node levels links array, and it's length is the node level.
+*/
+
+typedef struct SkipListNode {
+    void *item;
+    SkipListLink links[];
+} SkipListNode;
+
+
+
+SkipListNode *skipListCreateNode(SkipList *list, int level, void *item);
+
+int skipListRandomLevel(SkipList *list);
+
+void skipListUnlinkNode(SkipList *list, SkipListNode *node, SkipListNode **update);
+
+
+
+
+
+/** This function will take the freeing and comparator functions as a parameter,
+ * then it will initialize a new skip list in the memory and set it's fields then return it.
+ *
+ * Note: the nodes of every level are allocated from their own node pool, that is created when the first node of that level is added.
+ *
+ * @param freeFn the function address that will be called to free the list items
+ * @param cmp the comparator function address, that will be called to order the list items
+ * @return it will return the initialized list pointer
+ */
+
+SkipList *skipListInitialization(void (*freeFn)(void *), int (*cmp)(const void *, const void *)) {
+    if (freeFn == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (cmp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "comparator function pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipList *list = (SkipList *) malloc(sizeof(SkipList));
+    SkipListNode *head = (SkipListNode *) malloc(sizeof(SkipListNode) + sizeof(SkipListLink) * SKIP_LIST_MAX_LEVEL);
+    if (list == NULL || head == NULL) {
+        free(list);
+        free(head);
+
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "skip list", "skip list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    head->item = NULL;
+    for (int i = 0; i < SKIP_LIST_MAX_LEVEL; i++) {
+        head->links[i].next = NULL;
+        head->links[i].span = 0;
+        list->levelPools[i] = NULL;
+    }
+
+    list->head = head;
+    list->level = 1;
+    list->count = 0;
+    list->randomState = 0x9E3779B9u;
+    list->freeFn = freeFn;
+    list->cmp = cmp;
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will insert the item in it's ordered position.
+ *
+ * Note: the equal items are inserted after the old ones, so they keep their insertion order.
+ *
+ * @param list the skip list address
+ * @param item the new item address
+ */
+
+void skipListInsert(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipListNode *update[SKIP_LIST_MAX_LEVEL];
+    int rank[SKIP_LIST_MAX_LEVEL];
+    SkipListNode *currentNode = list->head;
+
+    // for every level find the last node that is before the item, and the number of items up to it.
+    for (int i = list->level - 1; i >= 0; i--) {
+        rank[i] = i == list->level - 1 ? 0 : rank[i + 1];
+
+        while (currentNode->links[i].next != NULL && list->cmp(currentNode->links[i].next->item, item) <= 0) {
+            rank[i] += currentNode->links[i].span;
+            currentNode = currentNode->links[i].next;
+        }
+
+        update[i] = currentNode;
+    }
+
+    int level = skipListRandomLevel(list);
+    SkipListNode *newNode = skipListCreateNode(list, level, item);
+    if (newNode == NULL)
+        return;
+
+    if (level > list->level) {
+        for (int i = list->level; i < level; i++) {
+            rank[i] = 0;
+            update[i] = list->head;
+            list->head->links[i].span = list->count;
+        }
+
+        list->level = level;
+    }
+
+    for (int i = 0; i < level; i++) {
+        newNode->links[i].next = update[i]->links[i].next;
+        update[i]->links[i].next = newNode;
+
+        newNode->links[i].span = update[i]->links[i].span - (rank[0] - rank[i]);
+        update[i]->links[i].span = rank[0] - rank[i] + 1;
+    }
+
+    // the higher links jump over the new node.
+    for (int i = level; i < list->level; i++)
+        update[i]->links[i].span++;
+
+    list->count++;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, the items array, and it's length as a parameters,
+ * then it will insert all the items in the list.
+ *
+ * @param list the skip list address
+ * @param items the items array
+ * @param length the length of the items array
+ */
+
+void skipListInsertAll(SkipList *list, void **items, int length) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (int i = 0; i < length; i++)
+        skipListInsert(list, items[i]);
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will delete and free the first item that is equal to the passed item, if found.
+ *
+ * @param list the skip list address
+ * @param item the item address
+ */
+
+void skipListDelete(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    void *deletedItem = skipListDeleteWtoFr(list, item);
+    if (deletedItem != NULL)
+        list->freeFn(deletedItem);
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will delete the first item that is equal to the passed item without freeing it, and it will return it.
+ *
+ * @param list the skip list address
+ * @param item the item address
+ * @return it will return the deleted item if found, other wise it will return NULL
+ */
+
+void *skipListDeleteWtoFr(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipListNode *update[SKIP_LIST_MAX_LEVEL];
+    SkipListNode *currentNode = list->head;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && list->cmp(currentNode->links[i].next->item, item) < 0)
+            currentNode = currentNode->links[i].next;
+
+        update[i] = currentNode;
+    }
+
+    currentNode = currentNode->links[0].next;
+    if (currentNode == NULL || list->cmp(currentNode->item, item) != 0)
+        return NULL;
+
+    void *deletedItem = currentNode->item;
+    skipListUnlinkNode(list, currentNode, update);
+
+    return deletedItem;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the index as a parameters,
+ * then it will delete and free the item in the passed index.
+ *
+ * @param list the skip list address
+ * @param index the item index
+ */
+
+void skipListDeleteAtIndex(SkipList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "skip list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    list->freeFn(skipListDeleteAtIndexWtoFr(list, index));
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the index as a parameters,
+ * then it will delete the item in the passed index without freeing it, and it will return it.
+ *
+ * @param list the skip list address
+ * @param index the item index
+ * @return it will return the deleted item
+ */
+
+void *skipListDeleteAtIndexWtoFr(SkipList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "skip list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    SkipListNode *update[SKIP_LIST_MAX_LEVEL];
+    SkipListNode *currentNode = list->head;
+    int traversed = 0;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && traversed + currentNode->links[i].span <= index) {
+            traversed += currentNode->links[i].span;
+            currentNode = currentNode->links[i].next;
+        }
+
+        update[i] = currentNode;
+    }
+
+    currentNode = currentNode->links[0].next;
+
+    void *deletedItem = currentNode->item;
+    skipListUnlinkNode(list, currentNode, update);
+
+    return deletedItem;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will return one if the item is in the list, other wise it will return zero.
+ *
+ * @param list the skip list address
+ * @param item the item address
+ * @return it will return one if the item is in the list, other wise it will return zero
+ */
+
+int skipListContains(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    return skipListGet(list, item) != NULL;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will return the first item in the list that is equal to the passed item.
+ *
+ * @param list the skip list address
+ * @param item the item address
+ * @return it will return the item if found, other wise it will return NULL
+ */
+
+void *skipListGet(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipListNode *currentNode = list->head;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && list->cmp(currentNode->links[i].next->item, item) < 0)
+            currentNode = currentNode->links[i].next;
+
+    }
+
+    currentNode = currentNode->links[0].next;
+
+    return currentNode != NULL && list->cmp(currentNode->item, item) == 0 ? currentNode->item : NULL;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the item address as a parameters,
+ * then it will return the index (rank) of the first item that is equal to the passed item,
+ * other wise it will return minus one (-1).
+ *
+ * Note: the index is the sum of the spans of the followed links, so it's found in the same steps of the search.
+ *
+ * @param list the skip list address
+ * @param item the item address
+ * @return it will return the item index if found, other wise it will return -1
+ */
+
+int skipListGetIndex(SkipList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipListNode *currentNode = list->head;
+    int rank = 0;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && list->cmp(currentNode->links[i].next->item, item) < 0) {
+            rank += currentNode->links[i].span;
+            currentNode = currentNode->links[i].next;
+        }
+
+    }
+
+    currentNode = currentNode->links[0].next;
+
+    return currentNode != NULL && list->cmp(currentNode->item, item) == 0 ? rank : -1;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, and the index as a parameters,
+ * then it will return the item in the passed index in the items order.
+ *
+ * Note: the search follows the links that don't jump past the index, so it takes logarithmic time.
+ *
+ * @param list the skip list address
+ * @param index the item index
+ * @return it will return the item in the passed index
+ */
+
+void *skipListGetAtIndex(SkipList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "skip list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    SkipListNode *currentNode = list->head;
+    int traversed = 0;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && traversed + currentNode->links[i].span <= index + 1) {
+            traversed += currentNode->links[i].span;
+            currentNode = currentNode->links[i].next;
+        }
+
+        if (traversed == index + 1)
+            return currentNode->item;
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, the range start and end items, and the action function address as a parameters,
+ * then it will call the action function with every item that is bigger than or equal to the start item,
+ * and smaller than or equal to the end item, in the items order.
+ *
+ * Note: the first item in the range is found by searching, then the items are visited through the bottom level links.
+ *
+ * @param list the skip list address
+ * @param fromItem the range start item
+ * @param toItem the range end item
+ * @param action the function that will be called with every item in the range
+ */
+
+void skipListForEachInRange(SkipList *list, void *fromItem, void *toItem, void (*action)(void *)) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (fromItem == NULL || toItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "range item pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (action == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "action function pointer", "skip list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SkipListNode *currentNode = list->head;
+
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (currentNode->links[i].next != NULL && list->cmp(currentNode->links[i].next->item, fromItem) < 0)
+            currentNode = currentNode->links[i].next;
+
+    }
+
+    for (currentNode = currentNode->links[0].next; currentNode != NULL && list->cmp(currentNode->item, toItem) <= 0; currentNode = currentNode->links[0].next)
+        action(currentNode->item);
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will return the number of items in the list.
+ *
+ * @param list the skip list address
+ * @return it will return the number of items in the list
+ */
+
+int skipListGetSize(SkipList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count;
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will return one if the list is empty, other wise it will return zero.
+ *
+ * @param list the skip list address
+ * @return it will return one if the list is empty, other wise it will return zero
+ */
+
+int skipListIsEmpty(SkipList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count == 0;
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will return a new array that contains the list items in order.
+ *
+ * Note: the array should be freed after using it, but the items in it shouldn't.
+ *
+ * @param list the skip list address
+ * @return it will return the items array
+ */
+
+void **skipListToArray(SkipList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void **array = (void **) malloc(sizeof(void *) * list->count);
+    if (array == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "to array", "skip list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    int index = 0;
+    for (SkipListNode *currentNode = list->head->links[0].next; currentNode != NULL; currentNode = currentNode->links[0].next)
+        array[index++] = currentNode->item;
+
+    return array;
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will delete and free all the list items.
+ *
+ * Note: the nodes are released at once by resetting the levels node pools.
+ *
+ * @param list the skip list address
+ */
+
+void clearSkipList(SkipList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    for (SkipListNode *currentNode = list->head->links[0].next; currentNode != NULL; currentNode = currentNode->links[0].next)
+        list->freeFn(currentNode->item);
+
+    for (int i = 0; i < SKIP_LIST_MAX_LEVEL; i++) {
+        list->head->links[i].next = NULL;
+        list->head->links[i].span = 0;
+
+        if (list->levelPools[i] != NULL)
+            nodePoolReset(list->levelPools[i]);
+
+    }
+
+    list->level = 1;
+    list->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will destroy and free the list, it's items, and it's nodes.
+ *
+ * @param list the skip list address
+ */
+
+void destroySkipList(SkipList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "skip list", "skip list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearSkipList(list);
+
+    for (int i = 0; i < SKIP_LIST_MAX_LEVEL; i++) {
+        if (list->levelPools[i] != NULL)
+            destroyNodePool(list->levelPools[i]);
+
+    }
+
+    free(list->head);
+    free(list);
+
+}
+
+
+
+
+
+/** This function will take the skip list address, the node level, and the item address as a parameters,
+ * then it will allocate a new node with the passed level from the level node pool, and it will return it.
+ *
+ * Note: this function should only be called from the skip list functions.
+ *
+ * @param list the skip list address
+ * @param level the new node level
+ * @param item the new node item
+ * @return it will return the new node address
+ */
+
+SkipListNode *skipListCreateNode(SkipList *list, int level, void *item) {
+    if (list->levelPools[level - 1] == NULL) {
+        list->levelPools[level - 1] = nodePoolInitialization((int) (sizeof(SkipListNode) + sizeof(SkipListLink) * level));
+        if (list->levelPools[level - 1] == NULL)
+            return NULL;
+
+    }
+
+    SkipListNode *newNode = (SkipListNode *) nodePoolAllocate(list->levelPools[level - 1]);
+    if (newNode == NULL)
+        return NULL;
+
+    newNode->item = item;
+
+    return newNode;
+
+}
+
+
+
+
+
+/** This function will take the skip list address as a parameter,
+ * then it will return a random level for a new node, where every level has a quarter of the nodes of the level below it.
+ *
+ * Note: the random numbers are generated by a xorshift generator that is stored in the list,
+ * so the levels doesn't depend on the global rand state.
+ *
+ * Note: this function should only be called from the skip list functions.
+ *
+ * @param list the skip list address
+ * @return it will return the new node level
+ */
+
+int skipListRandomLevel(SkipList *list) {
+    int level = 1;
+
+    while (level < SKIP_LIST_MAX_LEVEL) {
+        list->randomState ^= list->randomState << 13;
+        list->randomState ^= list->randomState >> 17;
+        list->randomState ^= list->randomState << 5;
+
+        if ((list->randomState & 3) != 0)
+            break;
+
+        level++;
+    }
+
+    return level;
+
+}
+
+
+
+
+
+/** This function will take the skip list address, the node address, and the nodes before it in every level as a parameters,
+ * then it will unlink the node from all the levels, update the links spans, and free the node.
+ *
+ * Note: this function should only be called from the skip list functions.
+ *
+ * @param list the skip list address
+ * @param node the node address
+ * @param update the last node before the node in every level
+ */
+
+void skipListUnlinkNode(SkipList *list, SkipListNode *node, SkipListNode **update) {
+    int level = 0;
+
+    for (int i = 0; i < list->level; i++) {
+        if (update[i]->links[i].next == node) {
+            update[i]->links[i].span += node->links[i].span - 1;
+            update[i]->links[i].next = node->links[i].next;
+            level++;
+        } else
+            update[i]->links[i].span--;
+
+    }
+
+    while (list->level > 1 && list->head->links[list->level - 1].next == NULL)
+        list->level--;
+
+    list->count--;
+    nodePoolFree(list->levelPools[level - 1], node);
+
+}
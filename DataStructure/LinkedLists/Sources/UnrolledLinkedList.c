@@ -0,0 +1,1203 @@
+#include "../Headers/UnrolledLinkedList.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+/** @struct UnrolledNode
+*  @brief This structure holds a block of items of the unrolled linked list.
+*  @var UnrolledNode::next
+*  Member 'next' is a pointer to the next node.
+*  @var UnrolledNode::count
+*  Member 'count' holds the number of items in the node.
+*  @var UnrolledNode::items
+*  Member 'items' is the node items array.
+*/
+
+typedef struct UnrolledNode {
+    struct UnrolledNode *next;
+    int count;
+    void *items[UNROLLED_LINKED_LIST_NODE_CAPACITY];
+} UnrolledNode;
+
+
+
+UnrolledNode *unrolledLinkedListNewNode(UnrolledLinkedList *list, UnrolledNode *prevNode);
+
+UnrolledNode *unrolledLinkedListFindNode(UnrolledLinkedList *list, int *index, UnrolledNode **prevNode);
+
+void unrolledLinkedListInsert(UnrolledLinkedList *list, UnrolledNode *node, int offset, void *item);
+
+void *unrolledLinkedListRemove(UnrolledLinkedList *list, UnrolledNode *node, UnrolledNode *prevNode, int offset);
+
+void unrolledLinkedListRebalance(UnrolledLinkedList *list, UnrolledNode *node);
+
+
+
+
+
+/** This function will take the freeing and comparator functions as a parameter,
+ * then it will initialize a new unrolled linked list in the memory and set it's fields then return it.
+ *
+ * Note: the list nodes will be allocated from a private node pool, that will be released at once by the clear and destroy functions.
+ *
+ * @param freeFun the function address that will be called to free the list items
+ * @param comparator the comparator function address, that will be called to compare two items in the list
+ * @return it will return the initialized list pointer
+ */
+
+UnrolledLinkedList *unrolledLinkedListInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *)) {
+    if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    UnrolledLinkedList *list = (UnrolledLinkedList *) malloc(sizeof(UnrolledLinkedList));
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "unrolled linked list", "unrolled linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    list->nodePool = nodePoolInitialization(sizeof(UnrolledNode));
+    if (list->nodePool == NULL) {
+        free(list);
+        return NULL;
+    }
+
+    list->head = list->tail = NULL;
+    list->length = 0;
+    list->nodesCount = 0;
+    list->freeFun = freeFun;
+    list->comparator = comparator;
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the item address as a parameters,
+ * then it will add the item in the start of the list.
+ *
+ * Note: if the first node is full, then a new node will be added before it instead of splitting it.
+ *
+ * @param list the unrolled linked list address
+ * @param item the new item address
+ */
+
+void unrolledLinkedListAddFirst(UnrolledLinkedList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (list->head == NULL || list->head->count == UNROLLED_LINKED_LIST_NODE_CAPACITY) {
+        if (unrolledLinkedListNewNode(list, NULL) == NULL)
+            return;
+
+    }
+
+    unrolledLinkedListInsert(list, list->head, 0, item);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the item address as a parameters,
+ * then it will add the item in the end of the list.
+ *
+ * Note: if the last node is full, then a new node will be added after it instead of splitting it,
+ * so the nodes that are filled by this function will be full.
+ *
+ * @param list the unrolled linked list address
+ * @param item the new item address
+ */
+
+void unrolledLinkedListAddLast(UnrolledLinkedList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (list->tail == NULL || list->tail->count == UNROLLED_LINKED_LIST_NODE_CAPACITY) {
+        if (unrolledLinkedListNewNode(list, list->tail) == NULL)
+            return;
+
+    }
+
+    unrolledLinkedListInsert(list, list->tail, list->tail->count, item);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, the item index, and the item address as a parameters,
+ * then it will add the item in the passed index.
+ *
+ * Note: if the node of the index is full, then it will be split into two half full nodes.
+ *
+ * @param list the unrolled linked list address
+ * @param index the index that the new item will be inserted in
+ * @param item the new item address
+ */
+
+void unrolledLinkedListAddAtIndex(UnrolledLinkedList *list, int index, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index >= list->length) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "unrolled linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    UnrolledNode *prevNode;
+    UnrolledNode *node = unrolledLinkedListFindNode(list, &index, &prevNode);
+
+    unrolledLinkedListInsert(list, node, index, item);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, items array, and the length of the array as parameters,
+ * then it will add all the array items in the end of the list.
+ *
+ * @param list the unrolled linked list address
+ * @param items the items array
+ * @param itemsLength the length of the items array
+ */
+
+void unrolledLinkedListAddAll(UnrolledLinkedList *list, void **items, int itemsLength) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (int i = 0; i < itemsLength; i++)
+        unrolledLinkedListAddLast(list, items[i]);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will delete and free the first item in the list.
+ *
+ * @param list the unrolled linked list address
+ */
+
+void unrolledLinkedListDeleteFirst(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->freeFun(unrolledLinkedListRemove(list, list->head, NULL, 0));
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will delete the first item in the list without freeing it, and it will return it.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the deleted item
+ */
+
+void *unrolledLinkedListDeleteFirstWtoFr(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    return unrolledLinkedListRemove(list, list->head, NULL, 0);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will delete and free the last item in the list.
+ *
+ * @param list the unrolled linked list address
+ */
+
+void unrolledLinkedListDeleteLast(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->freeFun(unrolledLinkedListDeleteAtIndexWtoFr(list, list->length - 1));
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will delete the last item in the list without freeing it, and it will return it.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the deleted item
+ */
+
+void *unrolledLinkedListDeleteLastWtoFr(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    return unrolledLinkedListDeleteAtIndexWtoFr(list, list->length - 1);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the index as a parameters,
+ * then it will delete and free the item in the passed index.
+ *
+ * @param list the unrolled linked list address
+ * @param index the index of the item
+ */
+
+void unrolledLinkedListDeleteAtIndex(UnrolledLinkedList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    } else if (index < 0 || index >= list->length) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "unrolled linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    list->freeFun(unrolledLinkedListDeleteAtIndexWtoFr(list, index));
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the index as a parameters,
+ * then it will delete the item in the passed index without freeing it, and it will return it.
+ *
+ * Note: if the node of the index becomes less than half full, then it will take items from the next node,
+ * or it will be merged with the next node if their items fit in one node.
+ *
+ * @param list the unrolled linked list address
+ * @param index the index of the item
+ * @return it will return the deleted item
+ */
+
+void *unrolledLinkedListDeleteAtIndexWtoFr(UnrolledLinkedList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    } else if (index < 0 || index >= list->length) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "unrolled linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    UnrolledNode *prevNode;
+    UnrolledNode *node = unrolledLinkedListFindNode(list, &index, &prevNode);
+
+    return unrolledLinkedListRemove(list, node, prevNode, index);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the item address as a parameters,
+ * then it will return one if the item is in the list, other wise it will return zero.
+ *
+ * @param list the unrolled linked list address
+ * @param item the item address
+ * @return it will return one if the item is in the list, other wise it will return zero
+ */
+
+int unrolledLinkedListContains(UnrolledLinkedList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return unrolledLinkedListGetIndex(list, item) != -1;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the item address as a parameters,
+ * then it will return the index of the first item that is equal to the passed item,
+ * other wise it will return minus one (-1).
+ *
+ * Note: the items of every node are compared in one contiguous array, so there is one pointer jump per node.
+ *
+ * @param list the unrolled linked list address
+ * @param item the item address
+ * @return it will return the item index if found, other wise it will return -1
+ */
+
+int unrolledLinkedListGetIndex(UnrolledLinkedList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int index = 0;
+
+    for (UnrolledNode *currentNode = list->head; currentNode != NULL; currentNode = currentNode->next) {
+        for (int i = 0; i < currentNode->count; i++) {
+            // if the comparator function returned zero then the two items are equal.
+            if (list->comparator(item, currentNode->items[i]) == 0)
+                return index + i;
+
+        }
+
+        index += currentNode->count;
+    }
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the item address as a parameters,
+ * then it will return the item from the list if found, other wise it will return NULL.
+ *
+ * @param list the unrolled linked list address
+ * @param item the item address
+ * @return it will return the item pointer if found, other wise it will return NULL
+ */
+
+void *unrolledLinkedListGetItem(UnrolledLinkedList *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    for (UnrolledNode *currentNode = list->head; currentNode != NULL; currentNode = currentNode->next) {
+        for (int i = 0; i < currentNode->count; i++) {
+            if (list->comparator(item, currentNode->items[i]) == 0)
+                return currentNode->items[i];
+
+        }
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will return the first item in the list.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the first item in the list
+ */
+
+void *unrolledLinkedListGetFirst(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    return list->head->items[0];
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will return the last item in the list.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the last item in the list
+ */
+
+void *unrolledLinkedListGetLast(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    return list->tail->items[list->tail->count - 1];
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will return a new array that contains the list items.
+ *
+ * Note: the array should be freed after using it, but the items in it shouldn't.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the items array
+ */
+
+void **unrolledLinkedListToArray(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void **array = (void **) malloc(sizeof(void *) * list->length);
+    if (array == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "to array", "unrolled linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    int index = 0;
+    for (UnrolledNode *currentNode = list->head; currentNode != NULL; currentNode = currentNode->next) {
+        memcpy(array + index, currentNode->items, sizeof(void *) * currentNode->count);
+        index += currentNode->count;
+    }
+
+    return array;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the index as a parameters,
+ * then it will return the item in the passed index.
+ *
+ * Note: the search skips a whole node in every step using the node items count,
+ * so it visits about (UNROLLED_LINKED_LIST_NODE_CAPACITY) times less nodes than the linked list.
+ *
+ * @param list the unrolled linked list address
+ * @param index the index of the item
+ * @return it will return the item in the passed index
+ */
+
+void *unrolledLinkedListGet(UnrolledLinkedList *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->length == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return NULL;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "unrolled linked list data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    } else if (index < 0 || index >= list->length) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "unrolled linked list data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    UnrolledNode *prevNode;
+    UnrolledNode *node = unrolledLinkedListFindNode(list, &index, &prevNode);
+
+    return node->items[index];
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will return the number of items in the list.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return the number of items in the list
+ */
+
+int unrolledLinkedListGetLength(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->length;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will return one if the list is empty, other wise it will return zero.
+ *
+ * @param list the unrolled linked list address
+ * @return it will return one if the list is empty, other wise it will return zero
+ */
+
+int unrolledLinkedListIsEmpty(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->length == 0;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the print function address as a parameters,
+ * then it will call the print function with every item in the list.
+ *
+ * @param list the unrolled linked list address
+ * @param printFun the print function address
+ */
+
+void printUnrolledLinkedList(UnrolledLinkedList *list, void (*printFun)(const void *)) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (printFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "print function pointer", "unrolled linked list data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (UnrolledNode *currentNode = list->head; currentNode != NULL; currentNode = currentNode->next) {
+        for (int i = 0; i < currentNode->count; i++)
+            printFun(currentNode->items[i]);
+
+    }
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will delete and free all the items from the list.
+ *
+ * Note: the nodes will be released at once by resetting the node pool.
+ *
+ * @param list the unrolled linked list address
+ */
+
+void unrolledLinkedListClear(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    for (UnrolledNode *currentNode = list->head; currentNode != NULL; currentNode = currentNode->next) {
+        for (int i = 0; i < currentNode->count; i++)
+            list->freeFun(currentNode->items[i]);
+
+    }
+
+    nodePoolReset(list->nodePool);
+
+    list->head = list->tail = NULL;
+    list->length = 0;
+    list->nodesCount = 0;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address as a parameter,
+ * then it will destroy and free the list, it's items, and it's nodes.
+ *
+ * @param list the unrolled linked list address
+ */
+
+void destroyUnrolledLinkedList(UnrolledLinkedList *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "unrolled linked list pointer", "unrolled linked list data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    unrolledLinkedListClear(list);
+    destroyNodePool(list->nodePool);
+    free(list);
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the previous node address as a parameters,
+ * then it will allocate a new empty node and link it after the previous node,
+ * or at the start of the list if the previous node is NULL.
+ *
+ * Note: this function should only be called from the unrolled linked list functions.
+ *
+ * @param list the unrolled linked list address
+ * @param prevNode the node that the new node will be linked after it
+ * @return it will return the new node address
+ */
+
+UnrolledNode *unrolledLinkedListNewNode(UnrolledLinkedList *list, UnrolledNode *prevNode) {
+    UnrolledNode *newNode = (UnrolledNode *) nodePoolAllocate(list->nodePool);
+    if (newNode == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "unrolled linked list data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    newNode->count = 0;
+
+    if (prevNode == NULL) {
+        newNode->next = list->head;
+        list->head = newNode;
+    } else {
+        newNode->next = prevNode->next;
+        prevNode->next = newNode;
+    }
+
+    if (newNode->next == NULL)
+        list->tail = newNode;
+
+    list->nodesCount++;
+
+    return newNode;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, the index address, and the previous node address as a parameters,
+ * then it will return the node that holds the index, and it will update the index to the item offset inside the node,
+ * and the previous node to the node before the returned node.
+ *
+ * Note: this function should only be called from the unrolled linked list functions, and the index should be in the list range.
+ *
+ * @param list the unrolled linked list address
+ * @param index the item index address
+ * @param prevNode the address that the previous node will be written in
+ * @return it will return the node that holds the index
+ */
+
+UnrolledNode *unrolledLinkedListFindNode(UnrolledLinkedList *list, int *index, UnrolledNode **prevNode) {
+    UnrolledNode *currentNode = list->head;
+    *prevNode = NULL;
+
+    while (*index >= currentNode->count) {
+        *index -= currentNode->count;
+        *prevNode = currentNode;
+        currentNode = currentNode->next;
+    }
+
+    return currentNode;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, the node address, the offset, and the item address as a parameters,
+ * then it will insert the item in the offset inside the node.
+ *
+ * Note: if the node is full, then the second half of it's items will be moved to a new node after it,
+ * and the item will be inserted in the half that holds the offset.
+ *
+ * Note: this function should only be called from the unrolled linked list functions.
+ *
+ * @param list the unrolled linked list address
+ * @param node the node address
+ * @param offset the item offset inside the node
+ * @param item the new item address
+ */
+
+void unrolledLinkedListInsert(UnrolledLinkedList *list, UnrolledNode *node, int offset, void *item) {
+    if (node->count == UNROLLED_LINKED_LIST_NODE_CAPACITY) {
+        UnrolledNode *newNode = unrolledLinkedListNewNode(list, node);
+        if (newNode == NULL)
+            return;
+
+        int half = UNROLLED_LINKED_LIST_NODE_CAPACITY / 2;
+        newNode->count = node->count - half;
+        memcpy(newNode->items, node->items + half, sizeof(void *) * newNode->count);
+        node->count = half;
+
+        if (offset > half) {
+            offset -= half;
+            node = newNode;
+        }
+
+    }
+
+    memmove(node->items + offset + 1, node->items + offset, sizeof(void *) * (node->count - offset));
+    node->items[offset] = item;
+    node->count++;
+    list->length++;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, the node address, the previous node address, and the offset as a parameters,
+ * then it will remove the item in the offset from the node, and it will return it.
+ *
+ * Note: if the node becomes empty it will be freed, and if it becomes less than half full it will be rebalanced with the next node.
+ *
+ * Note: this function should only be called from the unrolled linked list functions.
+ *
+ * @param list the unrolled linked list address
+ * @param node the node address
+ * @param prevNode the node before the node, or NULL if the node is the first node
+ * @param offset the item offset inside the node
+ * @return it will return the removed item
+ */
+
+void *unrolledLinkedListRemove(UnrolledLinkedList *list, UnrolledNode *node, UnrolledNode *prevNode, int offset) {
+    void *item = node->items[offset];
+
+    node->count--;
+    memmove(node->items + offset, node->items + offset + 1, sizeof(void *) * (node->count - offset));
+    list->length--;
+
+    if (node->count == 0) {
+        if (prevNode == NULL)
+            list->head = node->next;
+        else
+            prevNode->next = node->next;
+
+        if (list->tail == node)
+            list->tail = prevNode;
+
+        nodePoolFree(list->nodePool, node);
+        list->nodesCount--;
+    } else if (node->count < UNROLLED_LINKED_LIST_NODE_CAPACITY / 2 && node->next != NULL)
+        unrolledLinkedListRebalance(list, node);
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the unrolled linked list address, and the node address as a parameters,
+ * then it will merge the next node into the node if their items fit in one node,
+ * other wise it will move items from the start of the next node until the node becomes half full.
+ *
+ * Note: in the second case the next node had more than half of the node capacity,
+ * so it will stay at least half full after moving the items.
+ *
+ * Note: this function should only be called from the unrolled linked list functions.
+ *
+ * @param list the unrolled linked list address
+ * @param node the node address
+ */
+
+void unrolledLinkedListRebalance(UnrolledLinkedList *list, UnrolledNode *node) {
+    UnrolledNode *nextNode = node->next;
+
+    if (node->count + nextNode->count <= UNROLLED_LINKED_LIST_NODE_CAPACITY) {
+        memcpy(node->items + node->count, nextNode->items, sizeof(void *) * nextNode->count);
+        node->count += nextNode->count;
+
+        node->next = nextNode->next;
+        if (list->tail == nextNode)
+            list->tail = node;
+
+        nodePoolFree(list->nodePool, nextNode);
+        list->nodesCount--;
+    } else {
+        int movedCount = UNROLLED_LINKED_LIST_NODE_CAPACITY / 2 - node->count;
+
+        memcpy(node->items + node->count, nextNode->items, sizeof(void *) * movedCount);
+        node->count += movedCount;
+
+        nextNode->count -= movedCount;
+        memmove(nextNode->items, nextNode->items + movedCount, sizeof(void *) * nextNode->count);
+    }
+
+}
@@ -14,6 +14,10 @@ extern "C" {
 *  Member 'length' holds the current allocated length of the ArrayList.
 *  @var ArrayList::count
 *  Member 'count' holds the index to a free space to the next item.
+*  @var ArrayList::growthFactor
+*  Member 'growthFactor' holds the number that the allocated length will be multiplied by when the array list is full.
+*  @var ArrayList::maxGrowth
+*  Member 'maxGrowth' holds the maximum number of places that can be added in one growth, or zero if there is no limit.
 *  @var ArrayList::freeItem
 *  Member 'freeItem' the freeing item function pointer
 * @var ArrayList::comparator
@@ -24,6 +28,8 @@ typedef struct ArrayList {
     void **arr;
     int length;
     int count;
+    double growthFactor;
+    int maxGrowth;
     void (*freeItem)(void *);
     int (*comparator)(const void *, const void *);
 } ArrayList;
@@ -38,6 +44,16 @@ void arrayListAddAtIndex(ArrayList *list, void *item, int index);
 
 void arrayListAddAll(ArrayList *list, void **array, int arrayLength);
 
+void arrayListInsertRange(ArrayList *list, int index, void **array, int arrayLength);
+
+void arrayListReserve(ArrayList *list, int length);
+
+void arrayListShrinkToFit(ArrayList *list);
+
+void arrayListSetGrowthPolicy(ArrayList *list, double growthFactor, int maxGrowth);
+
+int arrayListGetCapacity(ArrayList *list);
+
 void arrayListRemove(ArrayList *list);
 
 void arrayListRemoveWtFr(ArrayList *list);
@@ -46,6 +62,14 @@ void arrayListRemoveAtIndex(ArrayList *list, int index);
 
 void arrayListRemoveAtIndexWtFr(ArrayList *list, int index);
 
+void arrayListRemoveRange(ArrayList *list, int start, int end);
+
+void arrayListRemoveRangeWtFr(ArrayList *list, int start, int end);
+
+int arrayListRemoveIf(ArrayList *list, int (*predicate)(const void *));
+
+int arrayListRemoveIfWtFr(ArrayList *list, int (*predicate)(const void *));
+
 int arrayListContains(ArrayList *list, void *item);
 
 int arrayListGetIndex(ArrayList *list, void *item);
@@ -60,6 +84,15 @@ void **arrayListToSubArray(ArrayList *list, int start, int end);
 
 void arrayListSort(ArrayList *list, int (*sortComp)(const void*, const void*));
 
+void arrayListParallelForEach(ArrayList *list, void (*action)(void *), int threadsCount);
+
+void arrayListParallelMap(ArrayList *list, void **output, void *(*mapFun)(const void *), int threadsCount);
+
+int arrayListParallelFilter(ArrayList *list, void **output, int (*predicate)(const void *), int threadsCount);
+
+void arrayListParallelReduce(ArrayList *list, void *result, int resultSize, void (*reduceFun)(void *, const void *),
+                             void (*combineFun)(void *, const void *), int threadsCount);
+
 int arrayListGetLength(ArrayList *list);
 
 int arrayListIsEmpty(ArrayList *list);
@@ -0,0 +1,62 @@
+#ifndef C_DATASTRUCTURES_GAPBUFFER_H
+#define C_DATASTRUCTURES_GAPBUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/** @struct GapBuffer
+*  @brief This structure implements a generic gap buffer list, that stores the items values inline
+*  around an empty gap, and the gap is moved lazily to the edit index,
+*  so the insertions and the deletions near the last edited index don't shift the whole tail.
+*  @var GapBuffer::arr
+*  Member 'arr' is a pointer to the items memory block, and every item takes elemSize bytes.
+*  @var GapBuffer::elemSize
+*  Member 'elemSize' holds the size of one item in bytes.
+*  @var GapBuffer::length
+*  Member 'length' holds the current allocated length of the buffer.
+*  @var GapBuffer::gapStart
+*  Member 'gapStart' holds the index of the first empty slot, and it's also the number of items before the gap.
+*  @var GapBuffer::gapEnd
+*  Member 'gapEnd' holds the index of the first item after the gap.
+*/
+
+typedef struct GapBuffer {
+    char *arr;
+    int elemSize;
+    int length;
+    int gapStart;
+    int gapEnd;
+} GapBuffer;
+
+GapBuffer *gapBufferInitialization(int elemSize, int initialLength);
+
+void gapBufferAdd(GapBuffer *buffer, const void *item);
+
+void gapBufferAddAtIndex(GapBuffer *buffer, int index, const void *item);
+
+void gapBufferAddArrayAtIndex(GapBuffer *buffer, int index, const void *items, int itemsCount);
+
+void gapBufferRemoveAtIndex(GapBuffer *buffer, int index);
+
+void gapBufferRemoveRange(GapBuffer *buffer, int startIndex, int endIndex);
+
+void *gapBufferGet(GapBuffer *buffer, int index);
+
+void *gapBufferGetArray(GapBuffer *buffer);
+
+int gapBufferGetLength(GapBuffer *buffer);
+
+int gapBufferIsEmpty(GapBuffer *buffer);
+
+void clearGapBuffer(GapBuffer *buffer);
+
+void destroyGapBuffer(GapBuffer *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_GAPBUFFER_H
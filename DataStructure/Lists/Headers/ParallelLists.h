@@ -0,0 +1,30 @@
+#ifndef C_DATASTRUCTURES_PARALLELLISTS_H
+#define C_DATASTRUCTURES_PARALLELLISTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * The data parallel operations that the vector and the array list functions use.
+ * Every operation splits the items range into (threadsCount) contiguous chunks,
+ * then it runs one chunk in the calling thread and every other chunk in a new thread.
+ *
+ * Note: these functions should only be called from the lists functions, because they don't check the parameters.
+ */
+
+void parallelListsForEach(void **arr, int count, void (*action)(void *), int threadsCount);
+
+void parallelListsMap(void **arr, int count, void **output, void *(*mapFun)(const void *), int threadsCount);
+
+int parallelListsFilter(void **arr, int count, void **output, int (*predicate)(const void *), int threadsCount);
+
+int parallelListsReduce(void **arr, int count, void *result, int resultSize, void (*reduceFun)(void *, const void *),
+                        void (*combineFun)(void *, const void *), int threadsCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_PARALLELLISTS_H
@@ -0,0 +1,69 @@
+#ifndef C_DATASTRUCTURES_SEGMENTEDVECTOR_H
+#define C_DATASTRUCTURES_SEGMENTEDVECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The length of the first chunk in the segmented vector, and every next chunk is double the previous one.
+#define SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH 16
+
+/// The maximum number of chunks, which is enough to hold more than the maximum int number of items.
+#define SEGMENTED_VECTOR_MAX_CHUNKS 28
+
+
+/** @struct SegmentedVector
+*  @brief This structure implements a generic vector that stores the items in geometrically growing chunks,
+*  so adding an item never moves the old items, and the items addresses stay stable until they are removed.
+*  @var SegmentedVector::chunks
+*  Member 'chunks' is an array of the chunks pointers, and the chunk number k has (SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH * 2 ^ k) items.
+*  @var SegmentedVector::chunksCount
+*  Member 'chunksCount' holds the number of the allocated chunks.
+*  @var SegmentedVector::count
+*  Member 'count' holds the number of items in the vector.
+*  @var SegmentedVector::freeItem
+*  Member 'freeItem' the freeing item function pointer
+*  @var SegmentedVector::comparator
+*  Member 'comparator' the items comparator function pointer
+*/
+
+typedef struct SegmentedVector {
+    void **chunks[SEGMENTED_VECTOR_MAX_CHUNKS];
+    int chunksCount;
+    int count;
+    void (*freeItem)(void *);
+    int (*comparator)(const void *, const void *);
+} SegmentedVector;
+
+SegmentedVector *segmentedVectorInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *));
+
+void segmentedVectorAdd(SegmentedVector *list, void *item);
+
+void segmentedVectorRemove(SegmentedVector *list);
+
+void segmentedVectorRemoveWtFr(SegmentedVector *list);
+
+void *segmentedVectorGet(SegmentedVector *list, int index);
+
+void **segmentedVectorGetItemAddress(SegmentedVector *list, int index);
+
+int segmentedVectorGetIndex(SegmentedVector *list, void *item);
+
+int segmentedVectorContains(SegmentedVector *list, void *item);
+
+int segmentedVectorGetLength(SegmentedVector *list);
+
+int segmentedVectorIsEmpty(SegmentedVector *list);
+
+void segmentedVectorShrinkToFit(SegmentedVector *list);
+
+void clearSegmentedVector(SegmentedVector *list);
+
+void destroySegmentedVector(SegmentedVector *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_SEGMENTEDVECTOR_H
@@ -0,0 +1,74 @@
+#ifndef C_DATASTRUCTURES_SMALLVECTOR_H
+#define C_DATASTRUCTURES_SMALLVECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The number of items that the small vector stores inside it's structure before it allocates a heap array.
+#define SMALL_VECTOR_INLINE_LENGTH 4
+
+
+/** @struct SmallVector
+*  @brief This structure implements a generic vector that stores the first few items inside the structure,
+*  and it allocates a heap array only when it has more than SMALL_VECTOR_INLINE_LENGTH items.
+*  The structure can be embedded inside another structure, so a short list doesn't need any allocation.
+*  @var SmallVector::heapItems
+*  Member 'heapItems' is a pointer to the heap items array, or NULL if the items are stored inline.
+*  @var SmallVector::inlineItems
+*  Member 'inlineItems' holds the items while they fit inside the structure.
+*  @var SmallVector::length
+*  Member 'length' holds the current allocated length of the vector.
+*  @var SmallVector::count
+*  Member 'count' holds the number of items in the vector.
+*  @var SmallVector::freeItem
+*  Member 'freeItem' the freeing item function pointer
+*  @var SmallVector::comparator
+*  Member 'comparator' the items comparator function pointer
+*/
+
+typedef struct SmallVector {
+    void **heapItems;
+    void *inlineItems[SMALL_VECTOR_INLINE_LENGTH];
+    int length;
+    int count;
+    void (*freeItem)(void *);
+    int (*comparator)(const void *, const void *);
+} SmallVector;
+
+SmallVector *smallVectorInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *));
+
+void smallVectorEmbeddedInitialization(SmallVector *list, void (*freeFun)(void *), int (*comparator)(const void *, const void *));
+
+void smallVectorAdd(SmallVector *list, void *item);
+
+void smallVectorRemove(SmallVector *list);
+
+void smallVectorRemoveWtFr(SmallVector *list);
+
+void smallVectorRemoveAtIndex(SmallVector *list, int index);
+
+void smallVectorRemoveAtIndexWtFr(SmallVector *list, int index);
+
+void *smallVectorGet(SmallVector *list, int index);
+
+int smallVectorGetIndex(SmallVector *list, void *item);
+
+int smallVectorContains(SmallVector *list, void *item);
+
+int smallVectorGetLength(SmallVector *list);
+
+int smallVectorIsEmpty(SmallVector *list);
+
+void clearSmallVector(SmallVector *list);
+
+void clearSmallVectorWtFr(SmallVector *list);
+
+void destroySmallVector(SmallVector *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_SMALLVECTOR_H
@@ -0,0 +1,65 @@
+#ifndef C_DATASTRUCTURES_VALUEVECTOR_H
+#define C_DATASTRUCTURES_VALUEVECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/** @struct ValueVector
+*  @brief This structure implements a generic vector that stores the items values inline,
+*  so the items are contiguous in one memory block, and there is no allocation or pointer per item.
+*  @var ValueVector::arr
+*  Member 'arr' is a pointer to the items memory block, and every item takes elemSize bytes.
+*  @var ValueVector::elemSize
+*  Member 'elemSize' holds the size of one item in bytes.
+*  @var ValueVector::length
+*  Member 'length' holds the current allocated length of the vector.
+*  @var ValueVector::count
+*  Member 'count' holds the number of items in the vector.
+*  @var ValueVector::comparator
+*  Member 'comparator' the items comparator function pointer
+*/
+
+typedef struct ValueVector {
+    char *arr;
+    int elemSize;
+    int length;
+    int count;
+    int (*comparator)(const void *, const void *);
+} ValueVector;
+
+ValueVector *valueVectorInitialization(int elemSize, int initialLength, int (*comparator)(const void *, const void *));
+
+void valueVectorPush(ValueVector *list, const void *item);
+
+void valueVectorPop(ValueVector *list, void *item);
+
+void valueVectorInsert(ValueVector *list, int index, const void *item);
+
+void valueVectorErase(ValueVector *list, int index);
+
+void *valueVectorGet(ValueVector *list, int index);
+
+void valueVectorSet(ValueVector *list, int index, const void *item);
+
+void *valueVectorGetArray(ValueVector *list);
+
+void valueVectorSort(ValueVector *list, int (*sortComp)(const void *, const void *));
+
+int valueVectorBinarySearch(ValueVector *list, const void *item);
+
+int valueVectorGetLength(ValueVector *list);
+
+int valueVectorIsEmpty(ValueVector *list);
+
+void clearValueVector(ValueVector *list);
+
+void destroyValueVector(ValueVector *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_VALUEVECTOR_H
@@ -15,6 +15,10 @@ extern "C" {
 *  Member 'length' holds the current allocated length of the vector.
 *  @var Vector::count
 *  Member 'count' holds the index to a free space to the next item.
+*  @var Vector::growthFactor
+*  Member 'growthFactor' holds the number that the allocated length will be multiplied by when the vector is full.
+*  @var Vector::maxGrowth
+*  Member 'maxGrowth' holds the maximum number of places that can be added in one growth, or zero if there is no limit.
 *  @var Vector::freeItem
 *  Member 'freeItem' the freeing item function pointer
  * @var Vector::comparator
@@ -25,6 +29,8 @@ typedef struct Vector {
     void **arr;
     int length;
     int count;
+    double growthFactor;
+    int maxGrowth;
     void (*freeItem)(void *);
     int (*comparator)(const void *, const void *);
 } Vector;
@@ -37,6 +43,16 @@ void vectorAddAtIndex(Vector *list, void *item, int index);
 
 void vectorAddAll(Vector *list, void **array, int arrayLength);
 
+void vectorInsertRange(Vector *list, int index, void **array, int arrayLength);
+
+void vectorReserve(Vector *list, int length);
+
+void vectorShrinkToFit(Vector *list);
+
+void vectorSetGrowthPolicy(Vector *list, double growthFactor, int maxGrowth);
+
+int vectorGetCapacity(Vector *list);
+
 void vectorRemove(Vector *list);
 
 void vectorRemoveWtFr(Vector *list);
@@ -45,6 +61,14 @@ void vectorRemoveAtIndex(Vector *list, int index);
 
 void vectorRemoveAtIndexWtFr(Vector *list, int index);
 
+void vectorRemoveRange(Vector *list, int start, int end);
+
+void vectorRemoveRangeWtFr(Vector *list, int start, int end);
+
+int vectorRemoveIf(Vector *list, int (*predicate)(const void *));
+
+int vectorRemoveIfWtFr(Vector *list, int (*predicate)(const void *));
+
 int vectorContains(Vector *list, void *item);
 
 int vectorGetIndex(Vector *list, void *item);
@@ -59,6 +83,15 @@ void **vectorToSubArray(Vector *list, int start, int end);
 
 void vectorSort(Vector *list, int (*sortComp)(const void*, const void*));
 
+void vectorParallelForEach(Vector *list, void (*action)(void *), int threadsCount);
+
+void vectorParallelMap(Vector *list, void **output, void *(*mapFun)(const void *), int threadsCount);
+
+int vectorParallelFilter(Vector *list, void **output, int (*predicate)(const void *), int threadsCount);
+
+void vectorParallelReduce(Vector *list, void *result, int resultSize, void (*reduceFun)(void *, const void *),
+                          void (*combineFun)(void *, const void *), int threadsCount);
+
 int vectorGetLength(Vector *list);
 
 int vectorIsEmpty(Vector *list);
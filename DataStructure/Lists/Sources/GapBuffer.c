@@ -0,0 +1,591 @@
+#include "../Headers/GapBuffer.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+int gapBufferItemsCount(GapBuffer *buffer);
+
+void gapBufferMoveGap(GapBuffer *buffer, int index);
+
+int gapBufferReserveGap(GapBuffer *buffer, int neededGap);
+
+
+
+
+
+/** This function will take the item size, and the initial length of the buffer as a parameters,
+ * then it will initialize a new gap buffer in the memory and set it's fields then return it.
+ *
+ * Note: the buffer copies the items values into it's memory, so the items should be plain fixed size values,
+ * and a buffer with one byte items can be used as a characters buffer for the strings.
+ *
+ * @param elemSize the size of one item in bytes
+ * @param initialLength the initial length of the buffer
+ * @return it will return the initialized buffer pointer
+ */
+
+GapBuffer *gapBufferInitialization(int elemSize, int initialLength) {
+    if (elemSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "element size", "gap buffer data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (initialLength <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "initial length", "gap buffer data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    GapBuffer *buffer = (GapBuffer *) malloc(sizeof(GapBuffer));
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "gap buffer data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    buffer->arr = (char *) malloc((size_t) elemSize * initialLength);
+    if (buffer->arr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(buffer);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "items memory", "gap buffer data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    buffer->elemSize = elemSize;
+    buffer->length = initialLength;
+    buffer->gapStart = 0;
+    buffer->gapEnd = initialLength;
+
+    return buffer;
+
+}
+
+
+
+
+
+/** This function will take the buffer address, and the item address as a parameters,
+ * then it will copy the item value to the end of the buffer.
+ *
+ * @param buffer the buffer address
+ * @param item the item address
+ */
+
+void gapBufferAdd(GapBuffer *buffer, const void *item) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    gapBufferAddAtIndex(buffer, gapBufferItemsCount(buffer), item);
+
+}
+
+
+
+
+
+/** This function will take the buffer address, the index, and the item address as a parameters,
+ * then it will move the gap to the index, and it will copy the item value into the start of the gap.
+ *
+ * Note: moving the gap only shifts the items between the last edit index and the new index,
+ * so adding near the last edit index doesn't shift the whole tail of the buffer.
+ *
+ * Note: the index can be equal to the buffer length, so the item will be added to the end of the buffer.
+ *
+ * @param buffer the buffer address
+ * @param index the index of the new item
+ * @param item the item address
+ */
+
+void gapBufferAddAtIndex(GapBuffer *buffer, int index, const void *item) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "gap buffer data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index > gapBufferItemsCount(buffer)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "gap buffer data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    if (!gapBufferReserveGap(buffer, 1))
+        return;
+
+    gapBufferMoveGap(buffer, index);
+    memcpy(buffer->arr + (size_t) buffer->gapStart * buffer->elemSize, item, buffer->elemSize);
+    buffer->gapStart++;
+
+}
+
+
+
+
+
+/** This function will take the buffer address, the index, the items array address, and the items count as a parameters,
+ * then it will move the gap to the index, and it will copy the items values into the start of the gap.
+ *
+ * Note: the index can be equal to the buffer length, so the items will be added to the end of the buffer.
+ *
+ * @param buffer the buffer address
+ * @param index the index of the first new item
+ * @param items the items array address
+ * @param itemsCount the number of the items in the array
+ */
+
+void gapBufferAddArrayAtIndex(GapBuffer *buffer, int index, const void *items, int itemsCount) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "gap buffer data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (itemsCount < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items count", "gap buffer data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index > gapBufferItemsCount(buffer)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "gap buffer data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    if (!gapBufferReserveGap(buffer, itemsCount))
+        return;
+
+    gapBufferMoveGap(buffer, index);
+    memcpy(buffer->arr + (size_t) buffer->gapStart * buffer->elemSize, items, (size_t) itemsCount * buffer->elemSize);
+    buffer->gapStart += itemsCount;
+
+}
+
+
+
+
+
+/** This function will take the buffer address, and the index as a parameters,
+ * then it will move the gap to the index, and it will remove the item by extending the gap over it.
+ *
+ * Note: if the index is out of the buffer range then the program will be terminated.
+ *
+ * @param buffer the buffer address
+ * @param index the index of the item that will be removed
+ */
+
+void gapBufferRemoveAtIndex(GapBuffer *buffer, int index) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= gapBufferItemsCount(buffer)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "gap buffer data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    gapBufferMoveGap(buffer, index);
+    buffer->gapEnd++;
+
+}
+
+
+
+
+
+/** This function will take the buffer address, the start index, and the end index as a parameters,
+ * then it will remove the items from the start index until the end index (the end index is excluded),
+ * by moving the gap to the start index and extending it over the removed items.
+ *
+ * Note: if the range is out of the buffer range then the program will be terminated.
+ *
+ * @param buffer the buffer address
+ * @param startIndex the index of the first removed item
+ * @param endIndex the index after the last removed item
+ */
+
+void gapBufferRemoveRange(GapBuffer *buffer, int startIndex, int endIndex) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (startIndex < 0 || startIndex > endIndex || endIndex > gapBufferItemsCount(buffer)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "gap buffer data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    gapBufferMoveGap(buffer, startIndex);
+    buffer->gapEnd += endIndex - startIndex;
+
+}
+
+
+
+
+
+/** This function will take the buffer address, and the index as a parameters,
+ * then it will return a pointer to the item value inside the buffer.
+ *
+ * Note: the returned pointer will not be valid after editing the buffer, because the items can be moved.
+ *
+ * Note: if the index is out of the buffer range then the program will be terminated.
+ *
+ * @param buffer the buffer address
+ * @param index the item index
+ * @return it will return a pointer to the item inside the buffer
+ */
+
+void *gapBufferGet(GapBuffer *buffer, int index) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= gapBufferItemsCount(buffer)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "gap buffer data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    if (index >= buffer->gapStart)
+        index += buffer->gapEnd - buffer->gapStart;
+
+    return buffer->arr + (size_t) index * buffer->elemSize;
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will move the gap to the end of the buffer, and it will return the items array,
+ * so the items will be contiguous and in order.
+ *
+ * Note: the returned array is the buffer memory, so it shouldn't be freed,
+ * and it will not be valid after editing the buffer.
+ *
+ * @param buffer the buffer address
+ * @return it will return the buffer items array
+ */
+
+void *gapBufferGetArray(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    gapBufferMoveGap(buffer, gapBufferItemsCount(buffer));
+
+    return buffer->arr;
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will return the number of items in the buffer.
+ *
+ * @param buffer the buffer address
+ * @return it will return the number of items in the buffer
+ */
+
+int gapBufferGetLength(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return gapBufferItemsCount(buffer);
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will return one if the buffer is empty, other wise it will return zero.
+ *
+ * @param buffer the buffer address
+ * @return it will return one if the buffer is empty, other wise it will return zero
+ */
+
+int gapBufferIsEmpty(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return gapBufferItemsCount(buffer) == 0;
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will remove all the buffer items.
+ *
+ * Note: the function will just clear the buffer, but it will not free the buffer memory.
+ *
+ * @param buffer the buffer address
+ */
+
+void clearGapBuffer(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    buffer->gapStart = 0;
+    buffer->gapEnd = buffer->length;
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will destroy and free the buffer and it's items memory.
+ *
+ * @param buffer the buffer address
+ */
+
+void destroyGapBuffer(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "buffer", "gap buffer data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(buffer->arr);
+    free(buffer);
+
+}
+
+
+
+
+
+/** This function will take the buffer address as a parameter,
+ * then it will return the number of items in the buffer, which is the buffer length without the gap.
+ *
+ * Note: this function should only be called from the gap buffer functions.
+ *
+ * @param buffer the buffer address
+ * @return it will return the number of items in the buffer
+ */
+
+int gapBufferItemsCount(GapBuffer *buffer) {
+    return buffer->length - (buffer->gapEnd - buffer->gapStart);
+}
+
+
+
+
+
+/** This function will take the buffer address, and the index as a parameters,
+ * then it will move the gap so it starts at the index,
+ * by shifting only the items between the current gap start and the index across the gap.
+ *
+ * Note: this function should only be called from the gap buffer functions.
+ *
+ * @param buffer the buffer address
+ * @param index the new gap start index
+ */
+
+void gapBufferMoveGap(GapBuffer *buffer, int index) {
+    int elemSize = buffer->elemSize;
+
+    if (index < buffer->gapStart) {
+        int movedCount = buffer->gapStart - index;
+        buffer->gapEnd -= movedCount;
+        memmove(buffer->arr + (size_t) buffer->gapEnd * elemSize, buffer->arr + (size_t) index * elemSize, (size_t) movedCount * elemSize);
+        buffer->gapStart = index;
+    } else if (index > buffer->gapStart) {
+        int movedCount = index - buffer->gapStart;
+        memmove(buffer->arr + (size_t) buffer->gapStart * elemSize, buffer->arr + (size_t) buffer->gapEnd * elemSize, (size_t) movedCount * elemSize);
+        buffer->gapStart = index;
+        buffer->gapEnd += movedCount;
+    }
+
+}
+
+
+
+
+
+/** This function will take the buffer address, and the needed gap length as a parameters,
+ * then it will double the buffer memory until the gap can hold the needed length,
+ * and it will shift the items after the gap to the end of the new memory,
+ * then it will return one if it succeeded, other wise it will return zero.
+ *
+ * Note: this function should only be called from the gap buffer functions.
+ *
+ * @param buffer the buffer address
+ * @param neededGap the number of items that the gap should be able to hold
+ * @return it will return one if the gap is big enough, other wise it will return zero
+ */
+
+int gapBufferReserveGap(GapBuffer *buffer, int neededGap) {
+    if (buffer->gapEnd - buffer->gapStart >= neededGap)
+        return 1;
+
+    int count = gapBufferItemsCount(buffer);
+    int newLength = buffer->length;
+    while (newLength - count < neededGap)
+        newLength *= 2;
+
+    char *newArr = (char *) realloc(buffer->arr, (size_t) newLength * buffer->elemSize);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return 0;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "gap buffer data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    int tailCount = buffer->length - buffer->gapEnd;
+    int newGapEnd = newLength - tailCount;
+    memmove(newArr + (size_t) newGapEnd * buffer->elemSize, newArr + (size_t) buffer->gapEnd * buffer->elemSize, (size_t) tailCount * buffer->elemSize);
+
+    buffer->arr = newArr;
+    buffer->length = newLength;
+    buffer->gapEnd = newGapEnd;
+
+    return 1;
+
+}
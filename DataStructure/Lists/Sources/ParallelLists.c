@@ -0,0 +1,403 @@
+#include "../Headers/ParallelLists.h"
+#include "../../../System/Utils.h"
+#include <pthread.h>
+
+
+
+/** @struct ParallelListsTask
+*  @brief This structure holds the work of one thread in a parallel lists operation.
+*  @var ParallelListsTask::arr
+*  Member 'arr' is a pointer to the list items array.
+*  @var ParallelListsTask::start
+*  Member 'start' holds the index of the first item in the task chunk.
+*  @var ParallelListsTask::end
+*  Member 'end' holds the index after the last item in the task chunk.
+*  @var ParallelListsTask::action
+*  Member 'action' the for each action function pointer
+*  @var ParallelListsTask::mapFun
+*  Member 'mapFun' the map function pointer
+*  @var ParallelListsTask::predicate
+*  Member 'predicate' the filter predicate function pointer
+*  @var ParallelListsTask::reduceFun
+*  Member 'reduceFun' the reduce function pointer
+*  @var ParallelListsTask::output
+*  Member 'output' is a pointer to the output array of the map and the filter operations.
+*  @var ParallelListsTask::outputCount
+*  Member 'outputCount' holds the number of items that the filter task wrote to the output array.
+*  @var ParallelListsTask::accumulator
+*  Member 'accumulator' is a pointer to the task partial result of the reduce operation.
+*/
+
+typedef struct ParallelListsTask {
+    void **arr;
+    int start;
+    int end;
+    void (*action)(void *);
+    void *(*mapFun)(const void *);
+    int (*predicate)(const void *);
+    void (*reduceFun)(void *, const void *);
+    void **output;
+    int outputCount;
+    void *accumulator;
+} ParallelListsTask;
+
+
+
+int parallelListsPrepareTasks(ParallelListsTask *tasks, void **arr, int count, int threadsCount);
+
+void parallelListsRun(ParallelListsTask *tasks, int tasksCount, void *(*worker)(void *));
+
+void *parallelListsForEachWorker(void *task);
+
+void *parallelListsMapWorker(void *task);
+
+void *parallelListsFilterWorker(void *task);
+
+void *parallelListsReduceWorker(void *task);
+
+
+
+
+
+/** This function will take the items array, the items count, the action function, and the threads count as a parameters,
+ * then it will call the action function with every item, using the provided number of threads.
+ *
+ * Note: the action function will be called from many threads at the same time, so it should only change the passed item.
+ *
+ * @param arr the items array
+ * @param count the number of items in the array
+ * @param action the function that will be called with every item
+ * @param threadsCount the number of threads
+ */
+
+void parallelListsForEach(void **arr, int count, void (*action)(void *), int threadsCount) {
+    ParallelListsTask *tasks = (ParallelListsTask *) malloc(sizeof(ParallelListsTask) * threadsCount);
+    if (tasks == NULL) {
+        for (int i = 0; i < count; i++)
+            action(arr[i]);
+
+        return;
+    }
+
+    int tasksCount = parallelListsPrepareTasks(tasks, arr, count, threadsCount);
+    for (int i = 0; i < tasksCount; i++)
+        tasks[i].action = action;
+
+    parallelListsRun(tasks, tasksCount, parallelListsForEachWorker);
+
+    free(tasks);
+
+}
+
+
+
+
+
+/** This function will take the items array, the items count, the output array, the map function, and the threads count as a parameters,
+ * then it will put the result of the map function of every item in the same index in the output array,
+ * using the provided number of threads.
+ *
+ * Note: the output array length should be bigger than or equal to the items count.
+ *
+ * @param arr the items array
+ * @param count the number of items in the array
+ * @param output the output array
+ * @param mapFun the function that will be called with every item, and it should return the item new value
+ * @param threadsCount the number of threads
+ */
+
+void parallelListsMap(void **arr, int count, void **output, void *(*mapFun)(const void *), int threadsCount) {
+    ParallelListsTask *tasks = (ParallelListsTask *) malloc(sizeof(ParallelListsTask) * threadsCount);
+    if (tasks == NULL) {
+        for (int i = 0; i < count; i++)
+            output[i] = mapFun(arr[i]);
+
+        return;
+    }
+
+    int tasksCount = parallelListsPrepareTasks(tasks, arr, count, threadsCount);
+    for (int i = 0; i < tasksCount; i++) {
+        tasks[i].mapFun = mapFun;
+        tasks[i].output = output;
+    }
+
+    parallelListsRun(tasks, tasksCount, parallelListsMapWorker);
+
+    free(tasks);
+
+}
+
+
+
+
+
+/** This function will take the items array, the items count, the output array, the predicate function, and the threads count as a parameters,
+ * then it will copy the items that the predicate returns a non zero value for into the output array,
+ * and it will return the number of the copied items.
+ *
+ * Note: every thread writes it's kept items at the start of it's own chunk range in the output array,
+ * then the chunks results are moved together, so the kept items will stay in the same order.
+ *
+ * Note: the output array length should be bigger than or equal to the items count.
+ *
+ * @param arr the items array
+ * @param count the number of items in the array
+ * @param output the output array
+ * @param predicate the function that will be called with every item, and it should return non zero if the item should be kept
+ * @param threadsCount the number of threads
+ * @return it will return the number of the items in the output array
+ */
+
+int parallelListsFilter(void **arr, int count, void **output, int (*predicate)(const void *), int threadsCount) {
+    ParallelListsTask *tasks = (ParallelListsTask *) malloc(sizeof(ParallelListsTask) * threadsCount);
+    if (tasks == NULL) {
+        int outputCount = 0;
+        for (int i = 0; i < count; i++) {
+            if (predicate(arr[i]))
+                output[outputCount++] = arr[i];
+        }
+
+        return outputCount;
+    }
+
+    int tasksCount = parallelListsPrepareTasks(tasks, arr, count, threadsCount);
+    for (int i = 0; i < tasksCount; i++) {
+        tasks[i].predicate = predicate;
+        tasks[i].output = output;
+    }
+
+    parallelListsRun(tasks, tasksCount, parallelListsFilterWorker);
+
+    int outputCount = 0;
+    for (int i = 0; i < tasksCount; i++) {
+        memmove(output + outputCount, output + tasks[i].start, sizeof(void *) * tasks[i].outputCount);
+        outputCount += tasks[i].outputCount;
+    }
+
+    free(tasks);
+
+    return outputCount;
+
+}
+
+
+
+
+
+/** This function will take the items array, the items count, the result address, the result size,
+ * the reduce and combine functions, and the threads count as a parameters,
+ * then it will reduce every chunk into a partial result that starts as a copy of the result initial value,
+ * and finally it will combine the partial results into the result in the chunks order.
+ *
+ * Note: the result should hold the identity value of the reduce operation before calling the function,
+ * and the combine function should be associative.
+ *
+ * @param arr the items array
+ * @param count the number of items in the array
+ * @param result the result address, that holds the initial value
+ * @param resultSize the size of the result in bytes
+ * @param reduceFun the function that will be called with a partial result and an item, to add the item to the partial result
+ * @param combineFun the function that will be called with the result and a partial result, to add the partial result to the result
+ * @param threadsCount the number of threads
+ * @return it will return one if the operation succeeded, other wise it will return zero
+ */
+
+int parallelListsReduce(void **arr, int count, void *result, int resultSize, void (*reduceFun)(void *, const void *),
+                        void (*combineFun)(void *, const void *), int threadsCount) {
+    ParallelListsTask *tasks = (ParallelListsTask *) malloc(sizeof(ParallelListsTask) * threadsCount);
+    char *accumulators = (char *) malloc((size_t) resultSize * threadsCount);
+    if (tasks == NULL || accumulators == NULL) {
+        free(tasks);
+        free(accumulators);
+        return 0;
+    }
+
+    int tasksCount = parallelListsPrepareTasks(tasks, arr, count, threadsCount);
+    for (int i = 0; i < tasksCount; i++) {
+        tasks[i].reduceFun = reduceFun;
+        tasks[i].accumulator = accumulators + (size_t) i * resultSize;
+        memcpy(tasks[i].accumulator, result, resultSize);
+    }
+
+    parallelListsRun(tasks, tasksCount, parallelListsReduceWorker);
+
+    for (int i = 0; i < tasksCount; i++)
+        combineFun(result, tasks[i].accumulator);
+
+    free(accumulators);
+    free(tasks);
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the tasks array, the items array, the items count, and the threads count as a parameters,
+ * then it will split the items range into contiguous chunks with almost equal lengths,
+ * and it will return the number of the prepared tasks.
+ *
+ * Note: the number of tasks will not be bigger than the number of items, so every task will have one item at least.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param tasks the tasks array
+ * @param arr the items array
+ * @param count the number of items in the array
+ * @param threadsCount the number of threads
+ * @return it will return the number of tasks
+ */
+
+int parallelListsPrepareTasks(ParallelListsTask *tasks, void **arr, int count, int threadsCount) {
+    int tasksCount = threadsCount < count ? threadsCount : count;
+
+    for (int i = 0; i < tasksCount; i++) {
+        memset(tasks + i, 0, sizeof(ParallelListsTask));
+        tasks[i].arr = arr;
+        tasks[i].start = (int) ((long long) count * i / tasksCount);
+        tasks[i].end = (int) ((long long) count * (i + 1) / tasksCount);
+    }
+
+    return tasksCount;
+
+}
+
+
+
+
+
+/** This function will take the tasks array, the tasks count, and the worker function as a parameters,
+ * then it will run the first task in the calling thread and every other task in a new thread,
+ * and it will wait until all the tasks are finished.
+ *
+ * Note: if a thread couldn't be created, then it's task will be run in the calling thread.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param tasks the tasks array
+ * @param tasksCount the number of tasks
+ * @param worker the worker function that will be called with every task
+ */
+
+void parallelListsRun(ParallelListsTask *tasks, int tasksCount, void *(*worker)(void *)) {
+    if (tasksCount == 0)
+        return;
+
+    pthread_t *threads = (pthread_t *) malloc(sizeof(pthread_t) * tasksCount);
+    char *started = (char *) calloc(tasksCount, sizeof(char));
+
+    for (int i = 1; i < tasksCount; i++) {
+        if (threads != NULL && started != NULL && pthread_create(threads + i, NULL, worker, tasks + i) == 0)
+            started[i] = 1;
+        else
+            worker(tasks + i);
+    }
+
+    worker(tasks);
+
+    for (int i = 1; i < tasksCount; i++) {
+        if (started != NULL && started[i])
+            pthread_join(threads[i], NULL);
+    }
+
+    free(started);
+    free(threads);
+
+}
+
+
+
+
+
+/** This function will take a task address as a parameter,
+ * then it will call the task action function with every item in the task chunk.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param task the task address
+ * @return it will return NULL
+ */
+
+void *parallelListsForEachWorker(void *task) {
+    ParallelListsTask *currentTask = (ParallelListsTask *) task;
+
+    for (int i = currentTask->start; i < currentTask->end; i++)
+        currentTask->action(currentTask->arr[i]);
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take a task address as a parameter,
+ * then it will put the result of the map function of every item in the task chunk into the output array.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param task the task address
+ * @return it will return NULL
+ */
+
+void *parallelListsMapWorker(void *task) {
+    ParallelListsTask *currentTask = (ParallelListsTask *) task;
+
+    for (int i = currentTask->start; i < currentTask->end; i++)
+        currentTask->output[i] = currentTask->mapFun(currentTask->arr[i]);
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take a task address as a parameter,
+ * then it will copy the kept items of the task chunk to the start of the chunk range in the output array.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param task the task address
+ * @return it will return NULL
+ */
+
+void *parallelListsFilterWorker(void *task) {
+    ParallelListsTask *currentTask = (ParallelListsTask *) task;
+    void **output = currentTask->output + currentTask->start;
+
+    for (int i = currentTask->start; i < currentTask->end; i++) {
+        if (currentTask->predicate(currentTask->arr[i]))
+            output[currentTask->outputCount++] = currentTask->arr[i];
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take a task address as a parameter,
+ * then it will reduce every item in the task chunk into the task partial result.
+ *
+ * Note: this function should only be called from the parallel lists functions.
+ *
+ * @param task the task address
+ * @return it will return NULL
+ */
+
+void *parallelListsReduceWorker(void *task) {
+    ParallelListsTask *currentTask = (ParallelListsTask *) task;
+
+    for (int i = currentTask->start; i < currentTask->end; i++)
+        currentTask->reduceFun(currentTask->accumulator, currentTask->arr[i]);
+
+    return NULL;
+
+}
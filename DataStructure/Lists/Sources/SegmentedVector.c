@@ -0,0 +1,611 @@
+#include "../Headers/SegmentedVector.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SEGMENTED_VECTOR_FLOOR_LOG2(number) (31 - __builtin_clz(number))
+#else
+    #define SEGMENTED_VECTOR_FLOOR_LOG2(number) segmentedVectorFloorLog2(number)
+#endif
+
+
+
+int segmentedVectorFloorLog2(unsigned int number);
+
+void **segmentedVectorSlot(SegmentedVector *list, int index);
+
+size_t segmentedVectorChunkLength(int chunkIndex);
+
+
+
+
+
+/** This function will take the freeing and comparator functions as a parameter,
+ * then it will initialize a new segmented vector in the memory and set it's fields then return it.
+ *
+ * Note: the chunks will be allocated only when they are needed, so the new vector doesn't allocate any items memory.
+ *
+ * @param freeFun the function address that will be called to free the vector items.
+ * @param comparator the comparator function address, that will be called to compare two items in the vector
+ * @return it will return the initialized vector pointer
+ */
+
+SegmentedVector *segmentedVectorInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *)) {
+    if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function", "segmented vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SegmentedVector *list = (SegmentedVector *) malloc(sizeof(SegmentedVector));
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "segmented vector data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    list->chunksCount = 0;
+    list->count = 0;
+    list->freeItem = freeFun;
+    list->comparator = comparator;
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item as a parameters,
+ * then it will put the item at the end of the vector.
+ *
+ * Note: if the last chunk is full then a new chunk that is double the last chunk length will be allocated,
+ * and the old items will not be copied or moved.
+ *
+ * @param list the vector address
+ * @param item the new item
+ */
+
+void segmentedVectorAdd(SegmentedVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "segmented vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int chunkIndex = SEGMENTED_VECTOR_FLOOR_LOG2((unsigned int) list->count / SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH + 1);
+
+    if (chunkIndex == list->chunksCount) {
+        void **newChunk = (void **) malloc(sizeof(void *) * segmentedVectorChunkLength(chunkIndex));
+        if (newChunk == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                return;
+            #else
+                fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "chunk memory", "segmented vector data structure");
+                exit(FAILED_ALLOCATION);
+            #endif
+
+        }
+
+        list->chunks[list->chunksCount++] = newChunk;
+    }
+
+    *segmentedVectorSlot(list, list->count++) = item;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove and free the last item in the vector.
+ *
+ * Note: the chunks memory will not be freed, so the vector can be filled again without allocating,
+ * and the unused chunks can be freed using the segmentedVectorShrinkToFit function.
+ *
+ * Note: if the vector is empty then the program will be terminated.
+ *
+ * @param list the vector address
+ */
+
+void segmentedVectorRemove(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->count == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "segmented vector data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->count--;
+    list->freeItem(*segmentedVectorSlot(list, list->count));
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove the last item in the vector without freeing it.
+ *
+ * Note: if the vector is empty then the program will be terminated.
+ *
+ * @param list the vector address
+ */
+
+void segmentedVectorRemoveWtFr(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->count == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "segmented vector data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->count--;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will return the item at the index.
+ *
+ * Note: the item chunk and offset are calculated directly from the index, so there is no search over the chunks.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @return it will return the item at the index
+ */
+
+void *segmentedVectorGet(SegmentedVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "segmented vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    return *segmentedVectorSlot(list, index);
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will return the address of the item slot inside the vector.
+ *
+ * Note: the slot address will stay valid while the item is in the vector,
+ * because adding new items never moves the old items.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @return it will return the address of the item slot
+ */
+
+void **segmentedVectorGetItemAddress(SegmentedVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "segmented vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    return segmentedVectorSlot(list, index);
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item as a parameters,
+ * then it will return the index of the first item that is equal to the passed item,
+ * other wise it will return minus one (-1).
+ *
+ * @param list the vector address
+ * @param item the item address
+ * @return it will return the item index if found, other wise it will return -1
+ */
+
+int segmentedVectorGetIndex(SegmentedVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "segmented vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int index = 0;
+
+    for (int i = 0; i < list->chunksCount && index < list->count; i++) {
+        void **chunk = list->chunks[i];
+        size_t chunkLength = segmentedVectorChunkLength(i);
+
+        for (size_t j = 0; j < chunkLength && index < list->count; j++, index++) {
+            if (list->comparator(item, chunk[j]) == 0)
+                return index;
+        }
+
+    }
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item as a parameters,
+ * then it will return one if the item is in the vector, other wise it will return zero.
+ *
+ * @param list the vector address
+ * @param item the item address
+ * @return it will return one if the item is in the vector, other wise it will return zero
+ */
+
+int segmentedVectorContains(SegmentedVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "segmented vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return segmentedVectorGetIndex(list, item) != -1;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return the number of items in the vector.
+ *
+ * @param list the vector address
+ * @return it will return the number of items in the vector
+ */
+
+int segmentedVectorGetLength(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return one if the vector is empty, other wise it will return zero.
+ *
+ * @param list the vector address
+ * @return it will return one if the vector is empty, other wise it will return zero
+ */
+
+int segmentedVectorIsEmpty(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count == 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will free the chunks that doesn't hold any items.
+ *
+ * Note: the chunks that hold items will not be freed or moved, so the items addresses will stay valid.
+ *
+ * @param list the vector address
+ */
+
+void segmentedVectorShrinkToFit(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int neededChunks = list->count == 0 ? 0 : SEGMENTED_VECTOR_FLOOR_LOG2((unsigned int) (list->count - 1) / SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH + 1) + 1;
+
+    while (list->chunksCount > neededChunks)
+        free(list->chunks[--list->chunksCount]);
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove and free all the vector items.
+ *
+ * Note: the function will just clear the vector, but it will not free the chunks memory.
+ *
+ * @param list the vector address
+ */
+
+void clearSegmentedVector(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int index = 0;
+
+    for (int i = 0; i < list->chunksCount && index < list->count; i++) {
+        void **chunk = list->chunks[i];
+        size_t chunkLength = segmentedVectorChunkLength(i);
+
+        for (size_t j = 0; j < chunkLength && index < list->count; j++, index++)
+            list->freeItem(chunk[j]);
+
+    }
+
+    list->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will destroy and free the vector, it's items, and it's chunks.
+ *
+ * @param list the vector address
+ */
+
+void destroySegmentedVector(SegmentedVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "segmented vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearSegmentedVector(list);
+
+    for (int i = 0; i < list->chunksCount; i++)
+        free(list->chunks[i]);
+
+    free(list);
+
+}
+
+
+
+
+
+/** This function will take a positive number as a parameter,
+ * then it will return the index of it's highest set bit, which is the floor of it's logarithm to the base two.
+ *
+ * Note: this function should only be called from the segmented vector functions,
+ * and it's only used when the compiler doesn't provide the count leading zeros builtin function.
+ *
+ * @param number the positive number
+ * @return it will return the floor of the number logarithm to the base two
+ */
+
+int segmentedVectorFloorLog2(unsigned int number) {
+    int log = 0;
+
+    while (number >>= 1)
+        log++;
+
+    return log;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will calculate the chunk and the offset of the index, and it will return the item slot address.
+ *
+ * Note: the chunk number k starts at the index (SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH * (2 ^ k - 1)),
+ * so the chunk of the index is the floor of log2(index / SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH + 1).
+ *
+ * Note: this function should only be called from the segmented vector functions.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @return it will return the item slot address
+ */
+
+void **segmentedVectorSlot(SegmentedVector *list, int index) {
+    int chunkIndex = SEGMENTED_VECTOR_FLOOR_LOG2((unsigned int) index / SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH + 1);
+    size_t offset = (size_t) index - (segmentedVectorChunkLength(chunkIndex) - SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH);
+
+    return list->chunks[chunkIndex] + offset;
+
+}
+
+
+
+
+
+/** This function will take the chunk index as a parameter,
+ * then it will return the number of items that the chunk can hold.
+ *
+ * Note: this function should only be called from the segmented vector functions.
+ *
+ * @param chunkIndex the chunk index
+ * @return it will return the chunk length
+ */
+
+size_t segmentedVectorChunkLength(int chunkIndex) {
+    return (size_t) SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH << chunkIndex;
+}
@@ -0,0 +1,645 @@
+#include "../Headers/SmallVector.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+void **smallVectorItems(SmallVector *list);
+
+int smallVectorGrow(SmallVector *list);
+
+
+
+
+
+
+/** This function will take the freeing and comparator functions as a parameters,
+ * then it will allocate a new small vector and initialize it, and it will return it's address.
+ *
+ * Note: the vector header holds the first SMALL_VECTOR_INLINE_LENGTH items, so only one allocation is needed for a short list.
+ *
+ * @param freeFun the function address that will be called to free the vector items
+ * @param comparator the comparator function address, that will be called to compare two items in the vector
+ * @return it will return the initialized vector pointer
+ */
+
+SmallVector *smallVectorInitialization(void (*freeFun)(void *), int (*comparator)(const void *, const void *)) {
+    if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function", "small vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SmallVector *list = (SmallVector *) malloc(sizeof(SmallVector));
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "small vector data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    smallVectorEmbeddedInitialization(list, freeFun, comparator);
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take a small vector address, and the freeing and comparator functions as a parameters,
+ * then it will initialize the vector that the address points to, without allocating anything.
+ *
+ * Note: this function is useful when the vector is a member of another structure,
+ * and the vector should be cleared by the clear function instead of the destroy function.
+ *
+ * @param list the vector address
+ * @param freeFun the function address that will be called to free the vector items
+ * @param comparator the comparator function address, that will be called to compare two items in the vector
+ */
+
+void smallVectorEmbeddedInitialization(SmallVector *list, void (*freeFun)(void *), int (*comparator)(const void *, const void *)) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function", "small vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    list->heapItems = NULL;
+    list->length = SMALL_VECTOR_INLINE_LENGTH;
+    list->count = 0;
+    list->freeItem = freeFun;
+    list->comparator = comparator;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item address as a parameters,
+ * then it will put the item in the end of the vector.
+ *
+ * Note: the items will be moved to a heap array when the inline places are full.
+ *
+ * @param list the vector address
+ * @param item the item address
+ */
+
+void smallVectorAdd(SmallVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "small vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (list->count == list->length && !smallVectorGrow(list))
+        return;
+
+    smallVectorItems(list)[list->count++] = item;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove the last item in the vector.
+ *
+ * Note: if the vector is empty then the program will be terminated.
+ *
+ * @param list the vector address
+ */
+
+void smallVectorRemove(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->count == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "small vector data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->count--;
+    list->freeItem(smallVectorItems(list)[list->count]);
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove the last item in the vector, without freeing the item.
+ *
+ * Note: if the vector is empty then the program will be terminated.
+ *
+ * @param list the vector address
+ */
+
+void smallVectorRemoveWtFr(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->count == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "small vector data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->count--;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will remove the item in the given index from the vector.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the index of the item that will be deleted
+ */
+
+void smallVectorRemoveAtIndex(SmallVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "small vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    void **items = smallVectorItems(list);
+    list->freeItem(items[index]);
+    list->count--;
+
+    memmove(items + index, items + index + 1, sizeof(void *) * (list->count - index));
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will remove the item in the given index from the vector, without freeing the item.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the index of the item that will be deleted
+ */
+
+void smallVectorRemoveAtIndexWtFr(SmallVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "small vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    void **items = smallVectorItems(list);
+    list->count--;
+
+    memmove(items + index, items + index + 1, sizeof(void *) * (list->count - index));
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will return the item at the index.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @return it will return a void pointer to the item
+ */
+
+void *smallVectorGet(SmallVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "small vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    return smallVectorItems(list)[index];
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item address as a parameters,
+ * then it will return the index of the item if found, other wise it will return minus one (-1).
+ *
+ * Note: comparator function should return zero (0) when the two items are equal.
+ *
+ * @param list the vector address
+ * @param item the item address that will be searched for
+ * @return it will return the item index if found, other wise it will return minus one
+ */
+
+int smallVectorGetIndex(SmallVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "small vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void **items = smallVectorItems(list);
+    for (int i = 0; i < list->count; i++) {
+        if (list->comparator(item, items[i]) == 0)
+            return i;
+
+    }
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item address as a parameters,
+ * then it will return one (1) if the item is in the vector, other wise it will return zero (0).
+ *
+ * Note: comparator function should return zero (0) when the two items are equal.
+ *
+ * @param list the vector address
+ * @param item the item address
+ * @return it will return one if the item is in the vector other wise it will return zero
+ */
+
+int smallVectorContains(SmallVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return 0;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "small vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return smallVectorGetIndex(list, item) != -1;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return the number of items in the vector.
+ *
+ * @param list the vector address
+ * @return it will return the number of items in the vector
+ */
+
+int smallVectorGetLength(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return one if the vector is empty, other wise it will return zero.
+ *
+ * @param list the vector address
+ * @return it will return one if the vector is empty, other wise it will return zero
+ */
+
+int smallVectorIsEmpty(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count == 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove all the vector items and free them, and it will free the heap array if there is one.
+ *
+ * Note: the function will just clear the vector, but it will not free the vector structure,
+ * so it's the function that should be used with an embedded vector.
+ *
+ * @param list the vector address
+ */
+
+void clearSmallVector(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void **items = smallVectorItems(list);
+    for (int i = 0; i < list->count; i++)
+        list->freeItem(items[i]);
+
+    free(list->heapItems);
+    list->heapItems = NULL;
+    list->length = SMALL_VECTOR_INLINE_LENGTH;
+    list->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove all the vector items, without freeing them, and it will free the heap array if there is one.
+ *
+ * Note: the function will just clear the vector, but it will not free the vector structure,
+ * so it's the function that should be used with an embedded vector.
+ *
+ * @param list the vector address
+ */
+
+void clearSmallVectorWtFr(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(list->heapItems);
+    list->heapItems = NULL;
+    list->length = SMALL_VECTOR_INLINE_LENGTH;
+    list->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will destroy and free the vector and all it's items.
+ *
+ * Note: this function should be used only with a vector that was allocated by the initialization function.
+ *
+ * @param list the vector address
+ */
+
+void destroySmallVector(SmallVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "small vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearSmallVector(list);
+    free(list);
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return the array that currently holds the items, the inline array or the heap array.
+ *
+ * Note: this function should only be called from the small vector functions.
+ *
+ * @param list the vector address
+ * @return it will return the items array
+ */
+
+void **smallVectorItems(SmallVector *list) {
+    return list->heapItems != NULL ? list->heapItems : list->inlineItems;
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will double the vector length, and it will move the inline items to the heap array in the first growth,
+ * and it will return one if it succeeded, other wise it will return zero.
+ *
+ * Note: this function should only be called from the small vector functions.
+ *
+ * @param list the vector address
+ * @return it will return one if the vector was grown, other wise it will return zero
+ */
+
+int smallVectorGrow(SmallVector *list) {
+    int newLength = list->length * 2;
+    void **newItems = (void **) realloc(list->heapItems, sizeof(void *) * newLength);
+    if (newItems == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return 0;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "small vector data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    if (list->heapItems == NULL)
+        memcpy(newItems, list->inlineItems, sizeof(void *) * list->count);
+
+    list->heapItems = newItems;
+    list->length = newLength;
+
+    return 1;
+
+}
@@ -0,0 +1,669 @@
+#include "../Headers/ValueVector.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+int valueVectorGrow(ValueVector *list, int neededLength);
+
+int valueVectorGrowKeepingItem(ValueVector *list, const void **item);
+
+
+
+
+
+/** This function will take the item size, the initial length of the vector, and the comparator function as a parameters,
+ * then it will initialize a new value vector in the memory and set it's fields then return it.
+ *
+ * Note: the vector copies the items values into it's memory, so the items should be plain fixed size values,
+ * and there is no freeing function because the vector owns the copies.
+ *
+ * Note: the comparator function can be NULL if the binary search will not be used.
+ *
+ * @param elemSize the size of one item in bytes
+ * @param initialLength the initial length of the vector
+ * @param comparator the comparator function address, that will be called to compare two items in the vector
+ * @return it will return the initialized vector pointer
+ */
+
+ValueVector *valueVectorInitialization(int elemSize, int initialLength, int (*comparator)(const void *, const void *)) {
+    if (elemSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "element size", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (initialLength <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "initial length", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    ValueVector *list = (ValueVector *) malloc(sizeof(ValueVector));
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "value vector data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    list->arr = (char *) malloc((size_t) elemSize * initialLength);
+    if (list->arr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(list);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "items memory", "value vector data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    list->elemSize = elemSize;
+    list->length = initialLength;
+    list->count = 0;
+    list->comparator = comparator;
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item address as a parameters,
+ * then it will copy the item value to the end of the vector.
+ *
+ * Note: the item address can point to one of the vector items.
+ *
+ * @param list the vector address
+ * @param item the item address
+ */
+
+void valueVectorPush(ValueVector *list, const void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (list->count == list->length && !valueVectorGrowKeepingItem(list, &item))
+        return;
+
+    memcpy(list->arr + (size_t) list->count * list->elemSize, item, list->elemSize);
+    list->count++;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and an item address as a parameters,
+ * then it will remove the last item in the vector, and it will copy it's value into the passed item address.
+ *
+ * Note: the item address can be NULL if the value isn't needed.
+ *
+ * Note: if the vector is empty then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param item the address that the removed item value will be copied to, or NULL
+ */
+
+void valueVectorPop(ValueVector *list, void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (list->count == 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = EMPTY_DATA_STRUCTURE;
+            return;
+        #else
+            fprintf(stderr, EMPTY_DATA_STRUCTURE_MESSAGE, "value vector data structure");
+            exit(EMPTY_DATA_STRUCTURE);
+        #endif
+
+    }
+
+    list->count--;
+    if (item != NULL)
+        memcpy(item, list->arr + (size_t) list->count * list->elemSize, list->elemSize);
+
+}
+
+
+
+
+
+/** This function will take the vector address, the index, and the item address as a parameters,
+ * then it will copy the item value into the provided index, and it will shift the following items one step forward.
+ *
+ * Note: the index can be equal to the vector length, so the item will be added to the end of the vector.
+ *
+ * Note: the item address can point to one of the vector items.
+ *
+ * @param list the vector address
+ * @param index the index of the new item
+ * @param item the item address
+ */
+
+void valueVectorInsert(ValueVector *list, int index, const void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index > list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "value vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    if (list->count == list->length && !valueVectorGrowKeepingItem(list, &item))
+        return;
+
+    char *position = list->arr + (size_t) index * list->elemSize;
+    memmove(position + list->elemSize, position, (size_t) (list->count - index) * list->elemSize);
+
+    // if the item is one of the moved items, then it's now one step forward.
+    const char *itemBytes = (const char *) item;
+    if (itemBytes >= position && itemBytes < list->arr + (size_t) list->count * list->elemSize)
+        item = itemBytes + list->elemSize;
+
+    memcpy(position, item, list->elemSize);
+    list->count++;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will remove the item at the index, and it will shift the following items one step back.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the index of the item that will be removed
+ */
+
+void valueVectorErase(ValueVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "value vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    char *position = list->arr + (size_t) index * list->elemSize;
+    memmove(position, position + list->elemSize, (size_t) (list->count - index - 1) * list->elemSize);
+    list->count--;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will return a pointer to the item value inside the vector.
+ *
+ * Note: the returned pointer will not be valid after adding to the vector, because the vector memory can be moved.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @return it will return a pointer to the item inside the vector
+ */
+
+void *valueVectorGet(ValueVector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return NULL;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "value vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    return list->arr + (size_t) index * list->elemSize;
+
+}
+
+
+
+
+
+/** This function will take the vector address, the index, and the item address as a parameters,
+ * then it will copy the item value over the item at the index.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the item index
+ * @param item the new item address
+ */
+
+void valueVectorSet(ValueVector *list, int index, const void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index >= list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "value vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    memmove(list->arr + (size_t) index * list->elemSize, item, list->elemSize);
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return a pointer to the first item, so the items can be scanned as a normal array.
+ *
+ * Note: the returned pointer will not be valid after adding to the vector, because the vector memory can be moved.
+ *
+ * @param list the vector address
+ * @return it will return a pointer to the vector items array
+ */
+
+void *valueVectorGetArray(ValueVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->arr;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the sort comparator function as a parameter,
+ * then it will sort the vector using qsort algorithm.
+ *
+ * Note: the pointers that will be sent to the sort comparator function will point to the items values directly.
+ *
+ * Example of comparator function if the items are integers:
+ *
+ * int comp(const void *item1, const void *item2) { return *(int *) item1 - *(int *) item2; }
+ *
+ * @param list the vector address
+ * @param sortComp the sort comparator function address
+ */
+
+void valueVectorSort(ValueVector *list, int (*sortComp)(const void *, const void *)) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (sortComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "sort comparator function", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    qsort(list->arr, list->count, list->elemSize, sortComp);
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the item address as a parameters,
+ * then it will search for the item using the binary search algorithm and the vector comparator function,
+ * and it will return the item index if found, other wise it will return minus one (-1).
+ *
+ * Note: the vector must be sorted by an order that matches the vector comparator function.
+ *
+ * @param list the vector address
+ * @param item the item address that will be searched for
+ * @return it will return the item index if found, other wise it will return minus one
+ */
+
+int valueVectorBinarySearch(ValueVector *list, const void *item) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "value vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (list->comparator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "comparator function", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int fIndex = 0, lIndex = list->count - 1;
+    while (fIndex <= lIndex) {
+        int middleIndex = fIndex + (lIndex - fIndex) / 2;
+        int compareResult = list->comparator(item, list->arr + (size_t) middleIndex * list->elemSize);
+
+        if (compareResult == 0)
+            return middleIndex;
+        else if (compareResult < 0)
+            lIndex = middleIndex - 1;
+        else
+            fIndex = middleIndex + 1;
+
+    }
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return the number of items in the vector.
+ *
+ * @param list the vector address
+ * @return it will return the number of items in the vector
+ */
+
+int valueVectorGetLength(ValueVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return one if the vector is empty, other wise it will return zero.
+ *
+ * @param list the vector address
+ * @return it will return one if the vector is empty, other wise it will return zero
+ */
+
+int valueVectorIsEmpty(ValueVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->count == 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will remove all the vector items.
+ *
+ * Note: the function will just clear the vector, but it will not free the vector memory.
+ *
+ * @param list the vector address
+ */
+
+void clearValueVector(ValueVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    list->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will destroy and free the vector and it's items memory.
+ *
+ * @param list the vector address
+ */
+
+void destroyValueVector(ValueVector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "value vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(list->arr);
+    free(list);
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the needed length as a parameters,
+ * then it will double the vector memory until it can hold the needed length,
+ * and it will return one if it succeeded, other wise it will return zero.
+ *
+ * Note: this function should only be called from the value vector functions.
+ *
+ * @param list the vector address
+ * @param neededLength the number of items that the vector should be able to hold
+ * @return it will return one if the memory was grown, other wise it will return zero
+ */
+
+int valueVectorGrow(ValueVector *list, int neededLength) {
+    int newLength = list->length;
+    while (newLength < neededLength)
+        newLength *= 2;
+
+    char *newArr = (char *) realloc(list->arr, (size_t) newLength * list->elemSize);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return 0;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "value vector data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    list->arr = newArr;
+    list->length = newLength;
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and the address of the item pointer as a parameters,
+ * then it will grow the vector memory by one item, and if the item is one of the vector items,
+ * the function will update the item pointer to the item new address.
+ *
+ * Note: this function should only be called from the value vector functions.
+ *
+ * @param list the vector address
+ * @param item the address of the item pointer
+ * @return it will return one if the memory was grown, other wise it will return zero
+ */
+
+int valueVectorGrowKeepingItem(ValueVector *list, const void **item) {
+    const char *itemBytes = (const char *) *item;
+    int isVectorItem = itemBytes >= list->arr && itemBytes < list->arr + (size_t) list->count * list->elemSize;
+    size_t itemOffset = isVectorItem ? (size_t) (itemBytes - list->arr) : 0;
+
+    if (!valueVectorGrow(list, list->count + 1))
+        return 0;
+
+    if (isVectorItem)
+        *item = list->arr + itemOffset;
+
+    return 1;
+
+}
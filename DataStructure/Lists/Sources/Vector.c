@@ -1,6 +1,12 @@
 #include "../Headers/Vector.h"
 #include "../../../System/Utils.h"
+#include "../Headers/ParallelLists.h"
 #include "../../../Unit Test/CuTest/CuTest.h"
+#include <math.h>
+
+
+
+int vectorGrow(Vector *list, int neededLength);
 
 
 
@@ -63,6 +69,8 @@ Vector *vectorInitialization(int initialLength, void (*freeFun)(void *), int (*c
 
     list->length = initialLength > 0 ? initialLength : 1;
     list->count = 0;
+    list->growthFactor = 2.0;
+    list->maxGrowth = 0;
     list->freeItem = freeFun;
     list->comparator = comparator;
 
@@ -101,22 +109,8 @@ void vectorAdd(Vector *list, void *item) {
 
     }
 
-    if (list->count == list->length) {
-        list->length *= 2;
-
-        list->arr = (void **) realloc(list->arr, sizeof(void *) * list->length);
-        if (list->arr == NULL) {
-            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		    ERROR_TEST->errorCode = FAILED_REALLOCATION;
-                return;
-            #else
-                fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "vector data structure");
-     		    exit(FAILED_REALLOCATION);
-     	    #endif
-
-        }
-
-    }
+    if (list->count == list->length && !vectorGrow(list, list->count + 1))
+        return;
 
 
     list->arr[list->count++] = item;
@@ -168,26 +162,12 @@ void vectorAddAtIndex(Vector *list, void *item, int index) {
 
     }
 
-    if (list->count == list->length) {
-        list->length *= 2;
+    if (list->count == list->length && !vectorGrow(list, list->count + 1))
+        return;
 
-        list->arr = (void **) realloc(list->arr, sizeof(void *) * list->length);
-        if (list->arr == NULL) {
-            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		    ERROR_TEST->errorCode = FAILED_REALLOCATION;
-     		    return;
-            #else
-                fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "vector data structure");
-     		    exit(FAILED_REALLOCATION);
-     	    #endif
-
-        }
-
-    }
 
-
-    for (int i = list->count++; i > index; i--)
-        list->arr[i] = list->arr[i - 1];
+    memmove(list->arr + index + 1, list->arr + index, sizeof(void *) * (list->count - index));
+    list->count++;
 
 
     list->arr[index] = item;
@@ -204,6 +184,8 @@ void vectorAddAtIndex(Vector *list, void *item, int index) {
 /** This function will take the vector address, the items array, and the length of items array as a parameters,
  * then it will copy the items array into the vector.
  *
+ * Note: the vector memory will be grown one time to fit all the items, and if one of the items is NULL nothing will be added.
+ *
  * @param list the vector address
  * @param array the array address that will be inserted in the vector
  * @param arrayLength the length of the array that will be added
@@ -230,8 +212,278 @@ void vectorAddAll(Vector *list, void **array, int arrayLength) {
 
     }
 
-    for (int i = 0; i < arrayLength; i++)
-        vectorAdd(list, array[i]);
+    if (arrayLength <= 0)
+        return;
+
+    for (int i = 0; i < arrayLength; i++) {
+        if (array[i] == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = INVALID_ARG;
+                return;
+            #else
+                fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "vector data structure");
+                exit(INVALID_ARG);
+            #endif
+
+        }
+
+    }
+
+    // the list grows one time only, so adding a big array doesn't reallocate log(n) times.
+    if (list->count + arrayLength > list->length && !vectorGrow(list, list->count + arrayLength))
+        return;
+
+    memcpy(list->arr + list->count, array, sizeof(void *) * arrayLength);
+    list->count += arrayLength;
+
+}
+
+
+
+
+
+/** This function will take the vector address, the index, the items array, and the length of the items array as a parameters,
+ * then it will insert the items array at the provided index, and it will shift the following items to the right.
+ *
+ * Note: the index can be equal to the vector length, so the items will be added to the end of the vector.
+ *
+ * Note: the following items will be shifted one time by the whole array length, and if one of the items is NULL nothing will be added.
+ *
+ * @param list the vector address
+ * @param index the index of the first inserted item
+ * @param array the array address that will be inserted in the vector
+ * @param arrayLength the length of the array that will be inserted
+ */
+
+void vectorInsertRange(Vector *list, int index, void **array, int arrayLength) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (array == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (index < 0 || index > list->count) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    if (arrayLength <= 0)
+        return;
+
+    for (int i = 0; i < arrayLength; i++) {
+        if (array[i] == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = INVALID_ARG;
+                return;
+            #else
+                fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "vector data structure");
+                exit(INVALID_ARG);
+            #endif
+
+        }
+
+    }
+
+    if (list->count + arrayLength > list->length && !vectorGrow(list, list->count + arrayLength))
+        return;
+
+    memmove(list->arr + index + arrayLength, list->arr + index, sizeof(void *) * (list->count - index));
+    memcpy(list->arr + index, array, sizeof(void *) * arrayLength);
+    list->count += arrayLength;
+
+}
+
+
+
+
+
+/** This function will take the vector address, and a length as a parameters,
+ * then it will grow the vector allocated memory to be able to hold the passed length without any more reallocation.
+ *
+ * Note: if the vector can already hold the passed length, nothing will change.
+ *
+ * @param list the vector address
+ * @param length the number of items that the vector should be able to hold
+ */
+
+void vectorReserve(Vector *list, int length) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "length", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (length <= list->length)
+        return;
+
+    void **newArr = (void **) realloc(list->arr, sizeof(void *) * length);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "vector data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    list->arr = newArr;
+    list->length = length;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will shrink the vector allocated memory to fit the current items only.
+ *
+ * @param list the vector address
+ */
+
+void vectorShrinkToFit(Vector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int newLength = list->count > 0 ? list->count : 1;
+    if (newLength == list->length)
+        return;
+
+    void **newArr = (void **) realloc(list->arr, sizeof(void *) * newLength);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "vector data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    list->arr = newArr;
+    list->length = newLength;
+
+}
+
+
+
+
+
+/** This function will take the vector address, the growth factor, and the maximum growth as a parameters,
+ * then it will change how the vector allocated memory grows when it's full.
+ *
+ * Note: the allocated length will be multiplied by the growth factor, but it will not grow by more than the maximum growth,
+ * so big lists can grow in fixed steps instead of multiplying their length.
+ *
+ * Note: the default growth factor is 2, and the default maximum growth is zero that means there is no limit.
+ *
+ * @param list the vector address
+ * @param growthFactor the number that the allocated length will be multiplied by, and it should be bigger than one
+ * @param maxGrowth the maximum number of places that can be added in one growth, or zero for no limit
+ */
+
+void vectorSetGrowthPolicy(Vector *list, double growthFactor, int maxGrowth) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (growthFactor <= 1) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "growth factor", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (maxGrowth < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "max growth", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    list->growthFactor = growthFactor;
+    list->maxGrowth = maxGrowth;
+
+}
+
+
+
+
+
+/** This function will take the vector address as a parameter,
+ * then it will return the number of items that the vector can hold without reallocation.
+ *
+ * @param list the vector address
+ * @return it will return the vector allocated length
+ */
+
+int vectorGetCapacity(Vector *list) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return list->length;
 
 }
 
@@ -304,90 +556,278 @@ void vectorRemoveWtFr(Vector *list) {
 
     }
 
-
-    list->count--;
+
+    list->count--;
+
+}
+
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will remove the item in the given index from the vector.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the index of the item that will be deleted
+ */
+
+void vectorRemoveAtIndex(Vector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return;
+        #else
+     		fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    } else if (index < 0 || index >= vectorGetLength(list)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = OUT_OF_RANGE;
+     		return;
+        #else
+     		fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
+     		exit(OUT_OF_RANGE);
+     	#endif
+
+    }
+
+    list->freeItem(list->arr[index]);
+    list->count--;
+
+    memmove(list->arr + index, list->arr + index + 1, sizeof(void *) * (list->count - index));
+
+
+}
+
+
+
+/** This function will take the vector address, and the index as a parameters,
+ * then it will remove the item in the given index from the vector, without freeing the item.
+ *
+ * Note: if the index is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param index the index of the item that will be deleted
+ */
+
+void vectorRemoveAtIndexWtFr(Vector *list, int index) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return;
+        #else
+     		fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    } else if (index < 0 || index >= vectorGetLength(list)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = OUT_OF_RANGE;
+     		return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
+     		exit(OUT_OF_RANGE);
+     	#endif
+
+    }
+
+    list->count--;
+
+    memmove(list->arr + index, list->arr + index + 1, sizeof(void *) * (list->count - index));
+
+
+}
+
+
+
+
+
+/** This function will take the vector address, the start index, and the end index as a parameters,
+ * then it will remove the items from the start index to the end index (not included).
+ *
+ * Note: the following items will be shifted one time, so removing k items costs O (n) not O (k * n).
+ *
+ * Note: if the range is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param start the index of the first removed item
+ * @param end the index after the last removed item
+ */
+
+void vectorRemoveRange(Vector *list, int start, int end) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (start < 0 || end > list->count || start > end) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    for (int i = start; i < end; i++)
+        list->freeItem(list->arr[i]);
+
+    memmove(list->arr + start, list->arr + end, sizeof(void *) * (list->count - end));
+    list->count -= end - start;
+
+}
+
+
+
+
+
+/** This function will take the vector address, the start index, and the end index as a parameters,
+ * then it will remove the items from the start index to the end index (not included), without freeing the items.
+ *
+ * Note: the following items will be shifted one time, so removing k items costs O (n) not O (k * n).
+ *
+ * Note: if the range is out of the vector range then the program will be terminated.
+ *
+ * @param list the vector address
+ * @param start the index of the first removed item
+ * @param end the index after the last removed item
+ */
+
+void vectorRemoveRangeWtFr(Vector *list, int start, int end) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (start < 0 || end > list->count || start > end) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    memmove(list->arr + start, list->arr + end, sizeof(void *) * (list->count - end));
+    list->count -= end - start;
 
 }
 
 
 
 
-/** This function will take the vector address, and the index as a parameters,
- * then it will remove the item in the given index from the vector.
+
+/** This function will take the vector address, and a predicate function as a parameters,
+ * then it will remove all the items that the predicate returns a non zero value for,
+ * and it will return the number of the removed items.
  *
- * Note: if the index is out of the vector range then the program will be terminated.
+ * Note: the kept items will stay in the same order, and every item will be moved one time at most.
  *
  * @param list the vector address
- * @param index the index of the item that will be deleted
+ * @param predicate the function that will be called with every item, and it should return non zero if the item will be removed
+ * @return it will return the number of the removed items
  */
 
-void vectorRemoveAtIndex(Vector *list, int index) {
+int vectorRemoveIf(Vector *list, int (*predicate)(const void *)) {
     if (list == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
         #else
-     		fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
 
-    } else if (index < 0 || index >= vectorGetLength(list)) {
+    } else if (predicate == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = OUT_OF_RANGE;
-     		return;
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
         #else
-     		fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
-     		exit(OUT_OF_RANGE);
-     	#endif
+            fprintf(stderr, INVALID_ARG_MESSAGE, "predicate function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    list->freeItem(list->arr[index]);
-    list->count--;
+    int keptCount = 0;
+    for (int i = 0; i < list->count; i++) {
+        if (predicate(list->arr[i])) {
+            list->freeItem(list->arr[i]);
+            continue;
+        }
+
+        list->arr[keptCount++] = list->arr[i];
+    }
 
-    for (int i = index; i < list->count; i++) //this loop will shift the items to the left to delete the index.
-        list->arr[i] = list->arr[i + 1];
+    int removedCount = list->count - keptCount;
+    list->count = keptCount;
 
+    return removedCount;
 
 }
 
 
 
-/** This function will take the vector address, and the index as a parameters,
- * then it will remove the item in the given index from the vector, without freeing the item.
+
+
+/** This function will take the vector address, and a predicate function as a parameters,
+ * then it will remove all the items that the predicate returns a non zero value for, without freeing the items,
+ * and it will return the number of the removed items.
  *
- * Note: if the index is out of the vector range then the program will be terminated.
+ * Note: the kept items will stay in the same order, and every item will be moved one time at most.
  *
  * @param list the vector address
- * @param index the index of the item that will be deleted
+ * @param predicate the function that will be called with every item, and it should return non zero if the item will be removed
+ * @return it will return the number of the removed items
  */
 
-void vectorRemoveAtIndexWtFr(Vector *list, int index) {
+int vectorRemoveIfWtFr(Vector *list, int (*predicate)(const void *)) {
     if (list == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
         #else
-     		fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
 
-    } else if (index < 0 || index >= vectorGetLength(list)) {
+    } else if (predicate == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = OUT_OF_RANGE;
-     		return;
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
         #else
-            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "vector data structure");
-     		exit(OUT_OF_RANGE);
-     	#endif
+            fprintf(stderr, INVALID_ARG_MESSAGE, "predicate function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    list->count--;
+    int keptCount = 0;
+    for (int i = 0; i < list->count; i++) {
+        if (!predicate(list->arr[i]))
+            list->arr[keptCount++] = list->arr[i];
+
+    }
 
-    for (int i = index; i < list->count; i++) //this loop will shift the items to the left to delete the index.
-        list->arr[i] = list->arr[i + 1];
+    int removedCount = list->count - keptCount;
+    list->count = keptCount;
 
+    return removedCount;
 
 }
 
@@ -747,6 +1187,275 @@ void vectorSort(Vector *list, int (*sortComp)(const void*, const void*)) {
 
 
 
+/** This function will take the vector address, the action function, and the threads count as a parameters,
+ * then it will split the vector items into (threadsCount) chunks, and it will call the action function with every item,
+ * where every chunk is handled by a different thread.
+ *
+ * Note: the action function will be called from many threads at the same time, so it should only change the passed item.
+ *
+ * @param list the vector address
+ * @param action the function that will be called with every item
+ * @param threadsCount the number of threads
+ */
+
+void vectorParallelForEach(Vector *list, void (*action)(void *), int threadsCount) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (action == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "action function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (threadsCount <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "threads count", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    parallelListsForEach(list->arr, list->count, action, threadsCount);
+
+}
+
+
+
+
+
+/** This function will take the vector address, the output array, the map function, and the threads count as a parameters,
+ * then it will put the result of the map function of every item in the same index in the output array,
+ * where every chunk of the vector is handled by a different thread.
+ *
+ * Note: the output array should be allocated by the caller, and it's length should be bigger than or equal to the vector length.
+ *
+ * @param list the vector address
+ * @param output the output array
+ * @param mapFun the function that will be called with every item, and it should return the item new value
+ * @param threadsCount the number of threads
+ */
+
+void vectorParallelMap(Vector *list, void **output, void *(*mapFun)(const void *), int threadsCount) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (output == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "output array", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (mapFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "map function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (threadsCount <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "threads count", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    parallelListsMap(list->arr, list->count, output, mapFun, threadsCount);
+
+}
+
+
+
+
+
+/** This function will take the vector address, the output array, the predicate function, and the threads count as a parameters,
+ * then it will copy the items that the predicate returns a non zero value for into the output array,
+ * and it will return the number of the copied items.
+ *
+ * Note: every thread filters it's chunk into it's own part of the output array, then the parts are concatenated,
+ * so the copied items will stay in the same order.
+ *
+ * Note: the output array should be allocated by the caller, and it's length should be bigger than or equal to the vector length,
+ * and the copied items are still owned by the vector, so they shouldn't be freed.
+ *
+ * @param list the vector address
+ * @param output the output array
+ * @param predicate the function that will be called with every item, and it should return non zero if the item should be copied
+ * @param threadsCount the number of threads
+ * @return it will return the number of the items in the output array
+ */
+
+int vectorParallelFilter(Vector *list, void **output, int (*predicate)(const void *), int threadsCount) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (output == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "output array", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (predicate == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "predicate function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (threadsCount <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "threads count", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    return parallelListsFilter(list->arr, list->count, output, predicate, threadsCount);
+
+}
+
+
+
+
+
+/** This function will take the vector address, the result address, the result size, the reduce and combine functions,
+ * and the threads count as a parameters,
+ * then every thread will reduce it's chunk into a partial result that starts as a copy of the result initial value,
+ * and finally the partial results will be combined into the result in the chunks order.
+ *
+ * Note: the result should hold the identity value of the operation before calling the function (zero for the sum for example),
+ * and the combine function should be associative.
+ *
+ * Example of the functions if the items are integers and the result is their sum as a long long:
+ *
+ * void reduceFun(void *partial, const void *item) { *(long long *) partial += *(int *) item; }
+ *
+ * void combineFun(void *result, const void *partial) { *(long long *) result += *(long long *) partial; }
+ *
+ * @param list the vector address
+ * @param result the result address, that holds the initial value
+ * @param resultSize the size of the result in bytes
+ * @param reduceFun the function that will be called with a partial result and an item, to add the item to the partial result
+ * @param combineFun the function that will be called with the result and a partial result, to add the partial result to the result
+ * @param threadsCount the number of threads
+ */
+
+void vectorParallelReduce(Vector *list, void *result, int resultSize, void (*reduceFun)(void *, const void *),
+                          void (*combineFun)(void *, const void *), int threadsCount) {
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "vector", "vector data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (result == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "result pointer", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (resultSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "result size", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (reduceFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "reduce function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (combineFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "combine function", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (threadsCount <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "threads count", "vector data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!parallelListsReduce(list->arr, list->count, result, resultSize, reduceFun, combineFun, threadsCount)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "partial results", "vector data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+}
+
+
+
+
+
 /** This function will take the vector address as a parameter,
  * then it will return the length of the vector.
  *
@@ -892,4 +1601,51 @@ void destroyVector(Vector *list) {
     free(list->arr);
     free(list);
 
-}
\ No newline at end of file
+}
+
+
+
+
+
+/** This function will take the vector address, and the needed length as a parameters,
+ * then it will grow the vector allocated memory using the vector growth policy,
+ * and it will return one if it succeeded, other wise it will return zero.
+ *
+ * Note: the new length will be at least the needed length, so one call is enough for any number of items.
+ *
+ * Note: this function should only be called from the vector functions.
+ *
+ * @param list the vector address
+ * @param neededLength the number of items that the vector should be able to hold
+ * @return it will return one if the memory was grown, other wise it will return zero
+ */
+
+int vectorGrow(Vector *list, int neededLength) {
+    int newLength = (int) ceil(list->length * list->growthFactor);
+    if (list->maxGrowth != 0 && newLength - list->length > list->maxGrowth)
+        newLength = list->length + list->maxGrowth;
+
+    if (newLength <= list->length)
+        newLength = list->length + 1;
+
+    if (newLength < neededLength)
+        newLength = neededLength;
+
+    void **newArr = (void **) realloc(list->arr, sizeof(void *) * newLength);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_REALLOCATION;
+            return 0;
+        #else
+            fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "items memory", "vector data structure");
+            exit(FAILED_REALLOCATION);
+        #endif
+
+    }
+
+    list->arr = newArr;
+    list->length = newLength;
+
+    return 1;
+
+}
@@ -1,6 +1,8 @@
 #ifndef C_DATASTRUCTURES_LINKEDLISTQUEUE_H
 #define C_DATASTRUCTURES_LINKEDLISTQUEUE_H
 
+#include "../../LinkedLists/Headers/LinkedList.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -34,6 +36,8 @@ int lLQueueIsEmpty(LinkedListQueue *queue);
 
 void **lLQueueToArray(LinkedListQueue *queue);
 
+void lLQueueCursorInitialization(LinkedListCursor *cursor, LinkedListQueue *queue);
+
 void clearLLQueue(LinkedListQueue *queue);
 
 void destroyLLQueue(LinkedListQueue *queue);
@@ -0,0 +1,164 @@
+#ifndef C_DATASTRUCTURES_MPMCQUEUE_H
+#define C_DATASTRUCTURES_MPMCQUEUE_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The cache line size that separates the enqueue position, the dequeue position, and the counters.
+#define MPMC_QUEUE_CACHE_LINE_SIZE 64
+
+/// The number of failed tries that the blocking functions do before they park the thread.
+#define MPMC_QUEUE_SPIN_TRIES 64
+
+
+/** @struct MPMCQueueCell
+*  @brief This structure implements one slot of the multi producer multi consumer queue.
+*  @var MPMCQueueCell::sequence
+*  Member 'sequence' holds the position that the cell is waiting for,
+*  it equals the enqueue position when the cell is free, and (position + 1) when the cell holds the item of the position.
+*  @var MPMCQueueCell::item
+*  Member 'item' is a pointer to the cell item.
+*/
+
+typedef struct MPMCQueueCell {
+    atomic_size_t sequence;
+    void *item;
+} MPMCQueueCell;
+
+
+
+/** @struct MPMCQueueStats
+*  @brief This structure holds a snapshot of the multi producer multi consumer queue contention counters.
+*  The retries and the failed tries stay zero unless the queue was compiled with MPMC_QUEUE_STATS.
+*  @var MPMCQueueStats::enqueueRetries
+*  Member 'enqueueRetries' holds the number of times that a producer lost the race for a cell and tried again.
+*  @var MPMCQueueStats::dequeueRetries
+*  Member 'dequeueRetries' holds the number of times that a consumer lost the race for a cell and tried again.
+*  @var MPMCQueueStats::fullFailures
+*  Member 'fullFailures' holds the number of enqueue tries that failed because the queue was full.
+*  @var MPMCQueueStats::emptyFailures
+*  Member 'emptyFailures' holds the number of dequeue tries that failed because the queue was empty.
+*  @var MPMCQueueStats::producerParks
+*  Member 'producerParks' holds the number of times that a blocking enqueue parked the producer thread.
+*  @var MPMCQueueStats::consumerParks
+*  Member 'consumerParks' holds the number of times that a blocking dequeue parked the consumer thread.
+*/
+
+typedef struct MPMCQueueStats {
+    unsigned long enqueueRetries;
+    unsigned long dequeueRetries;
+    unsigned long fullFailures;
+    unsigned long emptyFailures;
+    unsigned long producerParks;
+    unsigned long consumerParks;
+} MPMCQueueStats;
+
+
+
+/** @struct MPMCQueue
+*  @brief This structure implements a bounded lock free queue for many producer threads and many consumer threads,
+*  where every cell holds a sequence number that tells the threads if the cell is free or full (Dmitry Vyukov's algorithm).
+*  @var MPMCQueue::cells
+*  Member 'cells' is a pointer to the cells array.
+*  @var MPMCQueue::mask
+*  Member 'mask' holds (capacity - 1), and it's used to find the cell of a position.
+*  @var MPMCQueue::capacity
+*  Member 'capacity' holds the maximum number of items in the queue, and it's always a power of two.
+*  @var MPMCQueue::freeItem
+*  Member 'freeItem' is a pointer to the function responsible for freeing the queue items.
+*  @var MPMCQueue::parkLock
+*  Member 'parkLock' is the mutex that the parked threads wait on, and it's never locked by the try functions.
+*  @var MPMCQueue::notEmpty
+*  Member 'notEmpty' is the condition that the parked consumers wait for.
+*  @var MPMCQueue::notFull
+*  Member 'notFull' is the condition that the parked producers wait for.
+*  @var MPMCQueue::parkedProducers
+*  Member 'parkedProducers' holds the number of the parked producers, so the consumers only signal when there is a waiter.
+*  @var MPMCQueue::parkedConsumers
+*  Member 'parkedConsumers' holds the number of the parked consumers, so the producers only signal when there is a waiter.
+*  @var MPMCQueue::sharedPadding
+*  Member 'sharedPadding' keeps the read mostly fields away from the enqueue position cache line.
+*  @var MPMCQueue::enqueuePos
+*  Member 'enqueuePos' holds the position of the next enqueue.
+*  @var MPMCQueue::enqueuePadding
+*  Member 'enqueuePadding' keeps the enqueue position and the dequeue position in different cache lines.
+*  @var MPMCQueue::dequeuePos
+*  Member 'dequeuePos' holds the position of the next dequeue.
+*  @var MPMCQueue::dequeuePadding
+*  Member 'dequeuePadding' keeps the dequeue position and the counters in different cache lines.
+*  @var MPMCQueue::enqueueRetries
+*  Member 'enqueueRetries' counts the producers lost races when MPMC_QUEUE_STATS is defined.
+*  @var MPMCQueue::dequeueRetries
+*  Member 'dequeueRetries' counts the consumers lost races when MPMC_QUEUE_STATS is defined.
+*  @var MPMCQueue::fullFailures
+*  Member 'fullFailures' counts the failed enqueue tries on a full queue when MPMC_QUEUE_STATS is defined.
+*  @var MPMCQueue::emptyFailures
+*  Member 'emptyFailures' counts the failed dequeue tries on an empty queue when MPMC_QUEUE_STATS is defined.
+*  @var MPMCQueue::producerParks
+*  Member 'producerParks' counts the parked producers.
+*  @var MPMCQueue::consumerParks
+*  Member 'consumerParks' counts the parked consumers.
+*/
+
+typedef struct MPMCQueue {
+    MPMCQueueCell *cells;
+    size_t mask;
+    int capacity;
+    void (*freeItem)(void *);
+    pthread_mutex_t parkLock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    atomic_int parkedProducers;
+    atomic_int parkedConsumers;
+    char sharedPadding[MPMC_QUEUE_CACHE_LINE_SIZE];
+
+    atomic_size_t enqueuePos;
+    char enqueuePadding[MPMC_QUEUE_CACHE_LINE_SIZE];
+
+    atomic_size_t dequeuePos;
+    char dequeuePadding[MPMC_QUEUE_CACHE_LINE_SIZE];
+
+    atomic_ulong enqueueRetries;
+    atomic_ulong dequeueRetries;
+    atomic_ulong fullFailures;
+    atomic_ulong emptyFailures;
+    atomic_ulong producerParks;
+    atomic_ulong consumerParks;
+} MPMCQueue;
+
+
+MPMCQueue *mpmcQueueInitialization(int capacity, void (*freeFun)(void *));
+
+int mpmcQueueTryEnqueue(MPMCQueue *queue, void *item);
+
+void *mpmcQueueTryDequeue(MPMCQueue *queue);
+
+void mpmcQueueEnqueue(MPMCQueue *queue, void *item);
+
+void *mpmcQueueDequeue(MPMCQueue *queue);
+
+int mpmcQueueGetLength(MPMCQueue *queue);
+
+int mpmcQueueIsEmpty(MPMCQueue *queue);
+
+int mpmcQueueGetCapacity(MPMCQueue *queue);
+
+void mpmcQueueGetStats(MPMCQueue *queue, MPMCQueueStats *stats);
+
+void mpmcQueueResetStats(MPMCQueue *queue);
+
+void clearMPMCQueue(MPMCQueue *queue);
+
+void destroyMPMCQueue(MPMCQueue *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_MPMCQUEUE_H
@@ -6,16 +6,23 @@ extern "C" {
 #endif
 
 
+/// The initial capacity of the queue memory, and the queue will never shrink below it. It should be a power of two.
+#define QUEUE_MIN_CAPACITY 16
+
+
 /** @struct Queue
- *  @brief This structure implements a basic generic Queue where memory is laid out sequentially.
+ *  @brief This structure implements a basic generic Queue as a circular buffer,
+ *  where the capacity is always a power of two, so the slot of an index is found by masking it with (allocated - 1).
  *  @var Queue:: memory
  *  Member 'memory' is a pointer to the the Queue's memory.
  *  @var Queue::allocated
- *  Member 'allocated' holds the current max allocated size for the Queue.
+ *  Member 'allocated' holds the current max allocated size for the Queue, and it's always a power of two.
  *  @var Queue::front
- *  Member 'front' holds the index to the front of the Queue Element.
-  *  @var Queue::rear
- *  Member 'rear' holds the index to the last Queue Element.
+ *  Member 'front' holds the index of the front Queue Element, it only increases and it wraps around when it overflows.
+ *  @var Queue::rear
+ *  Member 'rear' holds the index after the last Queue Element, so the queue length is (rear - front).
+ *  @var Queue::shrinkEnabled
+ *  Member 'shrinkEnabled' holds one if the memory should be halved when the queue is only a quarter full, other wise zero.
  *  @var Queue:: 'freeFn'
  *  Member 'freeFn' holds pointer to the function responsible for freeing the elements stored in the queue.
  */
@@ -23,8 +30,9 @@ extern "C" {
 typedef struct Queue{
     void ** memory;
     int allocated;
-    int front;
-    int rear;
+    unsigned int front;
+    unsigned int rear;
+    int shrinkEnabled;
     void (*freeItem)(void *);
 } Queue;
 
@@ -48,6 +56,8 @@ void *queuePeek(Queue *arrayQueue);
 
 void **queueToArray(Queue *arrayQueue);
 
+void queueSetShrinkPolicy(Queue *arrayQueue, int shrinkEnabled);
+
 #ifdef __cplusplus
 }
 #endif
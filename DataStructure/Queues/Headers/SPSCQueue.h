@@ -0,0 +1,84 @@
+#ifndef C_DATASTRUCTURES_SPSCQUEUE_H
+#define C_DATASTRUCTURES_SPSCQUEUE_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/// The cache line size that separates the producer fields from the consumer fields.
+#define SPSC_QUEUE_CACHE_LINE_SIZE 64
+
+
+/** @struct SPSCQueue
+*  @brief This structure implements a bounded lock free ring queue, that passes items from exactly one producer thread
+*  to exactly one consumer thread, where every enqueue and dequeue finishes in a bounded number of steps.
+*  @var SPSCQueue::memory
+*  Member 'memory' is a pointer to the ring memory.
+*  @var SPSCQueue::mask
+*  Member 'mask' holds (capacity - 1), and it's used to find the slot of an index.
+*  @var SPSCQueue::capacity
+*  Member 'capacity' holds the maximum number of items in the queue, and it's always a power of two.
+*  @var SPSCQueue::freeItem
+*  Member 'freeItem' is a pointer to the function responsible for freeing the queue items.
+*  @var SPSCQueue::sharedPadding
+*  Member 'sharedPadding' keeps the read only fields away from the producer cache line.
+*  @var SPSCQueue::tail
+*  Member 'tail' holds the index after the last enqueued item, and only the producer changes it.
+*  @var SPSCQueue::headCache
+*  Member 'headCache' holds the last head value that the producer has read, so it doesn't read the consumer cache line on every enqueue.
+*  @var SPSCQueue::producerPadding
+*  Member 'producerPadding' keeps the producer fields and the consumer fields in different cache lines.
+*  @var SPSCQueue::head
+*  Member 'head' holds the index of the first item in the queue, and only the consumer changes it.
+*  @var SPSCQueue::tailCache
+*  Member 'tailCache' holds the last tail value that the consumer has read, so it doesn't read the producer cache line on every dequeue.
+*  @var SPSCQueue::consumerPadding
+*  Member 'consumerPadding' keeps the consumer fields away from the memory that comes after the queue.
+*/
+
+typedef struct SPSCQueue {
+    void **memory;
+    size_t mask;
+    int capacity;
+    void (*freeItem)(void *);
+    char sharedPadding[SPSC_QUEUE_CACHE_LINE_SIZE];
+
+    atomic_size_t tail;
+    size_t headCache;
+    char producerPadding[SPSC_QUEUE_CACHE_LINE_SIZE];
+
+    atomic_size_t head;
+    size_t tailCache;
+    char consumerPadding[SPSC_QUEUE_CACHE_LINE_SIZE];
+} SPSCQueue;
+
+
+SPSCQueue *spscQueueInitialization(int capacity, void (*freeFun)(void *));
+
+int spscQueueTryEnqueue(SPSCQueue *queue, void *item);
+
+void *spscQueueTryDequeue(SPSCQueue *queue);
+
+int spscQueueEnqueueBatch(SPSCQueue *queue, void **items, int count);
+
+int spscQueueDequeueBatch(SPSCQueue *queue, void **output, int maxCount);
+
+int spscQueueGetLength(SPSCQueue *queue);
+
+int spscQueueIsEmpty(SPSCQueue *queue);
+
+int spscQueueGetCapacity(SPSCQueue *queue);
+
+void clearSPSCQueue(SPSCQueue *queue);
+
+void destroySPSCQueue(SPSCQueue *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_SPSCQUEUE_H
@@ -286,6 +286,37 @@ void **lLQueueToArray(LinkedListQueue *queue) {
 
 
 
+/** This function will take the cursor address, and the queue address as a parameters,
+ * then it will initialize the cursor on the front item of the queue,
+ * so the queue items can be walked from the front to the rear without copying them to an array.
+ *
+ * Note: the cursor can also remove the items that it points to, so an item can be dropped from the middle of the queue in constant time.
+ *
+ * @param cursor the cursor address
+ * @param queue the queue address
+ */
+
+void lLQueueCursorInitialization(LinkedListCursor *cursor, LinkedListQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "linked list queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    linkedListCursorInitialization(cursor, queue->linkedList);
+
+}
+
+
+
+
+
+
 /** This function will take the queue address as a parameter,
  * then it will delete and free all the items in the queue without destroying the queue.
  *
@@ -0,0 +1,679 @@
+#include "../Headers/MPMCQueue.h"
+#include <sched.h>
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+/// The retries and the failed tries counters are shared by all the threads, so every count is an atomic write on the contended path,
+/// and they are only counted when MPMC_QUEUE_STATS is defined while compiling the queue (-DMPMC_QUEUE_STATS).
+#ifdef MPMC_QUEUE_STATS
+    #define MPMC_QUEUE_COUNT(counter) atomic_fetch_add_explicit(&(counter), 1, memory_order_relaxed)
+#else
+    #define MPMC_QUEUE_COUNT(counter) ((void) 0)
+#endif
+
+
+int mpmcQueuePush(MPMCQueue *queue, void *item);
+
+void *mpmcQueuePop(MPMCQueue *queue);
+
+void mpmcQueueWake(MPMCQueue *queue, atomic_int *parkedCount, pthread_cond_t *condition);
+
+
+
+
+
+/** This function will take the queue capacity, and the freeing function as a parameters,
+ * then it will initialize a new multi producer multi consumer queue in the memory and set it's fields then return it.
+ *
+ * Note: the capacity will be rounded up to the next power of two, and it will be two at least.
+ *
+ * @param capacity the maximum number of items in the queue
+ * @param freeFun the function address that will be called to free the queue items
+ * @return it will return the initialized queue pointer
+ */
+
+MPMCQueue *mpmcQueueInitialization(int capacity, void (*freeFun)(void *)) {
+    if (capacity <= 0 || capacity > (1 << 30)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "queue capacity", "mpmc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function", "mpmc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    MPMCQueue *queue = (MPMCQueue *) malloc(sizeof(MPMCQueue));
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "mpmc queue data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    queue->capacity = 2;
+    while (queue->capacity < capacity)
+        queue->capacity <<= 1;
+
+    queue->cells = (MPMCQueueCell *) malloc(sizeof(MPMCQueueCell) * queue->capacity);
+    if (queue->cells == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            free(queue);
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "cells memory", "mpmc queue data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    if (pthread_mutex_init(&queue->parkLock, NULL) != 0
+        || pthread_cond_init(&queue->notEmpty, NULL) != 0
+        || pthread_cond_init(&queue->notFull, NULL) != 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            free(queue->cells);
+            free(queue);
+            return NULL;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "initialize the parking lock", "mpmc queue data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+    // every cell starts waiting for the enqueue of it's own index.
+    for (int i = 0; i < queue->capacity; i++)
+        atomic_init(&queue->cells[i].sequence, (size_t) i);
+
+    queue->mask = (size_t) queue->capacity - 1;
+    queue->freeItem = freeFun;
+    atomic_init(&queue->parkedProducers, 0);
+    atomic_init(&queue->parkedConsumers, 0);
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+    atomic_init(&queue->enqueueRetries, 0);
+    atomic_init(&queue->dequeueRetries, 0);
+    atomic_init(&queue->fullFailures, 0);
+    atomic_init(&queue->emptyFailures, 0);
+    atomic_init(&queue->producerParks, 0);
+    atomic_init(&queue->consumerParks, 0);
+
+    return queue;
+
+}
+
+
+
+
+
+/** This function will take the queue address, and the item as a parameters,
+ * then it will put the item at the end of the queue if there is a free cell, and it will wake a parked consumer if there is one.
+ *
+ * Note: this function can be called from many threads at the same time, and it never blocks.
+ *
+ * @param queue the queue address
+ * @param item the new item
+ * @return it will return one if the item was enqueued, other wise it will return zero if the queue is full
+ */
+
+int mpmcQueueTryEnqueue(MPMCQueue *queue, void *item) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "mpmc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!mpmcQueuePush(queue, item))
+        return 0;
+
+    mpmcQueueWake(queue, &queue->parkedConsumers, &queue->notEmpty);
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will remove and return the first item in the queue if there is one, and it will wake a parked producer if there is one.
+ *
+ * Note: this function can be called from many threads at the same time, and it never blocks.
+ *
+ * @param queue the queue address
+ * @return it will return the first item in the queue, other wise it will return NULL if the queue is empty
+ */
+
+void *mpmcQueueTryDequeue(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void *item = mpmcQueuePop(queue);
+    if (item != NULL)
+        mpmcQueueWake(queue, &queue->parkedProducers, &queue->notFull);
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the queue address, and the item as a parameters,
+ * then it will put the item at the end of the queue, and it will wait while the queue is full.
+ *
+ * Note: the function will try MPMC_QUEUE_SPIN_TRIES times while yielding the processor,
+ * then it will park the thread on a condition variable until a consumer frees a cell.
+ *
+ * @param queue the queue address
+ * @param item the new item
+ */
+
+void mpmcQueueEnqueue(MPMCQueue *queue, void *item) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "mpmc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (int tries = 0; !mpmcQueuePush(queue, item); tries++) {
+        if (tries < MPMC_QUEUE_SPIN_TRIES) {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&queue->parkLock);
+
+        // the producer announces itself before the last try, so a consumer that frees a cell after the try will see it.
+        atomic_fetch_add(&queue->parkedProducers, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        int pushed = mpmcQueuePush(queue, item);
+        if (!pushed) {
+            atomic_fetch_add_explicit(&queue->producerParks, 1, memory_order_relaxed);
+            pthread_cond_wait(&queue->notFull, &queue->parkLock);
+        }
+
+        atomic_fetch_sub(&queue->parkedProducers, 1);
+        pthread_mutex_unlock(&queue->parkLock);
+
+        if (pushed)
+            break;
+
+    }
+
+    mpmcQueueWake(queue, &queue->parkedConsumers, &queue->notEmpty);
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will remove and return the first item in the queue, and it will wait while the queue is empty.
+ *
+ * Note: the function will try MPMC_QUEUE_SPIN_TRIES times while yielding the processor,
+ * then it will park the thread on a condition variable until a producer enqueues an item.
+ *
+ * @param queue the queue address
+ * @return it will return the first item in the queue
+ */
+
+void *mpmcQueueDequeue(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void *item;
+
+    for (int tries = 0; (item = mpmcQueuePop(queue)) == NULL; tries++) {
+        if (tries < MPMC_QUEUE_SPIN_TRIES) {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&queue->parkLock);
+
+        // the consumer announces itself before the last try, so a producer that enqueues after the try will see it.
+        atomic_fetch_add(&queue->parkedConsumers, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        item = mpmcQueuePop(queue);
+        if (item == NULL) {
+            atomic_fetch_add_explicit(&queue->consumerParks, 1, memory_order_relaxed);
+            pthread_cond_wait(&queue->notEmpty, &queue->parkLock);
+        }
+
+        atomic_fetch_sub(&queue->parkedConsumers, 1);
+        pthread_mutex_unlock(&queue->parkLock);
+
+        if (item != NULL)
+            break;
+
+    }
+
+    mpmcQueueWake(queue, &queue->parkedProducers, &queue->notFull);
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return the number of items in the queue.
+ *
+ * Note: if the producers or the consumers are running, then the returned length is only a snapshot.
+ *
+ * @param queue the queue address
+ * @return it will return the number of items in the queue
+ */
+
+int mpmcQueueGetLength(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    // the dequeue position is read first, because it never passes the enqueue position.
+    size_t dequeuePos = atomic_load_explicit(&queue->dequeuePos, memory_order_acquire);
+    size_t enqueuePos = atomic_load_explicit(&queue->enqueuePos, memory_order_acquire);
+    size_t length = enqueuePos - dequeuePos;
+
+    return length > (size_t) queue->capacity ? queue->capacity : (int) length;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return one if the queue is empty, other wise it will return zero.
+ *
+ * @param queue the queue address
+ * @return it will return one if the queue is empty, other wise it will return zero
+ */
+
+int mpmcQueueIsEmpty(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return mpmcQueueGetLength(queue) == 0;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return the maximum number of items in the queue.
+ *
+ * @param queue the queue address
+ * @return it will return the queue capacity
+ */
+
+int mpmcQueueGetCapacity(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return queue->capacity;
+
+}
+
+
+
+
+
+/** This function will take the queue address, and the stats address as a parameters,
+ * then it will copy the current values of the queue contention counters into the stats.
+ *
+ * Note: the retries and the failed tries are only counted when the queue is compiled with MPMC_QUEUE_STATS.
+ *
+ * @param queue the queue address
+ * @param stats the stats address
+ */
+
+void mpmcQueueGetStats(MPMCQueue *queue, MPMCQueueStats *stats) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (stats == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "stats pointer", "mpmc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    stats->enqueueRetries = atomic_load_explicit(&queue->enqueueRetries, memory_order_relaxed);
+    stats->dequeueRetries = atomic_load_explicit(&queue->dequeueRetries, memory_order_relaxed);
+    stats->fullFailures = atomic_load_explicit(&queue->fullFailures, memory_order_relaxed);
+    stats->emptyFailures = atomic_load_explicit(&queue->emptyFailures, memory_order_relaxed);
+    stats->producerParks = atomic_load_explicit(&queue->producerParks, memory_order_relaxed);
+    stats->consumerParks = atomic_load_explicit(&queue->consumerParks, memory_order_relaxed);
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will set all the queue contention counters to zero.
+ *
+ * @param queue the queue address
+ */
+
+void mpmcQueueResetStats(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    atomic_store_explicit(&queue->enqueueRetries, 0, memory_order_relaxed);
+    atomic_store_explicit(&queue->dequeueRetries, 0, memory_order_relaxed);
+    atomic_store_explicit(&queue->fullFailures, 0, memory_order_relaxed);
+    atomic_store_explicit(&queue->emptyFailures, 0, memory_order_relaxed);
+    atomic_store_explicit(&queue->producerParks, 0, memory_order_relaxed);
+    atomic_store_explicit(&queue->consumerParks, 0, memory_order_relaxed);
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will remove and free all the queue items.
+ *
+ * Note: this function should only be called when the producers are stopped.
+ *
+ * @param queue the queue address
+ */
+
+void clearMPMCQueue(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void *item;
+
+    while ((item = mpmcQueuePop(queue)) != NULL)
+        queue->freeItem(item);
+
+    mpmcQueueWake(queue, &queue->parkedProducers, &queue->notFull);
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will destroy and free the queue and all it's items.
+ *
+ * Note: this function should only be called when the producers and the consumers are stopped.
+ *
+ * @param queue the queue address
+ */
+
+void destroyMPMCQueue(MPMCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "mpmc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void *item;
+
+    while ((item = mpmcQueuePop(queue)) != NULL)
+        queue->freeItem(item);
+
+    pthread_cond_destroy(&queue->notFull);
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_mutex_destroy(&queue->parkLock);
+    free(queue->cells);
+    free(queue);
+
+}
+
+
+
+
+
+/** This function will take the queue address, and the item as a parameters,
+ * then it will claim the cell of the enqueue position, and it will put the item in it and return one,
+ * other wise it will return zero if the queue is full.
+ *
+ * Note: the cell is free when it's sequence equals the enqueue position, and it's still full from the previous round
+ * when it's sequence is behind the position, and when it's sequence is ahead then another producer already claimed it.
+ *
+ * Note: this function should only be called from the mpmc queue functions.
+ *
+ * @param queue the queue address
+ * @param item the new item
+ * @return it will return one if the item was enqueued, other wise it will return zero
+ */
+
+int mpmcQueuePush(MPMCQueue *queue, void *item) {
+    size_t position = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    MPMCQueueCell *cell;
+
+    for (;;) {
+        cell = queue->cells + (position & queue->mask);
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t) sequence - (intptr_t) position;
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+
+        } else if (difference < 0) {
+            MPMC_QUEUE_COUNT(queue->fullFailures);
+            return 0;
+        } else
+            position = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+
+        MPMC_QUEUE_COUNT(queue->enqueueRetries);
+    }
+
+    cell->item = item;
+
+    // the release store publishes the item to the consumer that waits for the (position + 1) sequence.
+    atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will claim the cell of the dequeue position, and it will remove and return it's item,
+ * other wise it will return NULL if the queue is empty.
+ *
+ * Note: after the item is taken, the cell sequence is moved one round ahead (position + capacity),
+ * so the cell will be free for the producer of the next round.
+ *
+ * Note: this function should only be called from the mpmc queue functions.
+ *
+ * @param queue the queue address
+ * @return it will return the first item in the queue, other wise it will return NULL
+ */
+
+void *mpmcQueuePop(MPMCQueue *queue) {
+    size_t position = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    MPMCQueueCell *cell;
+
+    for (;;) {
+        cell = queue->cells + (position & queue->mask);
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t) sequence - (intptr_t) (position + 1);
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+
+        } else if (difference < 0) {
+            MPMC_QUEUE_COUNT(queue->emptyFailures);
+            return NULL;
+        } else
+            position = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+
+        MPMC_QUEUE_COUNT(queue->dequeueRetries);
+    }
+
+    void *item = cell->item;
+    atomic_store_explicit(&cell->sequence, position + queue->mask + 1, memory_order_release);
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the queue address, the parked threads count address, and the condition address as a parameters,
+ * then it will signal the condition if there is a parked thread, so the waking doesn't lock the mutex when nobody waits.
+ *
+ * Note: the sequentially consistent fence pairs with the fence of the parking thread,
+ * so either the parking thread sees the new cell state in it's last try, or this function sees the parked thread.
+ *
+ * Note: this function should only be called from the mpmc queue functions.
+ *
+ * @param queue the queue address
+ * @param parkedCount the address of the parked threads count
+ * @param condition the address of the condition that the parked threads wait for
+ */
+
+void mpmcQueueWake(MPMCQueue *queue, atomic_int *parkedCount, pthread_cond_t *condition) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(parkedCount, memory_order_relaxed) == 0)
+        return;
+
+    pthread_mutex_lock(&queue->parkLock);
+    pthread_cond_signal(condition);
+    pthread_mutex_unlock(&queue->parkLock);
+
+}
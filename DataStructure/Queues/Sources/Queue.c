@@ -4,6 +4,14 @@
 
 
 
+#define QUEUE_SLOT(queue, index) ((index) & (unsigned int) ((queue)->allocated - 1))
+
+
+
+int queueResize(Queue *arrayQueue, int newAllocated);
+
+
+
 
 
 
@@ -43,7 +51,8 @@ Queue* queueInitialization(void (*freeFun)(void *)) {
     }
 
     queue->freeItem =  freeFun;
-    queue->allocated = 10;
+    queue->allocated = QUEUE_MIN_CAPACITY;
+    queue->shrinkEnabled = 0;
     queue->memory = (void **) malloc(sizeof(void *) * queue->allocated);
 
     if (queue->memory == NULL) {
@@ -97,10 +106,9 @@ void queueEnqueue(Queue* arrayQueue, void *data) {
 
     }
 
-    if(arrayQueue->allocated ==  arrayQueue->rear) {
-        arrayQueue->allocated *= 2;
-        void **tempArr = (void **) malloc(sizeof(void *) * arrayQueue->allocated);
-        if (tempArr == NULL) {
+    // the rear index wraps around to the free places before the front, so the queue grows only when it's actually full.
+    if (queueGetLength(arrayQueue) == arrayQueue->allocated) {
+        if (!queueResize(arrayQueue, arrayQueue->allocated * 2)) {
             #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		    ERROR_TEST->errorCode = FAILED_ALLOCATION;
                 return;
@@ -111,16 +119,9 @@ void queueEnqueue(Queue* arrayQueue, void *data) {
 
         }
 
-        memcpy(tempArr, arrayQueue->memory + arrayQueue->front,
-                sizeof(void *) * (arrayQueue->rear - arrayQueue->front) );
-
-        free(arrayQueue->memory);
-        arrayQueue->memory = tempArr;
-        arrayQueue->rear -= arrayQueue->front;
-        arrayQueue->front = 0;
     }
 
-    arrayQueue->memory[arrayQueue->rear++] = data;
+    arrayQueue->memory[QUEUE_SLOT(arrayQueue, arrayQueue->rear++)] = data;
 
 }
 
@@ -158,7 +159,15 @@ void* queueDequeue(Queue* arrayQueue) {
 
     }
 
-    return arrayQueue->memory[arrayQueue->front++];
+    void *item = arrayQueue->memory[QUEUE_SLOT(arrayQueue, arrayQueue->front++)];
+
+    // if the shrink policy is enabled, then the memory is halved when the queue is only a quarter full,
+    // so the next enqueues and dequeues can't make it grow and shrink again right away.
+    if (arrayQueue->shrinkEnabled && arrayQueue->allocated > QUEUE_MIN_CAPACITY
+        && queueGetLength(arrayQueue) <= arrayQueue->allocated / 4)
+        queueResize(arrayQueue, arrayQueue->allocated / 2);
+
+    return item;
 
 }
 
@@ -221,8 +230,8 @@ void queueClear(Queue* arrayQueue) {
     }
 
 
-    for (int i = arrayQueue->front; i < arrayQueue->rear; i++)
-        arrayQueue->freeItem(arrayQueue->memory[i]);
+    for (unsigned int i = arrayQueue->front; i != arrayQueue->rear; i++)
+        arrayQueue->freeItem(arrayQueue->memory[QUEUE_SLOT(arrayQueue, i)]);
 
     arrayQueue->front = arrayQueue->rear = 0;
 
@@ -255,7 +264,7 @@ int queueIsEmpty(Queue * arrayQueue) {
 
     }
 
-    return (short ) (arrayQueue->rear == arrayQueue->front);
+    return arrayQueue->rear == arrayQueue->front;
 
 }
 
@@ -285,7 +294,7 @@ int queueGetLength(Queue * arrayQueue){
 
     }
 
-    return arrayQueue->rear - arrayQueue->front;
+    return (int) (arrayQueue->rear - arrayQueue->front);
 
 }
 
@@ -365,7 +374,7 @@ void *queuePeek(Queue * arrayQueue) {
         #endif
     }
 
-    return arrayQueue->memory[arrayQueue->front];
+    return arrayQueue->memory[QUEUE_SLOT(arrayQueue, arrayQueue->front)];
 
 }
 
@@ -406,9 +415,88 @@ void **queueToArray(Queue * arrayQueue){
 
     }
 
-    for (int i = arrayQueue->front; i < arrayQueue->rear; i++)
-        array[i] = arrayQueue->memory[i];
+    for (int i = 0; i < queueGetLength(arrayQueue); i++)
+        array[i] = arrayQueue->memory[QUEUE_SLOT(arrayQueue, arrayQueue->front + i)];
 
     return array;
 
 }
+
+
+
+
+
+
+
+
+
+/** This function will take the queue address, and the shrink flag as a parameters,
+ * then it will enable the shrink policy if the flag is not zero, other wise it will disable it.
+ *
+ * Note: when the shrink policy is enabled, the queue memory will be halved every time the dequeue leaves it only a quarter full,
+ * but it will never be smaller than QUEUE_MIN_CAPACITY.
+ *
+ * @param arrayQueue Pointer to the Queue on the heap.
+ * @param shrinkEnabled one to enable the shrink policy, or zero to disable it
+ */
+
+void queueSetShrinkPolicy(Queue *arrayQueue, int shrinkEnabled) {
+    if (arrayQueue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    arrayQueue->shrinkEnabled = shrinkEnabled != 0;
+
+}
+
+
+
+
+
+
+
+
+
+/** This function will take the queue address, and the new capacity as a parameters,
+ * then it will move the queue items to a new memory with the new capacity, and it will return one if it succeeded.
+ *
+ * Note: the items may be wrapped around the end of the old memory, so they are copied in two parts,
+ * and they will start from the first slot of the new memory.
+ *
+ * Note: if the allocation failed then the old memory will be kept, and the function will return zero.
+ *
+ * Note: this function should only be called from the queue functions.
+ *
+ * @param arrayQueue Pointer to the Queue on the heap.
+ * @param newAllocated the new capacity, and it should be a power of two that can hold all the queue items
+ * @return it will return one if the memory was resized, other wise it will return zero
+ */
+
+int queueResize(Queue *arrayQueue, int newAllocated) {
+    void **newMemory = (void **) malloc(sizeof(void *) * newAllocated);
+    if (newMemory == NULL)
+        return 0;
+
+    int length = queueGetLength(arrayQueue);
+    int frontSlot = (int) QUEUE_SLOT(arrayQueue, arrayQueue->front);
+    int firstPartLength = arrayQueue->allocated - frontSlot < length ? arrayQueue->allocated - frontSlot : length;
+
+    memcpy(newMemory, arrayQueue->memory + frontSlot, sizeof(void *) * firstPartLength);
+    memcpy(newMemory + firstPartLength, arrayQueue->memory, sizeof(void *) * (length - firstPartLength));
+
+    free(arrayQueue->memory);
+    arrayQueue->memory = newMemory;
+    arrayQueue->allocated = newAllocated;
+    arrayQueue->front = 0;
+    arrayQueue->rear = (unsigned int) length;
+
+    return 1;
+
+}
@@ -0,0 +1,515 @@
+#include "../Headers/SPSCQueue.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+void spscQueueCopyIn(SPSCQueue *queue, size_t index, void **items, int count);
+
+void spscQueueCopyOut(SPSCQueue *queue, size_t index, void **output, int count);
+
+
+
+
+
+/** This function will take the queue capacity, and the freeing function as a parameters,
+ * then it will initialize a new single producer single consumer queue in the memory and set it's fields then return it.
+ *
+ * Note: the capacity will be rounded up to the next power of two, so the slot of an index is found by masking it.
+ *
+ * @param capacity the maximum number of items in the queue
+ * @param freeFun the function address that will be called to free the queue items
+ * @return it will return the initialized queue pointer
+ */
+
+SPSCQueue *spscQueueInitialization(int capacity, void (*freeFun)(void *)) {
+    if (capacity <= 0 || capacity > (1 << 30)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "queue capacity", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    SPSCQueue *queue = (SPSCQueue *) malloc(sizeof(SPSCQueue));
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "data structure", "spsc queue data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    queue->capacity = 1;
+    while (queue->capacity < capacity)
+        queue->capacity <<= 1;
+
+    queue->memory = (void **) malloc(sizeof(void *) * queue->capacity);
+    if (queue->memory == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            free(queue);
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "items memory", "spsc queue data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    queue->mask = (size_t) queue->capacity - 1;
+    queue->freeItem = freeFun;
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->headCache = queue->tailCache = 0;
+
+    return queue;
+
+}
+
+
+
+
+
+/** This function will take the queue address, and the item as a parameters,
+ * then it will put the item at the end of the queue if there is a free slot.
+ *
+ * Note: this function should only be called from the producer thread,
+ * and the consumer head index is only read when the cached head says that the queue is full.
+ *
+ * @param queue the queue address
+ * @param item the new item
+ * @return it will return one if the item was enqueued, other wise it will return zero if the queue is full
+ */
+
+int spscQueueTryEnqueue(SPSCQueue *queue, void *item) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    if (tail - queue->headCache == (size_t) queue->capacity) {
+        queue->headCache = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->headCache == (size_t) queue->capacity)
+            return 0;
+
+    }
+
+    queue->memory[tail & queue->mask] = item;
+
+    // the release store publishes the item slot to the consumer before the new tail.
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will remove and return the first item in the queue if there is one.
+ *
+ * Note: this function should only be called from the consumer thread,
+ * and the producer tail index is only read when the cached tail says that the queue is empty.
+ *
+ * @param queue the queue address
+ * @return it will return the first item in the queue, other wise it will return NULL if the queue is empty
+ */
+
+void *spscQueueTryDequeue(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (head == queue->tailCache) {
+        queue->tailCache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->tailCache)
+            return NULL;
+
+    }
+
+    void *item = queue->memory[head & queue->mask];
+
+    // the release store tells the producer that the slot can be reused only after the item was read.
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return item;
+
+}
+
+
+
+
+
+/** This function will take the queue address, the items array, and the items count as a parameters,
+ * then it will enqueue as many items from the start of the array as the free slots can hold,
+ * and it will return the number of the enqueued items.
+ *
+ * Note: all the enqueued items are published to the consumer by one release store,
+ * so the cost of the synchronization is paid once for the whole batch.
+ *
+ * Note: this function should only be called from the producer thread.
+ *
+ * @param queue the queue address
+ * @param items the items array
+ * @param count the number of items in the array
+ * @return it will return the number of the enqueued items
+ */
+
+int spscQueueEnqueueBatch(SPSCQueue *queue, void **items, int count) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (count < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items count", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t freeSlots = (size_t) queue->capacity - (tail - queue->headCache);
+
+    if (freeSlots < (size_t) count) {
+        queue->headCache = atomic_load_explicit(&queue->head, memory_order_acquire);
+        freeSlots = (size_t) queue->capacity - (tail - queue->headCache);
+    }
+
+    int enqueuedCount = freeSlots < (size_t) count ? (int) freeSlots : count;
+    if (enqueuedCount == 0)
+        return 0;
+
+    spscQueueCopyIn(queue, tail, items, enqueuedCount);
+    atomic_store_explicit(&queue->tail, tail + enqueuedCount, memory_order_release);
+
+    return enqueuedCount;
+
+}
+
+
+
+
+
+/** This function will take the queue address, the output array, and the maximum count as a parameters,
+ * then it will dequeue up to the maximum count of items into the output array,
+ * and it will return the number of the dequeued items.
+ *
+ * Note: this function should only be called from the consumer thread.
+ *
+ * @param queue the queue address
+ * @param output the output array, and it's length should be bigger than or equal to the maximum count
+ * @param maxCount the maximum number of items to dequeue
+ * @return it will return the number of the dequeued items
+ */
+
+int spscQueueDequeueBatch(SPSCQueue *queue, void **output, int maxCount) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (output == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "output array", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (maxCount < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "maximum count", "spsc queue data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t availableItems = queue->tailCache - head;
+
+    if (availableItems < (size_t) maxCount) {
+        queue->tailCache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        availableItems = queue->tailCache - head;
+    }
+
+    int dequeuedCount = availableItems < (size_t) maxCount ? (int) availableItems : maxCount;
+    if (dequeuedCount == 0)
+        return 0;
+
+    spscQueueCopyOut(queue, head, output, dequeuedCount);
+    atomic_store_explicit(&queue->head, head + dequeuedCount, memory_order_release);
+
+    return dequeuedCount;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return the number of items in the queue.
+ *
+ * Note: if the producer or the consumer are running, then the returned length is only a snapshot.
+ *
+ * @param queue the queue address
+ * @return it will return the number of items in the queue
+ */
+
+int spscQueueGetLength(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return (int) (tail - head);
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return one if the queue is empty, other wise it will return zero.
+ *
+ * @param queue the queue address
+ * @return it will return one if the queue is empty, other wise it will return zero
+ */
+
+int spscQueueIsEmpty(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return spscQueueGetLength(queue) == 0;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will return the maximum number of items in the queue.
+ *
+ * @param queue the queue address
+ * @return it will return the queue capacity
+ */
+
+int spscQueueGetCapacity(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return queue->capacity;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will remove and free all the queue items.
+ *
+ * Note: this function should only be called when the producer and the consumer are stopped.
+ *
+ * @param queue the queue address
+ */
+
+void clearSPSCQueue(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    for (size_t i = head; i != tail; i++)
+        queue->freeItem(queue->memory[i & queue->mask]);
+
+    atomic_store_explicit(&queue->head, tail, memory_order_relaxed);
+    queue->headCache = queue->tailCache = tail;
+
+}
+
+
+
+
+
+/** This function will take the queue address as a parameter,
+ * then it will destroy and free the queue and all it's items.
+ *
+ * Note: this function should only be called when the producer and the consumer are stopped.
+ *
+ * @param queue the queue address
+ */
+
+void destroySPSCQueue(SPSCQueue *queue) {
+    if (queue == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "queue", "spsc queue data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearSPSCQueue(queue);
+    free(queue->memory);
+    free(queue);
+
+}
+
+
+
+
+
+/** This function will take the queue address, the first index, the items array, and the items count as a parameters,
+ * then it will copy the items into the slots that start from the index,
+ * and if the slots are wrapped around the end of the ring memory then the items will be copied in two parts.
+ *
+ * Note: this function should only be called from the spsc queue functions.
+ *
+ * @param queue the queue address
+ * @param index the index of the first slot
+ * @param items the items array
+ * @param count the number of items
+ */
+
+void spscQueueCopyIn(SPSCQueue *queue, size_t index, void **items, int count) {
+    size_t firstSlot = index & queue->mask;
+    size_t firstPartLength = (size_t) queue->capacity - firstSlot < (size_t) count ? (size_t) queue->capacity - firstSlot : (size_t) count;
+
+    memcpy(queue->memory + firstSlot, items, sizeof(void *) * firstPartLength);
+    memcpy(queue->memory, items + firstPartLength, sizeof(void *) * (count - firstPartLength));
+
+}
+
+
+
+
+
+/** This function will take the queue address, the first index, the output array, and the items count as a parameters,
+ * then it will copy the items of the slots that start from the index into the output array,
+ * and if the slots are wrapped around the end of the ring memory then the items will be copied in two parts.
+ *
+ * Note: this function should only be called from the spsc queue functions.
+ *
+ * @param queue the queue address
+ * @param index the index of the first slot
+ * @param output the output array
+ * @param count the number of items
+ */
+
+void spscQueueCopyOut(SPSCQueue *queue, size_t index, void **output, int count) {
+    size_t firstSlot = index & queue->mask;
+    size_t firstPartLength = (size_t) queue->capacity - firstSlot < (size_t) count ? (size_t) queue->capacity - firstSlot : (size_t) count;
+
+    memcpy(output, queue->memory + firstSlot, sizeof(void *) * firstPartLength);
+    memcpy(output + firstPartLength, queue->memory, sizeof(void *) * (count - firstPartLength));
+
+}
@@ -334,11 +334,17 @@ int dlStackEquals(DLinkedListStack *fStack, DLinkedListStack *sStack, int (*cmp)
     if (doublyLinkedListGetLength(fStack->linkedList) != doublyLinkedListGetLength(sStack->linkedList))
         return 0;
 
-    for (int i = 0; i < doublyLinkedListGetLength(fStack->linkedList); i++) {
+    DoublyLinkedListCursor fCursor, sCursor;
+    doublyLinkedListCursorInitialization(&fCursor, fStack->linkedList);
+    doublyLinkedListCursorInitialization(&sCursor, sStack->linkedList);
 
-        if ( cmp(doublyLinkedListGet(fStack->linkedList, i), doublyLinkedListGet(sStack->linkedList, i)) != 0 )
+    for (void *item; (item = doublyLinkedListCursorGet(&fCursor)) != NULL; ) {
+
+        if ( cmp(item, doublyLinkedListCursorGet(&sCursor)) != 0 )
             return 0;
 
+        doublyLinkedListCursorNext(&fCursor);
+        doublyLinkedListCursorNext(&sCursor);
     }
 
     return 1;
@@ -391,9 +397,12 @@ int dlStackContains(DLinkedListStack *fStack, void *item, int (*cmp)(const void
         #endif
     }
 
-    for (int i = 0; i < doublyLinkedListGetLength(fStack->linkedList); i++) {
+    DoublyLinkedListCursor cursor;
+    doublyLinkedListCursorInitialization(&cursor, fStack->linkedList);
+
+    for (void *currentItem; (currentItem = doublyLinkedListCursorGet(&cursor)) != NULL; doublyLinkedListCursorNext(&cursor)) {
 
-        if ( cmp(item, doublyLinkedListGet(fStack->linkedList, i)) == 0 )
+        if ( cmp(item, currentItem) == 0 )
             return 1;
 
     }
@@ -1,6 +1,8 @@
 #ifndef C_DATASTRUCTURES_STRING_H
 #define C_DATASTRUCTURES_STRING_H
 
+#include "../../Lists/Headers/GapBuffer.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -40,6 +42,8 @@ void stringChangeStringC(String *string, char *newCharArr);
 
 void stringChangeStringS(String *string, String *newString);
 
+void stringChangeStringG(String *string, GapBuffer *buffer);
+
 int stringGetIndex(String *string, char c);
 
 char stringGet(String *string, int index);
@@ -52,6 +56,8 @@ char *stringToCharArray(String *string);
 
 char *stringToCustomCharArray(String *string, int startIndex, int endIndex);
 
+GapBuffer *stringToGapBuffer(String *string);
+
 int stringEqualsC(String *string, char *charArr);
 
 int stringEqualsS(String *string, String *sString);
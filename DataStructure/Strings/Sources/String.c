@@ -404,6 +404,63 @@ void stringChangeStringS(String *string, String *newString) {
 
 
 
+/** This function will take the string address, and a characters gap buffer address as a parameters,
+ * then it will change the string to the gap buffer characters.
+ *
+ * Note: the gap buffer items should be characters, so it's item size should be one byte.
+ *
+ * @param string the string address
+ * @param buffer the characters gap buffer address
+ */
+
+void stringChangeStringG(String *string, GapBuffer *buffer) {
+    if (string == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "string", "string data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    } else if (buffer == NULL || buffer->elemSize != sizeof(char)) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "characters gap buffer pointer", "string data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    }
+
+    int bufferLength = gapBufferGetLength(buffer);
+    if (bufferLength > string->length) {
+        char *newString = (char *) realloc(string->string, sizeof(char) * (bufferLength + 1));
+        if (newString == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		    ERROR_TEST->errorCode = FAILED_REALLOCATION;
+     		    return;
+            #else
+                fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "string array", "string data structure");
+     	    	exit(FAILED_REALLOCATION);
+     	    #endif
+
+        }
+
+        string->string = newString;
+        string->length = bufferLength;
+    }
+
+    memcpy(string->string, gapBufferGetArray(buffer), sizeof(char) * bufferLength);
+    string->count = bufferLength;
+    string->string[string->count] = '\0';
+
+}
+
+
+
+
 /** This function will take the string address, and the character as a parameters,
  * then it will return the first occur of this character in the string and will return it's index,
  * other wise it will return minus one (-1).
@@ -699,6 +756,41 @@ char *stringToCustomCharArray(String *string, int startIndex, int endIndex) {
 
 
 
+/** This function will take the string address as a parameter,
+ * then it will copy the string characters into a new characters gap buffer, and return it.
+ *
+ * Note: the gap buffer can be used to do many insertions and deletions around a moving index,
+ * then the result can be copied back to the string using the stringChangeStringG function.
+ *
+ * @param string the string address
+ * @return it will return the new characters gap buffer
+ */
+
+GapBuffer *stringToGapBuffer(String *string) {
+    if (string == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "string", "string data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    }
+
+    GapBuffer *buffer = gapBufferInitialization(sizeof(char), string->count + 1);
+    if (buffer == NULL)
+        return NULL;
+
+    gapBufferAddArrayAtIndex(buffer, 0, string->string, string->count);
+
+    return buffer;
+
+}
+
+
+
+
 /** This function will take the string address as a parameter,
  * then it will return the string length.
  *
@@ -0,0 +1,54 @@
+#ifndef C_DATASTRUCTURES_BLOOMFILTER_H
+#define C_DATASTRUCTURES_BLOOMFILTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct BloomFilter
+*  @brief This structure implements a blocked bloom filter, that keeps all the bits of one item in one cache line.
+*  @var BloomFilter::memory
+*  Member 'memory' is a pointer to the allocated memory, that will be freed when the filter is destroyed.
+*  @var BloomFilter::blocks
+*  Member 'blocks' is a pointer to the first cache line aligned block, and every block holds eight 64 bits words.
+*  @var BloomFilter::blocksNum
+*  Member 'blocksNum' holds the number of the filter blocks.
+*  @var BloomFilter::hashesNum
+*  Member 'hashesNum' holds the number of bits that every item sets in it's block.
+*  @var BloomFilter::count
+*  Member 'count' holds the number of the inserted items.
+*  @var BloomFilter::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the item.
+*/
+
+typedef struct BloomFilter {
+    void *memory;
+    uint64_t *blocks;
+    int blocksNum;
+    int hashesNum;
+    int count;
+    int (*hashFun)(const void *);
+} BloomFilter;
+
+
+BloomFilter *bloomFilterInitialization(int expectedItems, double falsePositiveRate, int (*hashFun)(const void *));
+
+void bloomFilterInsert(BloomFilter *filter, void *item);
+
+int bloomFilterContains(BloomFilter *filter, void *item);
+
+int bloomFilterGetLength(BloomFilter *filter);
+
+void clearBloomFilter(BloomFilter *filter);
+
+void destroyBloomFilter(BloomFilter *filter);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_BLOOMFILTER_H
@@ -0,0 +1,96 @@
+#ifndef C_DATASTRUCTURES_CACHE_H
+#define C_DATASTRUCTURES_CACHE_H
+
+#include "LinkedListHashMap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @enum CachePolicy
+*  @brief This enum holds the eviction policies that the cache supports.
+*/
+
+typedef enum CachePolicy {
+    CACHE_LRU,  ///< evict the least recently used entry
+    CACHE_LFU   ///< evict the least frequently used entry, and the least recently used one between equal frequencies
+} CachePolicy;
+
+
+
+/** @struct Cache
+*  @brief This structure implements a bounded cache with O(1) get, put, and eviction.
+*  Every index entry points at it's cache node, and the nodes are linked in intrusive doubly linked lists that keep the eviction order.
+*  @var Cache::index
+*  Member 'index' is a pointer to the hashmap that maps every key to it's cache node.
+*  @var Cache::lowestList
+*  Member 'lowestList' is a pointer to the list that holds the next eviction candidates,
+*  the LRU cache has only this list, and the LFU cache has one list for every used frequency.
+*  @var Cache::policy
+*  Member 'policy' holds the cache eviction policy.
+*  @var Cache::capacity
+*  Member 'capacity' holds the maximum total weight of the cache entries.
+*  @var Cache::weight
+*  Member 'weight' holds the current total weight of the cache entries.
+*  @var Cache::hitsCount
+*  Member 'hitsCount' holds the number of the get calls that found their key.
+*  @var Cache::missesCount
+*  Member 'missesCount' holds the number of the get calls that didn't find their key.
+*  @var Cache::weightFun
+*  Member 'weightFun' is a pointer to the function that returns the weight of an entry, or NULL if every entry weighs one.
+*  @var Cache::evictionFun
+*  Member 'evictionFun' is a pointer to the function that will be called with every evicted entry, or NULL.
+*  @var Cache::freeKey
+*  Member 'freeKey' is a pointer to the key freeing function, that frees the cache keys.
+*  @var Cache::freeItem
+*  Member 'freeItem' is a pointer to the item freeing function, that frees the cache items.
+*/
+
+typedef struct Cache {
+    LinkedListHashMap *index;
+    struct CacheList *lowestList;
+    CachePolicy policy;
+    long capacity;
+    long weight;
+    long hitsCount;
+    long missesCount;
+    long (*weightFun)(const void *, const void *);
+    void (*evictionFun)(void *, void *);
+    void (*freeKey)(void *);
+    void (*freeItem)(void *);
+} Cache;
+
+
+Cache *cacheInitialization(CachePolicy policy, long capacity, long (*weightFun)(const void *, const void *), void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void cacheSetEvictionFun(Cache *cache, void (*evictionFun)(void *, void *));
+
+void cachePut(Cache *cache, void *key, void *item);
+
+void *cacheGet(Cache *cache, void *key);
+
+int cacheContains(Cache *cache, void *key);
+
+void cacheDelete(Cache *cache, void *key);
+
+int cacheGetLength(Cache *cache);
+
+long cacheGetWeight(Cache *cache);
+
+long cacheGetHitsCount(Cache *cache);
+
+long cacheGetMissesCount(Cache *cache);
+
+void cacheResetCounters(Cache *cache);
+
+void clearCache(Cache *cache);
+
+void destroyCache(Cache *cache);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_CACHE_H
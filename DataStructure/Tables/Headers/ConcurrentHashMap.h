@@ -0,0 +1,115 @@
+#ifndef C_DATASTRUCTURES_CONCURRENTHASHMAP_H
+#define C_DATASTRUCTURES_CONCURRENTHASHMAP_H
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct CHashMapNode
+*  @brief This structure implements a concurrent hashmap chain node.
+*  @var CHashMapNode::key
+*  Member 'key' is a pointer to the node key.
+*  @var CHashMapNode::item
+*  Member 'item' is a pointer to the node item.
+*  @var CHashMapNode::hash
+*  Member 'hash' holds the mixed hash of the key, so the segment can grow without calling the hash function again.
+*  @var CHashMapNode::next
+*  Member 'next' is a pointer to the next node in the same bucket.
+*/
+
+typedef struct CHashMapNode {
+    void *key;
+    void *item;
+    unsigned int hash;
+    struct CHashMapNode *next;
+} CHashMapNode;
+
+
+
+/** @struct CHashMapSegment
+*  @brief This structure implements one independently locked part of the concurrent hashmap.
+*  @var CHashMapSegment::lock
+*  Member 'lock' is the read write lock that guards the segment buckets.
+*  @var CHashMapSegment::buckets
+*  Member 'buckets' is a pointer to the segment buckets array.
+*  @var CHashMapSegment::length
+*  Member 'length' holds the number of buckets, and it's always a power of two.
+*  @var CHashMapSegment::count
+*  Member 'count' holds the current number of items in the segment.
+*  @var CHashMapSegment::padding
+*  Member 'padding' keeps two neighbour segments locks in different cache lines.
+*/
+
+typedef struct CHashMapSegment {
+    pthread_rwlock_t lock;
+    CHashMapNode **buckets;
+    int length;
+    int count;
+    char padding[64];
+} CHashMapSegment;
+
+
+
+/** @struct ConcurrentHashMap
+*  @brief This structure implements a generic thread safe hashmap, that splits the keys over independently locked segments.
+*  @var ConcurrentHashMap::segments
+*  Member 'segments' is a pointer to the segments array.
+*  @var ConcurrentHashMap::segmentsNum
+*  Member 'segmentsNum' holds the number of segments, and it's always a power of two.
+*  @var ConcurrentHashMap::segmentShift
+*  Member 'segmentShift' holds the number of hash bits used to choose the segment.
+*  @var ConcurrentHashMap::freeKeyFun
+*  Member 'freeKeyFun' is a pointer to the key freeing function, that frees the hashmap keys.
+*  @var ConcurrentHashMap::freeItemFun
+*  Member 'freeItemFun' is a pointer to the item freeing function, that frees the hashmap items.
+*  @var ConcurrentHashMap::keyComp
+*  Member 'keyComp' is a pointer to the key comparator function, that compare the hashmap keys.
+*  @var ConcurrentHashMap::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the hashmap key.
+*/
+
+typedef struct ConcurrentHashMap {
+    CHashMapSegment *segments;
+    int segmentsNum;
+    int segmentShift;
+    void (*freeKeyFun)(void *);
+    void (*freeItemFun)(void *);
+    int (*keyComp)(const void *, const void *);
+    int (*hashFun)(const void *);
+} ConcurrentHashMap;
+
+
+ConcurrentHashMap *concurrentHashMapInitialization(int segmentsNum, void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void concurrentHashMapInsert(ConcurrentHashMap *map, void *key, void *item);
+
+int concurrentHashMapContains(ConcurrentHashMap *map, void *key);
+
+void *concurrentHashMapGet(ConcurrentHashMap *map, void *key);
+
+void *concurrentHashMapComputeIfAbsent(ConcurrentHashMap *map, void *key, void *(*mappingFun)(const void *));
+
+int concurrentHashMapUpdate(ConcurrentHashMap *map, void *key, void (*updateFun)(void *, void *), void *arg);
+
+int concurrentHashMapVisit(ConcurrentHashMap *map, void *key, void (*visitFun)(const void *, void *), void *arg);
+
+void concurrentHashMapDelete(ConcurrentHashMap *map, void *key);
+
+void *concurrentHashMapDeleteWtoFr(ConcurrentHashMap *map, void *key);
+
+int concurrentHashMapGetLength(ConcurrentHashMap *map);
+
+int concurrentHashMapIsEmpty(ConcurrentHashMap *map);
+
+void clearConcurrentHashMap(ConcurrentHashMap *map);
+
+void destroyConcurrentHashMap(ConcurrentHashMap *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_CONCURRENTHASHMAP_H
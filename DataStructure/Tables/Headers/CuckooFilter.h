@@ -0,0 +1,63 @@
+#ifndef C_DATASTRUCTURES_CUCKOOFILTER_H
+#define C_DATASTRUCTURES_CUCKOOFILTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct CuckooFilter
+*  @brief This structure implements a cuckoo filter, that stores a small fingerprint of every item in one of two buckets,
+*  so it can answer membership queries like a bloom filter, and it can also delete items.
+*  @var CuckooFilter::buckets
+*  Member 'buckets' is a pointer to the fingerprints array, and every four fingerprints form one bucket.
+*  @var CuckooFilter::bucketsNum
+*  Member 'bucketsNum' holds the number of the filter buckets, and it's always a power of two.
+*  @var CuckooFilter::fingerprintMask
+*  Member 'fingerprintMask' holds the mask that cuts the item hash to the fingerprint size.
+*  @var CuckooFilter::count
+*  Member 'count' holds the number of the stored fingerprints.
+*  @var CuckooFilter::victimFingerprint
+*  Member 'victimFingerprint' holds the fingerprint that couldn't find a place after the last failed insertion, or zero if there isn't any.
+*  @var CuckooFilter::victimIndex
+*  Member 'victimIndex' holds one of the two buckets indices of the victim fingerprint.
+*  @var CuckooFilter::kickState
+*  Member 'kickState' holds the random generator state that chooses which fingerprint will be kicked out.
+*  @var CuckooFilter::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the item.
+*/
+
+typedef struct CuckooFilter {
+    uint16_t *buckets;
+    int bucketsNum;
+    uint16_t fingerprintMask;
+    int count;
+    uint16_t victimFingerprint;
+    int victimIndex;
+    uint32_t kickState;
+    int (*hashFun)(const void *);
+} CuckooFilter;
+
+
+CuckooFilter *cuckooFilterInitialization(int expectedItems, double falsePositiveRate, int (*hashFun)(const void *));
+
+int cuckooFilterInsert(CuckooFilter *filter, void *item);
+
+int cuckooFilterDelete(CuckooFilter *filter, void *item);
+
+int cuckooFilterContains(CuckooFilter *filter, void *item);
+
+int cuckooFilterGetLength(CuckooFilter *filter);
+
+void clearCuckooFilter(CuckooFilter *filter);
+
+void destroyCuckooFilter(CuckooFilter *filter);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_CUCKOOFILTER_H
@@ -0,0 +1,51 @@
+#ifndef C_DATASTRUCTURES_FILTEREDHASHMAP_H
+#define C_DATASTRUCTURES_FILTEREDHASHMAP_H
+
+#include "HashMap.h"
+#include "CuckooFilter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct FilteredHashMap
+*  @brief This structure implements a hashmap with a cuckoo filter in front of it,
+*  so most of the lookups for missing keys are answered by the filter without probing the hashmap.
+*  @var FilteredHashMap::map
+*  Member 'map' is a pointer to the hashmap that holds the entries.
+*  @var FilteredHashMap::filter
+*  Member 'filter' is a pointer to the cuckoo filter that holds the keys fingerprints.
+*  @var FilteredHashMap::falsePositiveRate
+*  Member 'falsePositiveRate' holds the filter false positive rate, so the filter can be rebuilt with the same rate when it's full.
+*/
+
+typedef struct FilteredHashMap {
+    HashMap *map;
+    CuckooFilter *filter;
+    double falsePositiveRate;
+} FilteredHashMap;
+
+
+FilteredHashMap *filteredHashMapInitialization(int expectedItems, double falsePositiveRate, void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void filteredHashMapInsert(FilteredHashMap *map, void *key, void *item);
+
+void filteredHashMapDelete(FilteredHashMap *map, void *key);
+
+int filteredHashMapContains(FilteredHashMap *map, void *key);
+
+void *filteredHashMapGet(FilteredHashMap *map, void *key);
+
+int filteredHashMapGetLength(FilteredHashMap *map);
+
+void clearFilteredHashMap(FilteredHashMap *map);
+
+void destroyFilteredHashMap(FilteredHashMap *map);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_FILTEREDHASHMAP_H
@@ -0,0 +1,51 @@
+#ifndef C_DATASTRUCTURES_FILTEREDHASHSET_H
+#define C_DATASTRUCTURES_FILTEREDHASHSET_H
+
+#include "HashSet.h"
+#include "CuckooFilter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct FilteredHashSet
+*  @brief This structure implements a hashset with a cuckoo filter in front of it,
+*  so most of the lookups for missing items are answered by the filter without probing the hashset.
+*  @var FilteredHashSet::hashSet
+*  Member 'hashSet' is a pointer to the hashset that holds the items.
+*  @var FilteredHashSet::filter
+*  Member 'filter' is a pointer to the cuckoo filter that holds the items fingerprints.
+*  @var FilteredHashSet::falsePositiveRate
+*  Member 'falsePositiveRate' holds the filter false positive rate, so the filter can be rebuilt with the same rate when it's full.
+*/
+
+typedef struct FilteredHashSet {
+    HashSet *hashSet;
+    CuckooFilter *filter;
+    double falsePositiveRate;
+} FilteredHashSet;
+
+
+FilteredHashSet *filteredHashSetInitialization(int expectedItems, double falsePositiveRate, void (*freeItem)(void *), int (*itemComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void filteredHashSetInsert(FilteredHashSet *set, void *item);
+
+void filteredHashSetDelete(FilteredHashSet *set, void *item);
+
+int filteredHashSetContains(FilteredHashSet *set, void *item);
+
+void *filteredHashSetGet(FilteredHashSet *set, void *item);
+
+int filteredHashSetGetLength(FilteredHashSet *set);
+
+void clearFilteredHashSet(FilteredHashSet *set);
+
+void destroyFilteredHashSet(FilteredHashSet *set);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_FILTEREDHASHSET_H
@@ -0,0 +1,88 @@
+#ifndef C_DATASTRUCTURES_FROZENHASHMAP_H
+#define C_DATASTRUCTURES_FROZENHASHMAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "HashMap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @struct FrozenHashMap
+*  @brief This structure implements an immutable hashmap that uses a minimal perfect hash (hash and displace),
+*  so every lookup is one probe and one key comparison.
+*  The keys that have the same hash as another key can't be placed by the perfect hash, so they are kept in a sorted overflow table.
+*  The keys and items are copied by value into one contiguous memory block, so the table can be saved to a file and loaded without rebuilding.
+*  @var FrozenHashMap::memory
+*  Member 'memory' is a pointer to the contiguous block, that holds the table header, the buckets seeds, and the slots.
+*  @var FrozenHashMap::memorySize
+*  Member 'memorySize' holds the size of the memory block in bytes.
+*  @var FrozenHashMap::seeds
+*  Member 'seeds' is a pointer to the buckets seeds, and every seed places the keys of it's bucket in free slots.
+*  @var FrozenHashMap::slots
+*  Member 'slots' is a pointer to the first slot, and every slot holds a key followed by it's item,
+*  the perfect hash places the keys in the first (length - overflowNum) slots, and the overflow keys fill the rest.
+*  @var FrozenHashMap::overflowHashes
+*  Member 'overflowHashes' is a pointer to the sorted hashes of the overflow keys, in the same order of their slots.
+*  @var FrozenHashMap::length
+*  Member 'length' holds the number of the entries, and it's also the number of the slots.
+*  @var FrozenHashMap::overflowNum
+*  Member 'overflowNum' holds the number of the keys in the overflow table.
+*  @var FrozenHashMap::bucketsNum
+*  Member 'bucketsNum' holds the number of the buckets seeds.
+*  @var FrozenHashMap::keySize
+*  Member 'keySize' holds the size of one key in bytes.
+*  @var FrozenHashMap::itemSize
+*  Member 'itemSize' holds the size of one item in bytes.
+*  @var FrozenHashMap::slotSize
+*  Member 'slotSize' holds the size of one slot in bytes.
+*  @var FrozenHashMap::itemOffset
+*  Member 'itemOffset' holds the offset of the item from the start of it's slot.
+*  @var FrozenHashMap::keyComp
+*  Member 'keyComp' is a pointer to the key comparator function, that compare the map keys.
+*  @var FrozenHashMap::hashFun
+*  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the key.
+*/
+
+typedef struct FrozenHashMap {
+    void *memory;
+    size_t memorySize;
+    uint32_t *seeds;
+    char *slots;
+    uint64_t *overflowHashes;
+    int length;
+    int overflowNum;
+    int bucketsNum;
+    int keySize;
+    int itemSize;
+    int slotSize;
+    int itemOffset;
+    int (*keyComp)(const void *, const void *);
+    int (*hashFun)(const void *);
+} FrozenHashMap;
+
+
+FrozenHashMap *frozenHashMapBuild(HashMap *map, int keySize, int itemSize);
+
+FrozenHashMap *frozenHashMapBuildFromArrays(void **keys, void **items, int length, int keySize, int itemSize, int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void *frozenHashMapGet(FrozenHashMap *map, void *key);
+
+int frozenHashMapContains(FrozenHashMap *map, void *key);
+
+int frozenHashMapGetLength(FrozenHashMap *map);
+
+void frozenHashMapSave(FrozenHashMap *map, char *filePath);
+
+FrozenHashMap *frozenHashMapLoad(char *filePath, int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
+void destroyFrozenHashMap(FrozenHashMap *map);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //C_DATASTRUCTURES_FROZENHASHMAP_H
@@ -58,14 +58,37 @@ typedef struct HashMap {
     int (*hashFun)(const void *);
 } HashMap;
 
+
+
+/** @struct HashMapIterator
+*  @brief This structure implements a cursor that walks over the hashmap entries without allocating any memory.
+*  @var HashMapIterator::map
+*  Member 'map' is a pointer to the hashmap that the iterator walks over.
+*  @var HashMapIterator::index
+*  Member 'index' holds the index of the current entry in the hashmap array.
+*/
+
+typedef struct HashMapIterator {
+    HashMap *map;
+    int index;
+} HashMapIterator;
+
 HashMap *hashMapInitialization(void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
 
+HashMap *hashMapInitializationWithCapacity(int capacity, void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
+
 void hashMapInsert(HashMap *map, void *key, void *item);
 
+void hashMapInsertBatch(HashMap *map, void **keys, void **items, int length);
+
 int hashMapContains(HashMap *map, void *key);
 
+void hashMapContainsBatch(HashMap *map, void **keys, int length, int *results);
+
 void *hashMapGet(HashMap *map, void *key);
 
+void hashMapGetBatch(HashMap *map, void **keys, int length, void **items);
+
 void *hashMapGetKey(HashMap *map, void *key);
 
 void hashMapDelete(HashMap *map, void *key);
@@ -78,10 +101,24 @@ void **hashMapToArray(HashMap *map);
 
 Entry **hashMapToEntryArray(HashMap *map);
 
+void hashMapReserve(HashMap *map, int capacity);
+
+void hashMapShrinkToFit(HashMap *map);
+
 int hashMapGetLength(HashMap *map);
 
 int hashMapIsEmpty(HashMap *map);
 
+void hashMapIteratorBegin(HashMap *map, HashMapIterator *iterator);
+
+int hashMapIteratorNext(HashMapIterator *iterator);
+
+void *hashMapIteratorKey(HashMapIterator *iterator);
+
+void *hashMapIteratorValue(HashMapIterator *iterator);
+
+void hashMapIteratorRemove(HashMapIterator *iterator);
+
 void clearHashMap(HashMap *map);
 
 void destroyHashMap(HashMap *map);
@@ -36,8 +36,25 @@ typedef struct HashSet {
 } HashSet;
 
 
+
+/** @struct HashSetIterator
+*  @brief This structure implements a cursor that walks over the hashset items without allocating any memory.
+*  @var HashSetIterator::hashSet
+*  Member 'hashSet' is a pointer to the hashset that the iterator walks over.
+*  @var HashSetIterator::index
+*  Member 'index' holds the index of the current item in the hashset array.
+*/
+
+typedef struct HashSetIterator {
+    HashSet *hashSet;
+    int index;
+} HashSetIterator;
+
+
 HashSet *hashSetInitialization(void (*freeItem)(void *), int (*itemComp)(const void *, const void *), int (*hashFun)(const void *));
 
+HashSet *hashSetInitializationWithCapacity(int capacity, void (*freeItem)(void *), int (*itemComp)(const void *, const void *), int (*hashFun)(const void *));
+
 void hashSetInsert(HashSet *hashSet, void *item);
 
 void hashSetDelete(HashSet *hashSet, void *item);
@@ -50,10 +67,36 @@ void *hashSetGet(HashSet *hashSet, void *item);
 
 void **hashSetToArray(HashSet *hashSet);
 
+HashSet *hashSetUnion(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *));
+
+HashSet *hashSetIntersection(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *));
+
+HashSet *hashSetDifference(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *));
+
+int hashSetIsSubset(HashSet *firstSet, HashSet *secondSet);
+
+void hashSetUnionInPlace(HashSet *firstSet, HashSet *secondSet);
+
+void hashSetIntersectionInPlace(HashSet *firstSet, HashSet *secondSet);
+
+void hashSetDifferenceInPlace(HashSet *firstSet, HashSet *secondSet);
+
+void hashSetReserve(HashSet *hashSet, int capacity);
+
+void hashSetShrinkToFit(HashSet *hashSet);
+
 int hashSetGetLength(HashSet *hashSet);
 
 int hashSetIsEmpty(HashSet *hashSet);
 
+void hashSetIteratorBegin(HashSet *hashSet, HashSetIterator *iterator);
+
+int hashSetIteratorNext(HashSetIterator *iterator);
+
+void *hashSetIteratorItem(HashSetIterator *iterator);
+
+void hashSetIteratorRemove(HashSetIterator *iterator);
+
 void clearHashSet(HashSet *hashSet);
 
 void destroyHashSet(HashSet *hashSet);
@@ -28,34 +28,82 @@ typedef struct Entry {
 
 
 
-/** @struct HashMap
-*  @brief This structure implements a basic generic hashmap using doubly linked list.
-*  @var HashMap::arr
-*  Member 'arr' is a pointer to the doubly linked list hashmap array.
-*  @var HashMap::length
+/** @struct LLHashMapNode
+*  @brief This structure implements a linked list hashmap chain node, that holds the entry itself.
+*  @var LLHashMapNode::entry
+*  Member 'entry' holds the node key and item.
+*  @var LLHashMapNode::hash
+*  Member 'hash' holds the hash of the entry key, so the map doesn't need to call the hash function again when it grows.
+*  @var LLHashMapNode::next
+*  Member 'next' is a pointer to the next node in the same chain, or to the next free node if the node is free.
+*/
+
+typedef struct LLHashMapNode {
+    Entry entry;
+    unsigned int hash;
+    struct LLHashMapNode *next;
+} LLHashMapNode;
+
+
+
+/** @struct LinkedListHashMap
+*  @brief This structure implements a basic generic hashmap using separate chaining.
+*  @var LinkedListHashMap::arr
+*  Member 'arr' is a pointer to the chains heads array.
+*  @var LinkedListHashMap::length
 *  Member 'length' holds the size of the allocated array.
-*  @var HashMap::count
+*  @var LinkedListHashMap::count
 *  Member 'count' holds the current number of items in the hashmap.
-*  @var HashMap::freeItemFun
+*  @var LinkedListHashMap::freeNodes
+*  Member 'freeNodes' is a pointer to the first free node, that will be used by the next insertion.
+*  @var LinkedListHashMap::slabs
+*  Member 'slabs' is a pointer to the last allocated nodes slab.
+*  @var LinkedListHashMap::slabLength
+*  Member 'slabLength' holds the number of nodes in the last allocated slab.
+*  @var LinkedListHashMap::freeItemFun
 *  Member 'freeItemFun' is a pointer to the item freeing function, that frees the hashmap items.
-*  @var HashMap::freeKeyFun
+*  @var LinkedListHashMap::freeKeyFun
 *  Member 'freeKeyFun' is a pointer to the key freeing function, that frees the hashmap key.
-*  @var HashMap::keyCompFun
+*  @var LinkedListHashMap::keyCompFun
 *  Member 'keyCompFun' is a pointer to the key comparator function, that compare the hashmap keys.
-*  @var HashMap::hashFun
+*  @var LinkedListHashMap::hashFun
 *  Member 'hashFun' is a pointer to the hashing function, that returns an unique number representing the hashmap item.
 */
 
 typedef struct LinkedListHashMap {
-    struct DoublyLinkedList **arr;
+    LLHashMapNode **arr;
     int length;
     int count;
+    LLHashMapNode *freeNodes;
+    struct LLHashMapSlab *slabs;
+    int slabLength;
     void (*freeKeyFun)(void *);
     void (*freeItemFun)(void *);
     int (*keyCompFun)(const void *, const void *);
     int (*hashFun)(const void *);
 } LinkedListHashMap;
 
+
+
+/** @struct LLHashMapIterator
+*  @brief This structure implements a cursor that walks over the linked list hashmap entries without allocating any memory.
+*  @var LLHashMapIterator::map
+*  Member 'map' is a pointer to the hashmap that the iterator walks over.
+*  @var LLHashMapIterator::bucketIndex
+*  Member 'bucketIndex' holds the index of the current chain in the hashmap array.
+*  @var LLHashMapIterator::prevNode
+*  Member 'prevNode' is a pointer to the node before the current node in the current chain.
+*  @var LLHashMapIterator::node
+*  Member 'node' is a pointer to the current node.
+*/
+
+typedef struct LLHashMapIterator {
+    LinkedListHashMap *map;
+    int bucketIndex;
+    LLHashMapNode *prevNode;
+    LLHashMapNode *node;
+} LLHashMapIterator;
+
 LinkedListHashMap *
 linkedListHashMapInitialization(int mapLength, void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *));
 
@@ -81,6 +129,16 @@ int lLHashMapGetLength(LinkedListHashMap *map);
 
 int lLHashMapIsEmpty(LinkedListHashMap *map);
 
+void lLHashMapIteratorBegin(LinkedListHashMap *map, LLHashMapIterator *iterator);
+
+int lLHashMapIteratorNext(LLHashMapIterator *iterator);
+
+void *lLHashMapIteratorKey(LLHashMapIterator *iterator);
+
+void *lLHashMapIteratorValue(LLHashMapIterator *iterator);
+
+void lLHashMapIteratorRemove(LLHashMapIterator *iterator);
+
 void clearLLHashMap(LinkedListHashMap *map);
 
 void destroyLLHashMap(LinkedListHashMap *map);
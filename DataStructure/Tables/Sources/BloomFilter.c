@@ -0,0 +1,373 @@
+#include "../Headers/BloomFilter.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+#include <math.h>
+
+
+/// The number of 64 bits words in one block, so the block fills one 64 bytes cache line.
+#define BLOOM_FILTER_BLOCK_WORDS 8
+
+/// The number of bits in one block.
+#define BLOOM_FILTER_BLOCK_BITS (BLOOM_FILTER_BLOCK_WORDS * 64)
+
+/// The maximum number of bits that one item can set.
+#define BLOOM_FILTER_MAX_HASHES 16
+
+
+
+uint64_t bloomFilterHashCal(BloomFilter *filter, void *item);
+
+uint64_t *bloomFilterGetBlock(BloomFilter *filter, uint64_t hash);
+
+uint64_t bloomFilterNextBits(uint64_t hash, int round);
+
+
+
+
+
+/** This function will take the expected number of items, the wanted false positive rate, and the hashing function as a parameters,
+ * then it will allocate a new blocked bloom filter that can hold the expected items with the passed false positive rate,
+ * then the function will return the address of the filter.
+ *
+ * Note: every item will only touch one 64 bytes block, so a lookup costs one cache miss,
+ * and that makes the real false positive rate slightly higher than a classic bloom filter with the same size,
+ * so the filter will allocate a little more bits than the classic formula to balance that.
+ *
+ * Note: the filter can't delete items, use the cuckoo filter if you need to delete.
+ *
+ * @param expectedItems the number of items that the filter is expected to hold
+ * @param falsePositiveRate the wanted false positive rate, and it should be between zero and one
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new bloom filter address
+ */
+
+BloomFilter *bloomFilterInitialization(int expectedItems, double falsePositiveRate, int (*hashFun)(const void *)) {
+    if (expectedItems <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "expected items number", "bloom filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (falsePositiveRate <= 0 || falsePositiveRate >= 1) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "false positive rate", "bloom filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "bloom filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    BloomFilter *filter = (BloomFilter *) malloc(sizeof(BloomFilter));
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filter", "bloom filter data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    double ln2 = log(2);
+    double bitsPerItem = -log(falsePositiveRate) / (ln2 * ln2);
+
+    int hashesNum = (int) (bitsPerItem * ln2 + 0.5);
+    if (hashesNum < 1)
+        hashesNum = 1;
+    else if (hashesNum > BLOOM_FILTER_MAX_HASHES)
+        hashesNum = BLOOM_FILTER_MAX_HASHES;
+
+    // the blocks don't fill evenly, and the uneven fill hurts more when every item sets more bits,
+    // so the filter gets 2% more bits for every hash.
+    double bitsNum = bitsPerItem * (1 + 0.02 * hashesNum) * expectedItems;
+    filter->blocksNum = (int) ceil(bitsNum / BLOOM_FILTER_BLOCK_BITS);
+    if (filter->blocksNum < 1)
+        filter->blocksNum = 1;
+
+    size_t blocksSize = sizeof(uint64_t) * BLOOM_FILTER_BLOCK_WORDS * filter->blocksNum;
+    filter->memory = calloc(1, blocksSize + 64);
+    if (filter->memory == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(filter);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filter blocks", "bloom filter data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    filter->blocks = (uint64_t *) (((uintptr_t) filter->memory + 63) & ~(uintptr_t) 63);
+    filter->hashesNum = hashesNum;
+    filter->count = 0;
+    filter->hashFun = hashFun;
+
+    return filter;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will add the item to the filter.
+ *
+ * Note: the filter will not hold the item address, it will only set the item bits.
+ *
+ * @param filter the bloom filter address
+ * @param item the item address
+ */
+
+void bloomFilterInsert(BloomFilter *filter, void *item) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "bloom filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "bloom filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint64_t hash = bloomFilterHashCal(filter, item);
+    uint64_t *block = bloomFilterGetBlock(filter, hash);
+
+    uint64_t innerHash = hash;
+
+    for (int i = 0; i < filter->hashesNum; i++) {
+        innerHash = bloomFilterNextBits(innerHash, i);
+        uint32_t bit = (uint32_t) (innerHash >> 55);
+        block[bit / 64] |= (uint64_t) 1 << (bit % 64);
+    }
+
+    filter->count++;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will return one (1) if the item may be in the filter,
+ * other wise it will return zero (0) if the item is surely not in the filter.
+ *
+ * @param filter the bloom filter address
+ * @param item the item address
+ * @return it will return one if the item may be in the filter, and zero if it's surely not in the filter
+ */
+
+int bloomFilterContains(BloomFilter *filter, void *item) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "bloom filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "bloom filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    uint64_t hash = bloomFilterHashCal(filter, item);
+    uint64_t *block = bloomFilterGetBlock(filter, hash);
+
+    uint64_t innerHash = hash;
+
+    for (int i = 0; i < filter->hashesNum; i++) {
+        innerHash = bloomFilterNextBits(innerHash, i);
+        uint32_t bit = (uint32_t) (innerHash >> 55);
+        if ((block[bit / 64] & ((uint64_t) 1 << (bit % 64))) == 0)
+            return 0;
+
+    }
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will return the number of the inserted items.
+ *
+ * Note: inserting the same item more than one time will be counted every time.
+ *
+ * @param filter the bloom filter address
+ * @return it will return the number of the inserted items
+ */
+
+int bloomFilterGetLength(BloomFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "bloom filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return filter->count;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will remove all the items from the filter without freeing it.
+ *
+ * @param filter the bloom filter address
+ */
+
+void clearBloomFilter(BloomFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "bloom filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    memset(filter->blocks, 0, sizeof(uint64_t) * BLOOM_FILTER_BLOCK_WORDS * filter->blocksNum);
+    filter->count = 0;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will destroy and free the filter.
+ *
+ * @param filter the bloom filter address
+ */
+
+void destroyBloomFilter(BloomFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "bloom filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(filter->memory);
+    free(filter);
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will call the filter hashing function and spread the returned value over 64 bits.
+ *
+ * Note: the hashing functions usually return close values for close items, so the value needs to be mixed
+ * before using it's bits to choose the block and the bits in the block.
+ *
+ * Note: this function should only be called from the bloom filter functions.
+ *
+ * @param filter the bloom filter address
+ * @param item the item address
+ * @return it will return the mixed 64 bits hash
+ */
+
+uint64_t bloomFilterHashCal(BloomFilter *filter, void *item) {
+    uint64_t hash = (uint32_t) filter->hashFun(item);
+
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+
+    return hash;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item mixed hash as a parameters,
+ * then it will return the address of the block that holds the item bits.
+ *
+ * Note: this function should only be called from the bloom filter functions.
+ *
+ * @param filter the bloom filter address
+ * @param hash the item mixed hash
+ * @return it will return the item block address
+ */
+
+uint64_t *bloomFilterGetBlock(BloomFilter *filter, uint64_t hash) {
+    uint64_t blockIndex = (hash >> 32) * (uint64_t) filter->blocksNum >> 32;
+    return filter->blocks + blockIndex * BLOOM_FILTER_BLOCK_WORDS;
+}
+
+
+
+
+
+/** This function will take the item hash, and the round number as a parameters,
+ * then it will return a new mixed value, that it's top nine bits choose the next bit in the item block.
+ *
+ * Note: this function should only be called from the bloom filter functions.
+ *
+ * @param hash the item hash or the value that the previous round returned
+ * @param round the index of the bit that will be chosen
+ * @return it will return the next mixed value
+ */
+
+uint64_t bloomFilterNextBits(uint64_t hash, int round) {
+    hash = (hash ^ (uint64_t) round) * 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 29);
+}
@@ -0,0 +1,914 @@
+#include "../Headers/Cache.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+/// The length that the cache index starts with, the index grows when it gets full.
+#define CACHE_INDEX_INITIAL_LENGTH 16
+
+
+
+/** @struct CacheNode
+*  @brief This structure implements a cache entry, that is linked in it's eviction list.
+*  @var CacheNode::key
+*  Member 'key' is a pointer to the entry key.
+*  @var CacheNode::item
+*  Member 'item' is a pointer to the entry item.
+*  @var CacheNode::weight
+*  Member 'weight' holds the entry weight.
+*  @var CacheNode::list
+*  Member 'list' is a pointer to the eviction list that holds the node.
+*  @var CacheNode::prev
+*  Member 'prev' is a pointer to the previous node in the list, that was used more recently.
+*  @var CacheNode::next
+*  Member 'next' is a pointer to the next node in the list, that was used less recently.
+*/
+
+typedef struct CacheNode {
+    void *key;
+    void *item;
+    long weight;
+    struct CacheList *list;
+    struct CacheNode *prev;
+    struct CacheNode *next;
+} CacheNode;
+
+
+
+/** @struct CacheList
+*  @brief This structure implements an eviction list, that orders it's nodes from the most recently used to the least recently used.
+*  @var CacheList::frequency
+*  Member 'frequency' holds the number of uses of every node in the list, and it's only used by the LFU cache.
+*  @var CacheList::head
+*  Member 'head' is a pointer to the most recently used node.
+*  @var CacheList::tail
+*  Member 'tail' is a pointer to the least recently used node.
+*  @var CacheList::prev
+*  Member 'prev' is a pointer to the list with the lower frequency.
+*  @var CacheList::next
+*  Member 'next' is a pointer to the list with the higher frequency.
+*/
+
+typedef struct CacheList {
+    unsigned long frequency;
+    CacheNode *head;
+    CacheNode *tail;
+    struct CacheList *prev;
+    struct CacheList *next;
+} CacheList;
+
+
+
+void cacheNoFree(void *pointer);
+
+CacheList *cacheNewList(Cache *cache, unsigned long frequency, CacheList *prevList, CacheList *nextList);
+
+void cacheListPushHead(CacheList *list, CacheNode *node);
+
+void cacheListUnlink(Cache *cache, CacheNode *node);
+
+void cacheTouch(Cache *cache, CacheNode *node);
+
+void cacheRemoveNode(Cache *cache, CacheNode *node, int evicted);
+
+void cacheFreeNodes(Cache *cache);
+
+
+
+
+
+/** This function will take the eviction policy, the capacity, the weight function, the key freeing function, the item freeing function,
+ * the key comparator function, and the hashing function as a parameters,
+ * then it will allocate a new empty cache, and it will return it's address.
+ *
+ * Note: if the weight function is NULL, every entry will weigh one, so the capacity will be the maximum number of entries.
+ *
+ * @param policy the eviction policy, CACHE_LRU or CACHE_LFU
+ * @param capacity the maximum total weight of the cache entries
+ * @param weightFun the function that returns the weight of an entry from it's key and item, or NULL
+ * @param freeKey the function address that will be called to free the cache keys
+ * @param freeItem the function address that will be called to free the cache items
+ * @param keyComp the function address that will be called to compare two keys
+ * @param hashFun the hashing function that will return a unique integer representing the key
+ * @return it will return the new cache address
+ */
+
+Cache *cacheInitialization(CachePolicy policy, long capacity, long (*weightFun)(const void *, const void *), void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    if (policy != CACHE_LRU && policy != CACHE_LFU) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "policy", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (capacity <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "capacity", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeKey == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free key function pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free item function pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (keyComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    Cache *cache = (Cache *) malloc(sizeof(Cache));
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "cache", "cache data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // the index doesn't own the keys or the nodes, the cache frees them.
+    cache->index = linkedListHashMapInitialization(CACHE_INDEX_INITIAL_LENGTH, cacheNoFree, cacheNoFree, keyComp, hashFun);
+    if (cache->index == NULL) {
+        free(cache);
+        return NULL;
+    }
+
+    cache->policy = policy;
+    cache->capacity = capacity;
+    cache->weight = 0;
+    cache->hitsCount = 0;
+    cache->missesCount = 0;
+    cache->weightFun = weightFun;
+    cache->evictionFun = NULL;
+    cache->freeKey = freeKey;
+    cache->freeItem = freeItem;
+    cache->lowestList = NULL;
+
+    // the LRU cache keeps it's only list even when it's empty.
+    if (policy == CACHE_LRU && cacheNewList(cache, 0, NULL, NULL) == NULL) {
+        destroyLLHashMap(cache->index);
+        free(cache);
+        return NULL;
+    }
+
+    return cache;
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the eviction function address as a parameters,
+ * then it will set the function that will be called with the key and the item of every evicted entry.
+ *
+ * Note: the eviction function is called before the entry is freed, and it's only called when the capacity forces an eviction,
+ * so the delete and the clear functions will not call it.
+ *
+ * @param cache the cache address
+ * @param evictionFun the eviction function address, or NULL to remove the current one
+ */
+
+void cacheSetEvictionFun(Cache *cache, void (*evictionFun)(void *, void *)) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cache->evictionFun = evictionFun;
+
+}
+
+
+
+
+
+/** This function will take the cache address, the key address, and the item address as a parameters,
+ * then it will insert the entry into the cache, or replace the item if the key already exists,
+ * then it will evict entries until the total weight fits the capacity.
+ *
+ * Note: if the key already exists, the old key and item will be freed, and the entry will count as used.
+ *
+ * Note: an entry that is heavier than the whole capacity will be evicted directly.
+ *
+ * @param cache the cache address
+ * @param key the key address
+ * @param item the item address
+ */
+
+void cachePut(Cache *cache, void *key, void *item) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    long weight = cache->weightFun == NULL ? 1 : cache->weightFun(key, item);
+    if (weight < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "entry weight", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    CacheNode *node = (CacheNode *) lLHashMapGet(cache->index, key);
+
+    if (node != NULL) {
+        // the index will hold the new key, so the old one can be freed.
+        lLHashMapInsert(cache->index, key, node);
+
+        if (node->key != key)
+            cache->freeKey(node->key);
+
+        if (node->item != item)
+            cache->freeItem(node->item);
+
+        node->key = key;
+        node->item = item;
+        cache->weight += weight - node->weight;
+        node->weight = weight;
+
+        cacheTouch(cache, node);
+
+    } else {
+        // the victims are evicted before the new node is linked, so the new entry can't evict itself.
+        while (cache->weight + weight > cache->capacity && cache->lowestList != NULL && cache->lowestList->tail != NULL)
+            cacheRemoveNode(cache, cache->lowestList->tail, 1);
+
+        node = (CacheNode *) malloc(sizeof(CacheNode));
+        if (node == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                return;
+            #else
+                fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "cache data structure");
+                exit(FAILED_ALLOCATION);
+            #endif
+
+        }
+
+        CacheList *list = cache->lowestList;
+        if (cache->policy == CACHE_LFU && (list == NULL || list->frequency != 1)) {
+            list = cacheNewList(cache, 1, NULL, list);
+            if (list == NULL) {
+                free(node);
+                return;
+            }
+
+        }
+
+        node->key = key;
+        node->item = item;
+        node->weight = weight;
+        cacheListPushHead(list, node);
+
+        lLHashMapInsert(cache->index, key, node);
+        cache->weight += weight;
+
+    }
+
+    // an updated entry can grow over the capacity, and a new entry that is heavier than the whole capacity can't be kept.
+    while (cache->weight > cache->capacity)
+        cacheRemoveNode(cache, cache->lowestList->tail, 1);
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the key address as a parameters,
+ * then it will return the item of the key if it exists, other wise it will return NULL.
+ *
+ * Note: a found key will count as a hit and it will be marked as used, and a missing key will count as a miss.
+ *
+ * @param cache the cache address
+ * @param key the key address
+ * @return it will return the key item if found, other wise it will return NULL
+ */
+
+void *cacheGet(Cache *cache, void *key) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    CacheNode *node = (CacheNode *) lLHashMapGet(cache->index, key);
+    if (node == NULL) {
+        cache->missesCount++;
+        return NULL;
+    }
+
+    cache->hitsCount++;
+    cacheTouch(cache, node);
+
+    return node->item;
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the key address as a parameters,
+ * then it will return one (1) if the key exists, other wise it will return zero (0).
+ *
+ * Note: this function will not mark the entry as used, and it will not change the hits and misses counters.
+ *
+ * @param cache the cache address
+ * @param key the key address
+ * @return it will return one if the key exists, other wise it will return zero
+ */
+
+int cacheContains(Cache *cache, void *key) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    return lLHashMapContains(cache->index, key);
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the key address as a parameters,
+ * then it will delete and free the entry of the key if it exists.
+ *
+ * Note: this function will not call the eviction function.
+ *
+ * @param cache the cache address
+ * @param key the key address
+ */
+
+void cacheDelete(Cache *cache, void *key) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "cache data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    CacheNode *node = (CacheNode *) lLHashMapGet(cache->index, key);
+    if (node != NULL)
+        cacheRemoveNode(cache, node, 0);
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will return the number of entries in the cache.
+ *
+ * @param cache the cache address
+ * @return it will return the number of entries in the cache
+ */
+
+int cacheGetLength(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return lLHashMapGetLength(cache->index);
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will return the total weight of the cache entries.
+ *
+ * @param cache the cache address
+ * @return it will return the total weight of the cache entries
+ */
+
+long cacheGetWeight(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return cache->weight;
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will return the number of the get calls that found their key.
+ *
+ * @param cache the cache address
+ * @return it will return the hits count
+ */
+
+long cacheGetHitsCount(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return cache->hitsCount;
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will return the number of the get calls that didn't find their key.
+ *
+ * @param cache the cache address
+ * @return it will return the misses count
+ */
+
+long cacheGetMissesCount(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return cache->missesCount;
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will set the hits and the misses counters to zero.
+ *
+ * @param cache the cache address
+ */
+
+void cacheResetCounters(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cache->hitsCount = 0;
+    cache->missesCount = 0;
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will free all the cache entries without calling the eviction function.
+ *
+ * Note: the hits and the misses counters will not be changed.
+ *
+ * @param cache the cache address
+ */
+
+void clearCache(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cacheFreeNodes(cache);
+    clearLLHashMap(cache->index);
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will destroy and free the cache and all it's entries.
+ *
+ * @param cache the cache address
+ */
+
+void destroyCache(Cache *cache) {
+    if (cache == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "cache", "cache data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    cacheFreeNodes(cache);
+    free(cache->lowestList);
+    destroyLLHashMap(cache->index);
+    free(cache);
+
+}
+
+
+
+
+
+/** This function will take a pointer as a parameter,
+ * and it will do nothing, because the cache index doesn't own it's keys and items.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param pointer the pointer that will not be freed
+ */
+
+void cacheNoFree(void *pointer) {
+    (void) pointer;
+}
+
+
+
+
+
+/** This function will take the cache address, the list frequency, and the two lists that the new list will be linked between as a parameters,
+ * then it will allocate a new empty list and link it, and it will return it's address.
+ *
+ * Note: if the new list doesn't have a previous list, it will become the cache lowest list.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param cache the cache address
+ * @param frequency the new list frequency
+ * @param prevList the list before the new list, or NULL
+ * @param nextList the list after the new list, or NULL
+ * @return it will return the new list address
+ */
+
+CacheList *cacheNewList(Cache *cache, unsigned long frequency, CacheList *prevList, CacheList *nextList) {
+    CacheList *list = (CacheList *) malloc(sizeof(CacheList));
+    if (list == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new list", "cache data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    list->frequency = frequency;
+    list->head = list->tail = NULL;
+    list->prev = prevList;
+    list->next = nextList;
+
+    if (prevList != NULL)
+        prevList->next = list;
+    else
+        cache->lowestList = list;
+
+    if (nextList != NULL)
+        nextList->prev = list;
+
+    return list;
+
+}
+
+
+
+
+
+/** This function will take the list address, and the node address as a parameters,
+ * then it will link the node at the head of the list, as the most recently used node.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param list the list address
+ * @param node the node address
+ */
+
+void cacheListPushHead(CacheList *list, CacheNode *node) {
+    node->list = list;
+    node->prev = NULL;
+    node->next = list->head;
+
+    if (list->head != NULL)
+        list->head->prev = node;
+    else
+        list->tail = node;
+
+    list->head = node;
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the node address as a parameters,
+ * then it will unlink the node from it's list.
+ *
+ * Note: in the LFU cache, the list will be freed if it became empty.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param cache the cache address
+ * @param node the node address
+ */
+
+void cacheListUnlink(Cache *cache, CacheNode *node) {
+    CacheList *list = node->list;
+
+    if (node->prev != NULL)
+        node->prev->next = node->next;
+    else
+        list->head = node->next;
+
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    else
+        list->tail = node->prev;
+
+    if (cache->policy == CACHE_LFU && list->head == NULL) {
+        if (list->prev != NULL)
+            list->prev->next = list->next;
+        else
+            cache->lowestList = list->next;
+
+        if (list->next != NULL)
+            list->next->prev = list->prev;
+
+        free(list);
+
+    }
+
+}
+
+
+
+
+
+/** This function will take the cache address, and the node address as a parameters,
+ * then it will mark the node as used.
+ *
+ * Note: the LRU cache moves the node to the head of it's list,
+ * and the LFU cache moves it to the head of the list with the next frequency.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param cache the cache address
+ * @param node the node address
+ */
+
+void cacheTouch(Cache *cache, CacheNode *node) {
+    CacheList *list = node->list;
+
+    if (cache->policy == CACHE_LRU) {
+        if (list->head == node)
+            return;
+
+        cacheListUnlink(cache, node);
+        cacheListPushHead(list, node);
+        return;
+
+    }
+
+    CacheList *nextList = list->next;
+    if (nextList == NULL || nextList->frequency != list->frequency + 1) {
+        nextList = cacheNewList(cache, list->frequency + 1, list, nextList);
+        if (nextList == NULL)
+            return;
+
+    }
+
+    // the new list is linked first, so unlinking the node can free it's old list safely.
+    cacheListUnlink(cache, node);
+    cacheListPushHead(nextList, node);
+
+}
+
+
+
+
+
+/** This function will take the cache address, the node address, and an evicted flag as a parameters,
+ * then it will remove the node from it's list and from the index, and it will free the node entry.
+ *
+ * Note: the eviction function will be called before freeing the entry only if the evicted flag is one.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param cache the cache address
+ * @param node the node address
+ * @param evicted one if the node is removed because of the capacity, other wise zero
+ */
+
+void cacheRemoveNode(Cache *cache, CacheNode *node, int evicted) {
+    cacheListUnlink(cache, node);
+    lLHashMapDelete(cache->index, node->key);
+    cache->weight -= node->weight;
+
+    if (evicted && cache->evictionFun != NULL)
+        cache->evictionFun(node->key, node->item);
+
+    cache->freeKey(node->key);
+    cache->freeItem(node->item);
+    free(node);
+
+}
+
+
+
+
+
+/** This function will take the cache address as a parameter,
+ * then it will free all the cache nodes and their entries, and it will empty the eviction lists.
+ *
+ * Note: the LRU cache keeps it's only list, and the LFU cache frees all it's lists.
+ *
+ * Note: this function should only be called from the cache functions.
+ *
+ * @param cache the cache address
+ */
+
+void cacheFreeNodes(Cache *cache) {
+    CacheList *list = cache->lowestList;
+
+    while (list != NULL) {
+        CacheNode *node = list->head;
+        while (node != NULL) {
+            CacheNode *nextNode = node->next;
+            cache->freeKey(node->key);
+            cache->freeItem(node->item);
+            free(node);
+            node = nextNode;
+        }
+
+        list->head = list->tail = NULL;
+
+        CacheList *nextList = list->next;
+        if (cache->policy == CACHE_LFU)
+            free(list);
+
+        list = nextList;
+
+    }
+
+    if (cache->policy == CACHE_LFU)
+        cache->lowestList = NULL;
+
+    cache->weight = 0;
+
+}
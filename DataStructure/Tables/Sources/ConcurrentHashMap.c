@@ -0,0 +1,1051 @@
+#include "../Headers/ConcurrentHashMap.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+#define C_HASH_MAP_SEGMENT_INITIAL_LENGTH 16
+
+
+
+unsigned int cHashMapHashCal(ConcurrentHashMap *map, void *key);
+
+CHashMapSegment *cHashMapGetSegment(ConcurrentHashMap *map, unsigned int hash);
+
+unsigned int cHashMapBucketIndex(ConcurrentHashMap *map, unsigned int hash, int length);
+
+CHashMapNode **cHashMapFindNode(ConcurrentHashMap *map, CHashMapSegment *segment, void *key, unsigned int hash);
+
+void cHashMapAddNode(ConcurrentHashMap *map, CHashMapSegment *segment, void *key, void *item, unsigned int hash);
+
+void cHashMapGrowSegment(ConcurrentHashMap *map, CHashMapSegment *segment);
+
+void cHashMapClearSegment(ConcurrentHashMap *map, CHashMapSegment *segment);
+
+void cHashMapFreeSegments(ConcurrentHashMap *map, int initializedSegments);
+
+
+
+
+
+
+
+/** This function will take the number of segments, the freeing key function address, the freeing item function address,
+ * the key comparator function, and the hash function as a parameters,
+ * then it will initialize a new concurrent hash map and return it's address.
+ *
+ * Note: the number of segments will be rounded up to the next power of two,
+ * and every segment will be locked independently from the other segments,
+ * so a good number of segments is a small multiple of the number of working threads.
+ *
+ * @param segmentsNum the number of the independently locked segments
+ * @param freeKey the freeing key function address that will be called to free the items keys
+ * @param freeItem the freeing item function address that will be called to free the hash map items
+ * @param keyComp the function that will be called to compare the keys
+ * @param hashFun the hashing function that will return a unique integer representing the hash map key
+ * @return it will return the new initialized concurrent hash map address
+ */
+
+ConcurrentHashMap *concurrentHashMapInitialization(
+        int segmentsNum
+        , void (*freeKey)(void *)
+        , void (*freeItem)(void *)
+        , int (*keyComp)(const void *, const void *)
+        , int (*hashFun)(const void *)
+        ) {
+
+    if (segmentsNum <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "number of segments", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeKey == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free key function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free item function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (keyComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    ConcurrentHashMap *map = (ConcurrentHashMap *) malloc(sizeof(ConcurrentHashMap));
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    map->segmentsNum = 1;
+    map->segmentShift = 0;
+    while (map->segmentsNum < segmentsNum) {
+        map->segmentsNum <<= 1;
+        map->segmentShift++;
+    }
+
+    map->segments = (CHashMapSegment *) malloc(sizeof(CHashMapSegment) * map->segmentsNum);
+    if (map->segments == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            free(map);
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "segments array", "concurrent hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    for (int i = 0; i < map->segmentsNum; i++) {
+        CHashMapSegment *segment = map->segments + i;
+
+        segment->length = C_HASH_MAP_SEGMENT_INITIAL_LENGTH;
+        segment->count = 0;
+        segment->buckets = (CHashMapNode **) calloc(sizeof(CHashMapNode *), segment->length);
+        if (segment->buckets == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                cHashMapFreeSegments(map, i);
+                return NULL;
+            #else
+                fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "segment buckets array", "concurrent hash map data structure");
+                exit(FAILED_ALLOCATION);
+            #endif
+
+        }
+
+        if (pthread_rwlock_init(&segment->lock, NULL) != 0) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+                free(segment->buckets);
+                cHashMapFreeSegments(map, i);
+                return NULL;
+            #else
+                fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "initialize the segment lock", "concurrent hash map data structure");
+                exit(SOMETHING_WENT_WRONG);
+            #endif
+
+        }
+
+    }
+
+    map->freeKeyFun = freeKey;
+    map->freeItemFun = freeItem;
+    map->keyComp = keyComp;
+    map->hashFun = hashFun;
+
+    return map;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the key address, and the item address as a parameters,
+ * then it will insert the item in the map.
+ *
+ * Note: if the key is already in the map then the map will override the data and free the old item and it's key.
+ *
+ * Note: only the segment of the key will be locked while inserting, so the other segments stay available to the other threads.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @param item the item address
+ */
+
+void concurrentHashMapInsert(ConcurrentHashMap *map, void *key, void *item) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_wrlock(&segment->lock);
+
+    CHashMapNode **nodePointer = cHashMapFindNode(map, segment, key, hash);
+    if (*nodePointer != NULL) {
+        map->freeKeyFun((*nodePointer)->key);
+        map->freeItemFun((*nodePointer)->item);
+        (*nodePointer)->key = key;
+        (*nodePointer)->item = item;
+    } else
+        cHashMapAddNode(map, segment, key, item, hash);
+
+    pthread_rwlock_unlock(&segment->lock);
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameters,
+ * then it will return (1) if the key is in the map,
+ * other wise it will return zero (0).
+ *
+ * Note: this function will not free the passed key.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @return it will return one if the provided key is in the hash map, other wise it will return zero
+ */
+
+int concurrentHashMapContains(ConcurrentHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_rdlock(&segment->lock);
+    int found = *cHashMapFindNode(map, segment, key, hash) != NULL;
+    pthread_rwlock_unlock(&segment->lock);
+
+    return found;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameter,
+ * then it will return the item address if the key existed,
+ * other wise it will return NULL.
+ *
+ * Note: this function will not free the passed key.
+ *
+ * Note: the returned item is still owned by the map, and it's only valid until the key is next written or deleted,
+ * because the segment is unlocked before the function returns, and the insert and the delete functions free the old item.
+ * Use the concurrentHashMapVisit function to read the item, or the concurrentHashMapUpdate function to modify it,
+ * while it's segment is locked.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @return it will return the item with the provided key if found other wise it will return NULL
+ */
+
+void *concurrentHashMapGet(ConcurrentHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_rdlock(&segment->lock);
+    CHashMapNode *node = *cHashMapFindNode(map, segment, key, hash);
+    void *item = node != NULL ? node->item : NULL;
+    pthread_rwlock_unlock(&segment->lock);
+
+    return item;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the key address, and a mapping function address as a parameters,
+ * then if the key is not in the map, it will call the mapping function with the key and insert the returned item,
+ * and all of that will happen atomically while the key segment is locked.
+ *
+ * Note: the map will always take the passed key, so if the key is already in the map
+ * or the mapping function returned NULL, the passed key will be freed using the free key function.
+ *
+ * Note: if the mapping function returned NULL, nothing will be inserted.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @param mappingFun the function that will be called with the key to generate the new item
+ * @return it will return the item that is linked to the key after the call, or NULL if the mapping function returned NULL
+ */
+
+void *concurrentHashMapComputeIfAbsent(ConcurrentHashMap *map, void *key, void *(*mappingFun)(const void *)) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (mappingFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "mapping function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_wrlock(&segment->lock);
+
+    void *item;
+    CHashMapNode *node = *cHashMapFindNode(map, segment, key, hash);
+    if (node != NULL)
+        item = node->item;
+    else
+        item = mappingFun(key);
+
+    if (node == NULL && item != NULL)
+        cHashMapAddNode(map, segment, key, item, hash);
+    else
+        map->freeKeyFun(key);
+
+    pthread_rwlock_unlock(&segment->lock);
+
+    return item;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the key address, the update function address, and an extra argument as a parameters,
+ * then it will call the update function with the item of the key and the extra argument,
+ * while the key segment is locked for writing, so the item can be modified in place atomically.
+ *
+ * Note: this function will not free the passed key.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @param updateFun the function that will be called with the item and the extra argument
+ * @param arg the extra argument that will be passed to the update function, and it can be NULL
+ * @return it will return one if the key was found and updated, other wise it will return zero
+ */
+
+int concurrentHashMapUpdate(ConcurrentHashMap *map, void *key, void (*updateFun)(void *, void *), void *arg) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (updateFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "update function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_wrlock(&segment->lock);
+
+    CHashMapNode *node = *cHashMapFindNode(map, segment, key, hash);
+    if (node != NULL)
+        updateFun(node->item, arg);
+
+    pthread_rwlock_unlock(&segment->lock);
+
+    return node != NULL;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the key address, the visit function address, and an extra argument as a parameters,
+ * then it will call the visit function with the item of the key and the extra argument,
+ * while the key segment is locked for reading, so the item can't be freed by another thread while it's being read.
+ *
+ * Note: the visit function shouldn't modify the item, and it shouldn't keep the item address after it returns,
+ * but it can copy the needed values into the extra argument.
+ *
+ * Note: this function will not free the passed key.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @param visitFun the function that will be called with the item and the extra argument
+ * @param arg the extra argument that will be passed to the visit function, and it can be NULL
+ * @return it will return one if the key was found and visited, other wise it will return zero
+ */
+
+int concurrentHashMapVisit(ConcurrentHashMap *map, void *key, void (*visitFun)(const void *, void *), void *arg) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (visitFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "visit function pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_rdlock(&segment->lock);
+
+    CHashMapNode *node = *cHashMapFindNode(map, segment, key, hash);
+    if (node != NULL)
+        visitFun(node->item, arg);
+
+    pthread_rwlock_unlock(&segment->lock);
+
+    return node != NULL;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameters,
+ * then it will delete and free the key and the item that linked to the key.
+ *
+ * Note: if the key didn't found in the hash map, then the function will do nothing.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ */
+
+void concurrentHashMapDelete(ConcurrentHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    void *item = concurrentHashMapDeleteWtoFr(map, key);
+    if (item != NULL)
+        map->freeItemFun(item);
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameters,
+ * then it will delete and free the key without freeing the item that linked to that key.
+ *
+ * Note: if the key didn't found in the hash map, then the function will do nothing.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @return it will return the deleted item pointer if found, other wise it will return NULL
+ */
+
+void *concurrentHashMapDeleteWtoFr(ConcurrentHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "concurrent hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int hash = cHashMapHashCal(map, key);
+    CHashMapSegment *segment = cHashMapGetSegment(map, hash);
+
+    pthread_rwlock_wrlock(&segment->lock);
+
+    void *item = NULL;
+    CHashMapNode **nodePointer = cHashMapFindNode(map, segment, key, hash);
+    CHashMapNode *node = *nodePointer;
+    if (node != NULL) {
+        *nodePointer = node->next;
+        segment->count--;
+        item = node->item;
+        map->freeKeyFun(node->key);
+        free(node);
+    }
+
+    pthread_rwlock_unlock(&segment->lock);
+
+    return item;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address as a parameter,
+ * then it will return the number of items in the map.
+ *
+ * Note: the segments are read one after the other, so the returned number is a snapshot
+ * that may not be accurate while other threads are modifying the map.
+ *
+ * @param map the concurrent hash map address
+ * @return it will return the number of entries (items) in the hash map
+ */
+
+int concurrentHashMapGetLength(ConcurrentHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int count = 0;
+    for (int i = 0; i < map->segmentsNum; i++) {
+        pthread_rwlock_rdlock(&map->segments[i].lock);
+        count += map->segments[i].count;
+        pthread_rwlock_unlock(&map->segments[i].lock);
+    }
+
+    return count;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address as a parameter,
+ * then it will return one (1) if the map is empty,
+ * other wise it will return zero (0).
+ *
+ * @param map the concurrent hash map address
+ * @return it will return one if the hash map is empty, other wise it will return zero
+ */
+
+int concurrentHashMapIsEmpty(ConcurrentHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return concurrentHashMapGetLength(map) == 0;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address as a parameter,
+ * then it will clear and free all the items and it's key from the map without freeing the map.
+ *
+ * Note: the segments will be cleared one after the other, and every one of them will be locked only while it's cleared.
+ *
+ * @param map the concurrent hash map address
+ */
+
+void clearConcurrentHashMap(ConcurrentHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    for (int i = 0; i < map->segmentsNum; i++) {
+        pthread_rwlock_wrlock(&map->segments[i].lock);
+        cHashMapClearSegment(map, map->segments + i);
+        pthread_rwlock_unlock(&map->segments[i].lock);
+    }
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address as a parameter,
+ * then it will destroy and free the map and all it's entries.
+ *
+ * Note: no other thread should use the map while or after it's destroyed.
+ *
+ * @param map the concurrent hash map address
+ */
+
+void destroyConcurrentHashMap(ConcurrentHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "concurrent hash map", "concurrent hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    for (int i = 0; i < map->segmentsNum; i++) {
+        cHashMapClearSegment(map, map->segments + i);
+        free(map->segments[i].buckets);
+        pthread_rwlock_destroy(&map->segments[i].lock);
+    }
+
+    free(map->segments);
+    free(map);
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameters,
+ * then it will return the key hash after mixing it's bits,
+ * so the low bits can choose the segment and the high bits can choose the bucket.
+ *
+ * Note: this function should only be called from the concurrent hash map functions.
+ *
+ * @param map the concurrent hash map address
+ * @param key the key address
+ * @return it will return the mixed hash of the key
+ */
+
+unsigned int cHashMapHashCal(ConcurrentHashMap *map, void *key) {
+    unsigned int hash = (unsigned int) map->hashFun(key);
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bU;
+    hash ^= hash >> 16;
+
+    return hash;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the mixed key hash as a parameters,
+ * then it will return the address of the segment that holds the key.
+ *
+ * Note: this function should only be called from the concurrent hash map functions.
+ *
+ * @param map the concurrent hash map address
+ * @param hash the mixed key hash
+ * @return it will return the key segment address
+ */
+
+CHashMapSegment *cHashMapGetSegment(ConcurrentHashMap *map, unsigned int hash) {
+    return map->segments + (hash & (unsigned int) (map->segmentsNum - 1));
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the mixed key hash, and the segment buckets length as a parameters,
+ * then it will return the index of the key bucket in the segment.
+ *
+ * Note: this function should only be called from the concurrent hash map functions.
+ *
+ * @param map the concurrent hash map address
+ * @param hash the mixed key hash
+ * @param length the segment buckets length
+ * @return it will return the bucket index
+ */
+
+unsigned int cHashMapBucketIndex(ConcurrentHashMap *map, unsigned int hash, int length) {
+    return (hash >> map->segmentShift) & (unsigned int) (length - 1);
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the segment address, the key address, and the mixed key hash as a parameters,
+ * then it will return the address of the link that points to the key node,
+ * so the node can be read, replaced, or unlinked.
+ *
+ * Note: if the key is not in the segment, the returned link will point to NULL.
+ *
+ * Note: this function should only be called while the segment is locked.
+ *
+ * @param map the concurrent hash map address
+ * @param segment the segment address
+ * @param key the key address
+ * @param hash the mixed key hash
+ * @return it will return the address of the link that points to the key node
+ */
+
+CHashMapNode **cHashMapFindNode(ConcurrentHashMap *map, CHashMapSegment *segment, void *key, unsigned int hash) {
+    CHashMapNode **nodePointer = segment->buckets + cHashMapBucketIndex(map, hash, segment->length);
+
+    while (*nodePointer != NULL) {
+        if ((*nodePointer)->hash == hash && map->keyComp(key, (*nodePointer)->key) == 0)
+            break;
+
+        nodePointer = &(*nodePointer)->next;
+    }
+
+    return nodePointer;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, the segment address, the key address, the item address, and the mixed key hash as a parameters,
+ * then it will add a new node to the segment, and it will grow the segment if it became too loaded.
+ *
+ * Note: this function should only be called while the segment is locked for writing,
+ * and after making sure that the key is not in the segment.
+ *
+ * @param map the concurrent hash map address
+ * @param segment the segment address
+ * @param key the key address
+ * @param item the item address
+ * @param hash the mixed key hash
+ */
+
+void cHashMapAddNode(ConcurrentHashMap *map, CHashMapSegment *segment, void *key, void *item, unsigned int hash) {
+    CHashMapNode *node = (CHashMapNode *) malloc(sizeof(CHashMapNode));
+    if (node == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new node", "concurrent hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    unsigned int index = cHashMapBucketIndex(map, hash, segment->length);
+    node->key = key;
+    node->item = item;
+    node->hash = hash;
+    node->next = segment->buckets[index];
+    segment->buckets[index] = node;
+
+    if (++segment->count > segment->length - segment->length / 4)
+        cHashMapGrowSegment(map, segment);
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the segment address as a parameters,
+ * then it will double the segment buckets and move the segment nodes into the new buckets.
+ *
+ * Note: the nodes hashes are cached, so the hash function will not be called again,
+ * and only the passed segment is locked while growing.
+ *
+ * Note: this function should only be called while the segment is locked for writing.
+ *
+ * @param map the concurrent hash map address
+ * @param segment the segment address
+ */
+
+void cHashMapGrowSegment(ConcurrentHashMap *map, CHashMapSegment *segment) {
+    int newLength = segment->length * 2;
+    CHashMapNode **newBuckets = (CHashMapNode **) calloc(sizeof(CHashMapNode *), newLength);
+    if (newBuckets == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "segment buckets array", "concurrent hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    for (int i = 0; i < segment->length; i++) {
+        CHashMapNode *node = segment->buckets[i];
+
+        while (node != NULL) {
+            CHashMapNode *nextNode = node->next;
+            unsigned int index = cHashMapBucketIndex(map, node->hash, newLength);
+            node->next = newBuckets[index];
+            newBuckets[index] = node;
+            node = nextNode;
+        }
+
+    }
+
+    free(segment->buckets);
+    segment->buckets = newBuckets;
+    segment->length = newLength;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the segment address as a parameters,
+ * then it will free all the segment nodes with their keys and items.
+ *
+ * Note: this function should only be called while the segment is locked for writing.
+ *
+ * @param map the concurrent hash map address
+ * @param segment the segment address
+ */
+
+void cHashMapClearSegment(ConcurrentHashMap *map, CHashMapSegment *segment) {
+    for (int i = 0; i < segment->length; i++) {
+        CHashMapNode *node = segment->buckets[i];
+
+        while (node != NULL) {
+            CHashMapNode *nextNode = node->next;
+            map->freeKeyFun(node->key);
+            map->freeItemFun(node->item);
+            free(node);
+            node = nextNode;
+        }
+
+        segment->buckets[i] = NULL;
+    }
+
+    segment->count = 0;
+
+}
+
+
+
+
+
+
+
+/** This function will take the map address, and the number of the initialized segments as a parameters,
+ * then it will free the buckets and destroy the locks of the initialized segments, and it will free the segments array and the map.
+ *
+ * Note: this function should only be called from the initialization function, when it fails after allocating the segments.
+ *
+ * @param map the concurrent hash map address
+ * @param initializedSegments the number of segments that have their buckets and lock initialized
+ */
+
+void cHashMapFreeSegments(ConcurrentHashMap *map, int initializedSegments) {
+    for (int i = 0; i < initializedSegments; i++) {
+        free(map->segments[i].buckets);
+        pthread_rwlock_destroy(&map->segments[i].lock);
+    }
+
+    free(map->segments);
+    free(map);
+
+}
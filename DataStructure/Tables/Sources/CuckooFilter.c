@@ -0,0 +1,581 @@
+#include "../Headers/CuckooFilter.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+#include <math.h>
+
+
+/// The number of fingerprints in one bucket.
+#define CUCKOO_FILTER_BUCKET_SIZE 4
+
+/// The load factor that the filter is sized for, cuckoo filters with four slots buckets fill well up to 95%.
+#define CUCKOO_FILTER_LOAD_FACTOR 0.95
+
+/// The maximum number of fingerprints that one insertion can kick out before giving up.
+#define CUCKOO_FILTER_MAX_KICKS 500
+
+
+
+void cuckooFilterHashCal(CuckooFilter *filter, void *item, int *index, uint16_t *fingerprint);
+
+int cuckooFilterAltIndex(CuckooFilter *filter, int index, uint16_t fingerprint);
+
+int cuckooFilterBucketPut(CuckooFilter *filter, int index, uint16_t fingerprint);
+
+int cuckooFilterBucketContains(CuckooFilter *filter, int index, uint16_t fingerprint);
+
+int cuckooFilterBucketRemove(CuckooFilter *filter, int index, uint16_t fingerprint);
+
+void cuckooFilterPlace(CuckooFilter *filter, int index, uint16_t fingerprint);
+
+uint32_t cuckooFilterNextRandom(CuckooFilter *filter);
+
+
+
+
+
+/** This function will take the expected number of items, the wanted false positive rate, and the hashing function as a parameters,
+ * then it will allocate a new cuckoo filter that can hold the expected items with the passed false positive rate,
+ * then the function will return the address of the filter.
+ *
+ * Note: the fingerprint size is chosen from the false positive rate, and it's between 4 and 16 bits,
+ * so rates lower than 0.0001 will be clamped to the 16 bits fingerprint rate.
+ *
+ * @param expectedItems the number of items that the filter is expected to hold
+ * @param falsePositiveRate the wanted false positive rate, and it should be between zero and one
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new cuckoo filter address
+ */
+
+CuckooFilter *cuckooFilterInitialization(int expectedItems, double falsePositiveRate, int (*hashFun)(const void *)) {
+    if (expectedItems <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "expected items number", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (falsePositiveRate <= 0 || falsePositiveRate >= 1) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "false positive rate", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    CuckooFilter *filter = (CuckooFilter *) malloc(sizeof(CuckooFilter));
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // a lookup checks two buckets of four fingerprints, so the rate is about 8 / 2^bits.
+    int fingerprintBits = (int) ceil(log2(2.0 * CUCKOO_FILTER_BUCKET_SIZE / falsePositiveRate));
+    if (fingerprintBits < 4)
+        fingerprintBits = 4;
+    else if (fingerprintBits > 16)
+        fingerprintBits = 16;
+
+    int neededBuckets = (int) ceil(expectedItems / (CUCKOO_FILTER_BUCKET_SIZE * CUCKOO_FILTER_LOAD_FACTOR));
+    filter->bucketsNum = 1;
+    while (filter->bucketsNum < neededBuckets)
+        filter->bucketsNum <<= 1;
+
+    filter->buckets = (uint16_t *) calloc(sizeof(uint16_t), (size_t) filter->bucketsNum * CUCKOO_FILTER_BUCKET_SIZE);
+    if (filter->buckets == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(filter);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filter buckets", "cuckoo filter data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    filter->fingerprintMask = (uint16_t) ((1u << fingerprintBits) - 1);
+    filter->count = 0;
+    filter->victimFingerprint = 0;
+    filter->victimIndex = 0;
+    filter->kickState = 2463534242u;
+    filter->hashFun = hashFun;
+
+    return filter;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will add the item fingerprint to the filter.
+ *
+ * Note: the function will return zero if the filter is full, and in this case nothing will be added,
+ * so the filter should be rebuilt with a bigger size.
+ *
+ * Note: inserting the same item more than one time will store more than one fingerprint,
+ * and every one of them needs a delete call to be removed.
+ *
+ * @param filter the cuckoo filter address
+ * @param item the item address
+ * @return it will return one if the item was added, and zero if the filter is full
+ */
+
+int cuckooFilterInsert(CuckooFilter *filter, void *item) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (filter->victimFingerprint != 0)
+        return 0;
+
+    int index;
+    uint16_t fingerprint;
+    cuckooFilterHashCal(filter, item, &index, &fingerprint);
+
+    cuckooFilterPlace(filter, index, fingerprint);
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will remove one fingerprint of the item from the filter.
+ *
+ * Note: only delete items that were inserted before, because deleting an item that was never inserted
+ * could remove the fingerprint of another item that has the same fingerprint.
+ *
+ * @param filter the cuckoo filter address
+ * @param item the item address
+ * @return it will return one if a fingerprint was removed, other wise it will return zero
+ */
+
+int cuckooFilterDelete(CuckooFilter *filter, void *item) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int index;
+    uint16_t fingerprint;
+    cuckooFilterHashCal(filter, item, &index, &fingerprint);
+    int altIndex = cuckooFilterAltIndex(filter, index, fingerprint);
+
+    if (filter->victimFingerprint == fingerprint
+        && (filter->victimIndex == index || filter->victimIndex == altIndex)) {
+        filter->victimFingerprint = 0;
+        filter->count--;
+        return 1;
+    }
+
+    if (!cuckooFilterBucketRemove(filter, index, fingerprint) && !cuckooFilterBucketRemove(filter, altIndex, fingerprint))
+        return 0;
+
+    filter->count--;
+
+    // the removed fingerprint freed a slot, so the victim gets another chance to find a place.
+    if (filter->victimFingerprint != 0) {
+        uint16_t victimFingerprint = filter->victimFingerprint;
+        filter->victimFingerprint = 0;
+        filter->count--;
+        cuckooFilterPlace(filter, filter->victimIndex, victimFingerprint);
+    }
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take the filter address, and the item address as a parameters,
+ * then it will return one (1) if the item may be in the filter,
+ * other wise it will return zero (0) if the item is surely not in the filter.
+ *
+ * @param filter the cuckoo filter address
+ * @param item the item address
+ * @return it will return one if the item may be in the filter, and zero if it's surely not in the filter
+ */
+
+int cuckooFilterContains(CuckooFilter *filter, void *item) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "cuckoo filter data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int index;
+    uint16_t fingerprint;
+    cuckooFilterHashCal(filter, item, &index, &fingerprint);
+    int altIndex = cuckooFilterAltIndex(filter, index, fingerprint);
+
+    if (cuckooFilterBucketContains(filter, index, fingerprint) || cuckooFilterBucketContains(filter, altIndex, fingerprint))
+        return 1;
+
+    return filter->victimFingerprint == fingerprint
+           && (filter->victimIndex == index || filter->victimIndex == altIndex);
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will return the number of the stored fingerprints.
+ *
+ * @param filter the cuckoo filter address
+ * @return it will return the number of the stored fingerprints
+ */
+
+int cuckooFilterGetLength(CuckooFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return filter->count;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will remove all the fingerprints from the filter without freeing it.
+ *
+ * @param filter the cuckoo filter address
+ */
+
+void clearCuckooFilter(CuckooFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    memset(filter->buckets, 0, sizeof(uint16_t) * filter->bucketsNum * CUCKOO_FILTER_BUCKET_SIZE);
+    filter->count = 0;
+    filter->victimFingerprint = 0;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will destroy and free the filter.
+ *
+ * @param filter the cuckoo filter address
+ */
+
+void destroyCuckooFilter(CuckooFilter *filter) {
+    if (filter == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filter", "cuckoo filter data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(filter->buckets);
+    free(filter);
+
+}
+
+
+
+
+
+/** This function will take the filter address, the item address, and two output pointers as a parameters,
+ * then it will calculate the item first bucket index and it's fingerprint.
+ *
+ * Note: the fingerprint can't be zero, because zero marks the empty slots.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param item the item address
+ * @param index the address that the first bucket index will be written to
+ * @param fingerprint the address that the fingerprint will be written to
+ */
+
+void cuckooFilterHashCal(CuckooFilter *filter, void *item, int *index, uint16_t *fingerprint) {
+    uint64_t hash = (uint32_t) filter->hashFun(item);
+
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+
+    *index = (int) (hash & (uint64_t) (filter->bucketsNum - 1));
+    *fingerprint = (uint16_t) ((hash >> 32) & filter->fingerprintMask);
+    if (*fingerprint == 0)
+        *fingerprint = 1;
+
+}
+
+
+
+
+
+/** This function will take the filter address, a bucket index, and a fingerprint as a parameters,
+ * then it will return the other bucket index that the fingerprint can be stored in.
+ *
+ * Note: the alternate index is calculated from the fingerprint only, so a kicked fingerprint can find it's other bucket
+ * without the original item, and calling the function on the result returns the first index again.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param index the current bucket index
+ * @param fingerprint the fingerprint
+ * @return it will return the alternate bucket index
+ */
+
+int cuckooFilterAltIndex(CuckooFilter *filter, int index, uint16_t fingerprint) {
+    uint32_t fingerprintHash = (uint32_t) fingerprint * 0x5bd1e995u;
+    return (int) (((uint32_t) index ^ (fingerprintHash ^ (fingerprintHash >> 15))) & (uint32_t) (filter->bucketsNum - 1));
+}
+
+
+
+
+
+/** This function will take the filter address, a bucket index, and a fingerprint as a parameters,
+ * then it will store the fingerprint in the first empty slot of the bucket.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param index the bucket index
+ * @param fingerprint the fingerprint
+ * @return it will return one if the fingerprint was stored, and zero if the bucket is full
+ */
+
+int cuckooFilterBucketPut(CuckooFilter *filter, int index, uint16_t fingerprint) {
+    uint16_t *bucket = filter->buckets + index * CUCKOO_FILTER_BUCKET_SIZE;
+
+    for (int i = 0; i < CUCKOO_FILTER_BUCKET_SIZE; i++) {
+        if (bucket[i] == 0) {
+            bucket[i] = fingerprint;
+            return 1;
+        }
+    }
+
+    return 0;
+
+}
+
+
+
+
+
+/** This function will take the filter address, a bucket index, and a fingerprint as a parameters,
+ * then it will return one if the fingerprint is stored in the bucket, other wise it will return zero.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param index the bucket index
+ * @param fingerprint the fingerprint
+ * @return it will return one if the bucket has the fingerprint, other wise it will return zero
+ */
+
+int cuckooFilterBucketContains(CuckooFilter *filter, int index, uint16_t fingerprint) {
+    uint16_t *bucket = filter->buckets + index * CUCKOO_FILTER_BUCKET_SIZE;
+
+    return bucket[0] == fingerprint || bucket[1] == fingerprint
+           || bucket[2] == fingerprint || bucket[3] == fingerprint;
+
+}
+
+
+
+
+
+/** This function will take the filter address, a bucket index, and a fingerprint as a parameters,
+ * then it will clear one slot of the bucket that holds the fingerprint.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param index the bucket index
+ * @param fingerprint the fingerprint
+ * @return it will return one if the fingerprint was removed, and zero if the bucket doesn't have it
+ */
+
+int cuckooFilterBucketRemove(CuckooFilter *filter, int index, uint16_t fingerprint) {
+    uint16_t *bucket = filter->buckets + index * CUCKOO_FILTER_BUCKET_SIZE;
+
+    for (int i = 0; i < CUCKOO_FILTER_BUCKET_SIZE; i++) {
+        if (bucket[i] == fingerprint) {
+            bucket[i] = 0;
+            return 1;
+        }
+    }
+
+    return 0;
+
+}
+
+
+
+
+
+/** This function will take the filter address, a bucket index, and a fingerprint as a parameters,
+ * then it will store the fingerprint in one of it's two buckets,
+ * and if both of them are full, it will kick random fingerprints to their other buckets until every fingerprint has a place.
+ *
+ * Note: if the kicking didn't end after the maximum number of kicks, the last kicked fingerprint will be kept as the victim,
+ * and the filter will refuse any new insertion until a delete frees a place for it.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @param index one of the fingerprint buckets indices
+ * @param fingerprint the fingerprint
+ */
+
+void cuckooFilterPlace(CuckooFilter *filter, int index, uint16_t fingerprint) {
+    filter->count++;
+
+    int altIndex = cuckooFilterAltIndex(filter, index, fingerprint);
+    if (cuckooFilterBucketPut(filter, index, fingerprint) || cuckooFilterBucketPut(filter, altIndex, fingerprint))
+        return;
+
+    if (cuckooFilterNextRandom(filter) & 1)
+        index = altIndex;
+
+    for (int kick = 0; kick < CUCKOO_FILTER_MAX_KICKS; kick++) {
+        uint16_t *slot = filter->buckets + index * CUCKOO_FILTER_BUCKET_SIZE
+                         + cuckooFilterNextRandom(filter) % CUCKOO_FILTER_BUCKET_SIZE;
+
+        uint16_t kickedFingerprint = *slot;
+        *slot = fingerprint;
+        fingerprint = kickedFingerprint;
+
+        index = cuckooFilterAltIndex(filter, index, fingerprint);
+        if (cuckooFilterBucketPut(filter, index, fingerprint))
+            return;
+
+    }
+
+    filter->victimFingerprint = fingerprint;
+    filter->victimIndex = index;
+
+}
+
+
+
+
+
+/** This function will take the filter address as a parameter,
+ * then it will return the next value of the filter random generator.
+ *
+ * Note: the generator is a simple xorshift, so the filter behaviour is the same in every run.
+ *
+ * Note: this function should only be called from the cuckoo filter functions.
+ *
+ * @param filter the cuckoo filter address
+ * @return it will return the next random value
+ */
+
+uint32_t cuckooFilterNextRandom(CuckooFilter *filter) {
+    uint32_t state = filter->kickState;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    filter->kickState = state;
+    return state;
+
+}
@@ -0,0 +1,382 @@
+#include "../Headers/FilteredHashMap.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+int filteredHashMapRebuildFilter(FilteredHashMap *map);
+
+
+
+
+
+/** This function will take the expected number of items, the filter false positive rate, the key freeing function, the item freeing function, the key comparator function, and the hashing function as a parameters,
+ * then it will allocate a new hashmap that has the expected capacity, and a cuckoo filter in front of it,
+ * then the function will return the address of the new filtered hashmap.
+ *
+ * Note: the filter can grow, so inserting more than the expected number of items is allowed, but it will cost a filter rebuild.
+ *
+ * @param expectedItems the number of items that the hashmap is expected to hold
+ * @param falsePositiveRate the filter false positive rate, and it should be between zero and one
+ * @param freeKey the function address that will be called to free the map keys
+ * @param freeItem the function address that will be called to free the map items
+ * @param keyComp the function address that will be called to compare two keys
+ * @param hashFun the hashing function that will return a unique integer representing the key
+ * @return it will return the new filtered hashmap address
+ */
+
+FilteredHashMap *filteredHashMapInitialization(int expectedItems, double falsePositiveRate, void (*freeKey)(void *), void (*freeItem)(void *), int (*keyComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    FilteredHashMap *map = (FilteredHashMap *) malloc(sizeof(FilteredHashMap));
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    map->map = hashMapInitializationWithCapacity(expectedItems, freeKey, freeItem, keyComp, hashFun);
+    if (map->map == NULL) {
+        free(map);
+        return NULL;
+    }
+
+    map->filter = cuckooFilterInitialization(expectedItems, falsePositiveRate, hashFun);
+    if (map->filter == NULL) {
+        destroyHashMap(map->map);
+        free(map);
+        return NULL;
+    }
+
+    map->falsePositiveRate = falsePositiveRate;
+
+    return map;
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address, the key address, and the item address as a parameters,
+ * then it will insert the entry into the hashmap, and it will add the key fingerprint to the filter if the key is new.
+ *
+ * Note: if the filter is full, it will be rebuilt with double the size,
+ * and if the new filter can't be allocated, the insertion will be undone and the key and the item will not be freed.
+ *
+ * @param map the filtered hashmap address
+ * @param key the key address
+ * @param item the item address
+ */
+
+void filteredHashMapInsert(FilteredHashMap *map, void *key, void *item) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "filtered hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "filtered hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int oldCount = map->map->count;
+    hashMapInsert(map->map, key, item);
+
+    if (map->map->count > oldCount && !cuckooFilterInsert(map->filter, key) && !filteredHashMapRebuildFilter(map)) {
+        // the key isn't in the filter, so it's removed from the hashmap too, other wise the lookups would miss it.
+        free(hashMapDeleteWtoFrAll(map->map, key));
+
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new filter", "filtered hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address, and the key address as a parameters,
+ * then it will delete and free the entry from the hashmap, and it will remove the key fingerprint from the filter.
+ *
+ * Note: if the filter says that the key doesn't exist, the hashmap will not be probed at all.
+ *
+ * @param map the filtered hashmap address
+ * @param key the key address
+ */
+
+void filteredHashMapDelete(FilteredHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "filtered hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(map->filter, key))
+        return;
+
+    Entry *removedEntry = hashMapDeleteWtoFrAll(map->map, key);
+    if (removedEntry == NULL)
+        return;
+
+    // the stored key is used to remove the fingerprint, because the passed key could be the same pointer.
+    cuckooFilterDelete(map->filter, removedEntry->key);
+    removedEntry->freeItemFun(removedEntry->item);
+    removedEntry->freeKeyFun(removedEntry->key);
+    free(removedEntry);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address, and the key address as a parameters,
+ * then it will return one (1) if the key is in the hashmap, other wise it will return zero (0).
+ *
+ * Note: the filter is checked first, so most of the missing keys will not probe the hashmap.
+ *
+ * @param map the filtered hashmap address
+ * @param key the key address
+ * @return it will return one if the key is in the hashmap, other wise it will return zero
+ */
+
+int filteredHashMapContains(FilteredHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "filtered hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(map->filter, key))
+        return 0;
+
+    return hashMapContains(map->map, key);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address, and the key address as a parameters,
+ * then it will return the stored item of the passed key if it exists, other wise it will return NULL.
+ *
+ * Note: the filter is checked first, so most of the missing keys will not probe the hashmap.
+ *
+ * @param map the filtered hashmap address
+ * @param key the key address
+ * @return it will return the stored item if found, other wise it will return NULL
+ */
+
+void *filteredHashMapGet(FilteredHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "filtered hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(map->filter, key))
+        return NULL;
+
+    return hashMapGet(map->map, key);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address as a parameter,
+ * then it will return the number of items in the hashmap.
+ *
+ * @param map the filtered hashmap address
+ * @return it will return the number of items in the hashmap
+ */
+
+int filteredHashMapGetLength(FilteredHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return hashMapGetLength(map->map);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address as a parameter,
+ * then it will clear and free all the hashmap items, and it will clear the filter.
+ *
+ * @param map the filtered hashmap address
+ */
+
+void clearFilteredHashMap(FilteredHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearHashMap(map->map);
+    clearCuckooFilter(map->filter);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address as a parameter,
+ * then it will destroy and free the hashmap, the filter, and all the hashmap items.
+ *
+ * @param map the filtered hashmap address
+ */
+
+void destroyFilteredHashMap(FilteredHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash map", "filtered hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    destroyHashMap(map->map);
+    destroyCuckooFilter(map->filter);
+    free(map);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashmap address as a parameter,
+ * then it will replace the full filter with a new filter that has double the size, and it will fill it from the hashmap keys.
+ *
+ * Note: if the new filter can't be initialized, the old filter will be kept.
+ *
+ * Note: this function should only be called from the filtered hashmap functions.
+ *
+ * @param map the filtered hashmap address
+ * @return it will return one if the filter was rebuilt, other wise it will return zero
+ */
+
+int filteredHashMapRebuildFilter(FilteredHashMap *map) {
+    int expectedItems = map->map->count;
+    CuckooFilter *newFilter;
+    int filled;
+
+    do {
+        expectedItems *= 2;
+        newFilter = cuckooFilterInitialization(expectedItems, map->falsePositiveRate, map->map->hashFun);
+        if (newFilter == NULL)
+            return 0;
+
+        filled = 1;
+
+        HashMapIterator iterator;
+        hashMapIteratorBegin(map->map, &iterator);
+        while (filled && hashMapIteratorNext(&iterator))
+            filled = cuckooFilterInsert(newFilter, hashMapIteratorKey(&iterator));
+
+        if (!filled)
+            destroyCuckooFilter(newFilter);
+
+    } while (!filled);
+
+    destroyCuckooFilter(map->filter);
+    map->filter = newFilter;
+
+    return 1;
+
+}
@@ -0,0 +1,369 @@
+#include "../Headers/FilteredHashSet.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+
+int filteredHashSetRebuildFilter(FilteredHashSet *set);
+
+
+
+
+
+/** This function will take the expected number of items, the filter false positive rate, the item freeing function, the item comparator function, and the hashing function as a parameters,
+ * then it will allocate a new hashset that has the expected capacity, and a cuckoo filter in front of it,
+ * then the function will return the address of the new filtered hashset.
+ *
+ * Note: the filter can grow, so inserting more than the expected number of items is allowed, but it will cost a filter rebuild.
+ *
+ * @param expectedItems the number of items that the hashset is expected to hold
+ * @param falsePositiveRate the filter false positive rate, and it should be between zero and one
+ * @param freeItem the function address that will be called to free the set items
+ * @param itemComp the function address that will be called to compare two items
+ * @param hashFun the hashing function that will return a unique integer representing the item
+ * @return it will return the new filtered hashset address
+ */
+
+FilteredHashSet *filteredHashSetInitialization(int expectedItems, double falsePositiveRate, void (*freeItem)(void *), int (*itemComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    FilteredHashSet *set = (FilteredHashSet *) malloc(sizeof(FilteredHashSet));
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    set->hashSet = hashSetInitializationWithCapacity(expectedItems, freeItem, itemComp, hashFun);
+    if (set->hashSet == NULL) {
+        free(set);
+        return NULL;
+    }
+
+    set->filter = cuckooFilterInitialization(expectedItems, falsePositiveRate, hashFun);
+    if (set->filter == NULL) {
+        destroyHashSet(set->hashSet);
+        free(set);
+        return NULL;
+    }
+
+    set->falsePositiveRate = falsePositiveRate;
+
+    return set;
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address, and the item address as a parameters,
+ * then it will insert the item into the hashset, and it will add the item fingerprint to the filter if the item is new.
+ *
+ * Note: if the filter is full, it will be rebuilt with double the size,
+ * and if the new filter can't be allocated, the insertion will be undone and the item will not be freed.
+ *
+ * @param set the filtered hashset address
+ * @param item the item address
+ */
+
+void filteredHashSetInsert(FilteredHashSet *set, void *item) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "filtered hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int oldCount = set->hashSet->count;
+    hashSetInsert(set->hashSet, item);
+
+    if (set->hashSet->count > oldCount && !cuckooFilterInsert(set->filter, item) && !filteredHashSetRebuildFilter(set)) {
+        // the item isn't in the filter, so it's removed from the hashset too, other wise the lookups would miss it.
+        hashSetDeleteWtoFr(set->hashSet, item);
+
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new filter", "filtered hash set data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address, and the item address as a parameters,
+ * then it will delete and free the item from the hashset, and it will remove the item fingerprint from the filter.
+ *
+ * Note: if the filter says that the item doesn't exist, the hashset will not be probed at all.
+ *
+ * @param set the filtered hashset address
+ * @param item the item address
+ */
+
+void filteredHashSetDelete(FilteredHashSet *set, void *item) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "filtered hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(set->filter, item))
+        return;
+
+    void *removedItem = hashSetDeleteWtoFr(set->hashSet, item);
+    if (removedItem == NULL)
+        return;
+
+    // the stored item is used to remove the fingerprint, because the passed item could be the same pointer.
+    cuckooFilterDelete(set->filter, removedItem);
+    set->hashSet->freeItem(removedItem);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address, and the item address as a parameters,
+ * then it will return one (1) if the item is in the hashset, other wise it will return zero (0).
+ *
+ * Note: the filter is checked first, so most of the missing items will not probe the hashset.
+ *
+ * @param set the filtered hashset address
+ * @param item the item address
+ * @return it will return one if the item is in the hashset, other wise it will return zero
+ */
+
+int filteredHashSetContains(FilteredHashSet *set, void *item) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "filtered hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(set->filter, item))
+        return 0;
+
+    return hashSetContains(set->hashSet, item);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address, and the item address as a parameters,
+ * then it will return the stored item that equals the passed item if it exists, other wise it will return NULL.
+ *
+ * Note: the filter is checked first, so most of the missing items will not probe the hashset.
+ *
+ * @param set the filtered hashset address
+ * @param item the item address
+ * @return it will return the stored item if found, other wise it will return NULL
+ */
+
+void *filteredHashSetGet(FilteredHashSet *set, void *item) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (item == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "item pointer", "filtered hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (!cuckooFilterContains(set->filter, item))
+        return NULL;
+
+    return hashSetGet(set->hashSet, item);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address as a parameter,
+ * then it will return the number of items in the hashset.
+ *
+ * @param set the filtered hashset address
+ * @return it will return the number of items in the hashset
+ */
+
+int filteredHashSetGetLength(FilteredHashSet *set) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return hashSetGetLength(set->hashSet);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address as a parameter,
+ * then it will clear and free all the hashset items, and it will clear the filter.
+ *
+ * @param set the filtered hashset address
+ */
+
+void clearFilteredHashSet(FilteredHashSet *set) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearHashSet(set->hashSet);
+    clearCuckooFilter(set->filter);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address as a parameter,
+ * then it will destroy and free the hashset, the filter, and all the hashset items.
+ *
+ * @param set the filtered hashset address
+ */
+
+void destroyFilteredHashSet(FilteredHashSet *set) {
+    if (set == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "filtered hash set", "filtered hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    destroyHashSet(set->hashSet);
+    destroyCuckooFilter(set->filter);
+    free(set);
+
+}
+
+
+
+
+
+/** This function will take the filtered hashset address as a parameter,
+ * then it will replace the full filter with a new filter that has double the size, and it will fill it from the hashset items.
+ *
+ * Note: if the new filter can't be initialized, the old filter will be kept.
+ *
+ * Note: this function should only be called from the filtered hashset functions.
+ *
+ * @param set the filtered hashset address
+ * @return it will return one if the filter was rebuilt, other wise it will return zero
+ */
+
+int filteredHashSetRebuildFilter(FilteredHashSet *set) {
+    int expectedItems = set->hashSet->count;
+    CuckooFilter *newFilter;
+    int filled;
+
+    do {
+        expectedItems *= 2;
+        newFilter = cuckooFilterInitialization(expectedItems, set->falsePositiveRate, set->hashSet->hashFun);
+        if (newFilter == NULL)
+            return 0;
+
+        filled = 1;
+
+        HashSetIterator iterator;
+        hashSetIteratorBegin(set->hashSet, &iterator);
+        while (filled && hashSetIteratorNext(&iterator))
+            filled = cuckooFilterInsert(newFilter, hashSetIteratorItem(&iterator));
+
+        if (!filled)
+            destroyCuckooFilter(newFilter);
+
+    } while (!filled);
+
+    destroyCuckooFilter(set->filter);
+    set->filter = newFilter;
+
+    return 1;
+
+}
@@ -0,0 +1,915 @@
+#include "../Headers/FrozenHashMap.h"
+#include "../../../System/Utils.h"
+#include "../../../Unit Test/CuTest/CuTest.h"
+
+
+/// The value of the first header word, it marks the memory block as a frozen hashmap.
+#define FROZEN_HASH_MAP_MAGIC 0x314d4846u
+
+/// The number of the 32 bits words in the memory block header.
+#define FROZEN_HASH_MAP_HEADER_WORDS 8
+
+/// The average number of keys in one bucket, less keys per bucket means more seeds but faster building.
+#define FROZEN_HASH_MAP_BUCKET_KEYS 3
+
+/// The maximum number of seeds that will be tried for one bucket before the building fails.
+#define FROZEN_HASH_MAP_MAX_SEED (1u << 24)
+
+
+
+/** @struct FrozenHashMapKeyHash
+*  @brief This structure holds the hash of one key with the key index, so the keys can be sorted by their hashes while building.
+*  @var FrozenHashMapKeyHash::hash
+*  Member 'hash' holds the key mixed hash.
+*  @var FrozenHashMapKeyHash::index
+*  Member 'index' holds the key index in the keys array.
+*/
+
+typedef struct FrozenHashMapKeyHash {
+    uint64_t hash;
+    int index;
+} FrozenHashMapKeyHash;
+
+
+
+FrozenHashMap *frozenHashMapAllocate(int length, int overflowNum, int keySize, int itemSize);
+
+int frozenHashMapPlaceKeys(FrozenHashMap *map, uint64_t *hashes);
+
+int frozenHashMapCompareKeyHashes(const void *first, const void *second);
+
+void *frozenHashMapOverflowGet(FrozenHashMap *map, void *key, uint64_t hash);
+
+uint64_t frozenHashMapHashCal(int (*hashFun)(const void *), void *key);
+
+uint32_t frozenHashMapBucket(uint64_t hash, int bucketsNum);
+
+uint32_t frozenHashMapPosition(uint64_t hash, uint32_t seed, int length);
+
+
+
+
+
+/** This function will take the hashmap address, the size of one key, and the size of one item as a parameters,
+ * then it will build a new frozen hashmap that has the same entries of the passed hashmap,
+ * then the function will return the address of the frozen hashmap.
+ *
+ * Note: the keys and the items will be copied by value, so they should be plain fixed size values (integers, structs without pointers...),
+ * and the passed hashmap can be destroyed after the building.
+ *
+ * Note: the frozen hashmap will use the hashmap key comparator and hashing function,
+ * and the keys that share a hash with another key will be kept in the overflow table, that is slower to search.
+ *
+ * @param map the hashmap address
+ * @param keySize the size of one key in bytes
+ * @param itemSize the size of one item in bytes
+ * @return it will return the new frozen hashmap address
+ */
+
+FrozenHashMap *frozenHashMapBuild(HashMap *map, int keySize, int itemSize) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    void **keys = (void **) malloc(sizeof(void *) * (map->count + 1));
+    void **items = (void **) malloc(sizeof(void *) * (map->count + 1));
+    if (keys == NULL || items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(keys);
+            free(items);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "entries arrays", "frozen hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    int length = 0;
+    HashMapIterator iterator;
+    hashMapIteratorBegin(map, &iterator);
+    while (hashMapIteratorNext(&iterator)) {
+        keys[length] = hashMapIteratorKey(&iterator);
+        items[length++] = hashMapIteratorValue(&iterator);
+    }
+
+    FrozenHashMap *frozenMap = frozenHashMapBuildFromArrays(keys, items, length, keySize, itemSize, map->keyComp, map->hashFun);
+
+    free(keys);
+    free(items);
+
+    return frozenMap;
+
+}
+
+
+
+
+
+/** This function will take the keys array, the items array, the arrays length, the size of one key, the size of one item,
+ * the key comparator function, and the hashing function as a parameters,
+ * then it will build a new frozen hashmap that maps every key to the item with the same index,
+ * then the function will return the address of the frozen hashmap.
+ *
+ * Note: the keys and the items will be copied by value, so they should be plain fixed size values (integers, structs without pointers...),
+ * and the passed arrays can be freed after the building.
+ *
+ * Note: the keys should be unique, other wise the building will fail,
+ * and the keys that share a hash with another key will be kept in the overflow table, that is slower to search.
+ *
+ * @param keys the keys pointers array
+ * @param items the items pointers array
+ * @param length the length of the two arrays
+ * @param keySize the size of one key in bytes
+ * @param itemSize the size of one item in bytes
+ * @param keyComp the key comparator function address
+ * @param hashFun the hashing function that will return a unique integer representing the key
+ * @return it will return the new frozen hashmap address
+ */
+
+FrozenHashMap *frozenHashMapBuildFromArrays(void **keys, void **items, int length, int keySize, int itemSize, int (*keyComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    if (keys == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "arrays length", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (keySize <= 0 || itemSize <= 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key or item size", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (keyComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    FrozenHashMapKeyHash *keyHashes = (FrozenHashMapKeyHash *) malloc(sizeof(FrozenHashMapKeyHash) * (length + 1));
+    uint64_t *hashes = (uint64_t *) malloc(sizeof(uint64_t) * (length + 1));
+    if (keyHashes == NULL || hashes == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(keyHashes);
+            free(hashes);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hashes arrays", "frozen hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    for (int i = 0; i < length; i++) {
+        keyHashes[i].hash = frozenHashMapHashCal(hashFun, keys[i]);
+        keyHashes[i].index = i;
+    }
+
+    // after sorting, the keys with the same hash are next to each other, and all of them except the first go to the overflow table.
+    qsort(keyHashes, length, sizeof(FrozenHashMapKeyHash), frozenHashMapCompareKeyHashes);
+
+    int overflowNum = 0;
+    for (int i = 1; i < length; i++) {
+        if (keyHashes[i].hash != keyHashes[i - 1].hash)
+            continue;
+
+        for (int j = i - 1; j >= 0 && keyHashes[j].hash == keyHashes[i].hash; j--) {
+            if (keyComp(keys[keyHashes[i].index], keys[keyHashes[j].index]) == 0) {
+                free(keyHashes);
+                free(hashes);
+
+                #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                    ERROR_TEST->errorCode = INVALID_ARG;
+                    return NULL;
+                #else
+                    fprintf(stderr, INVALID_ARG_MESSAGE, "keys (every key should be unique)", "frozen hash map data structure");
+                    exit(INVALID_ARG);
+                #endif
+
+            }
+
+        }
+
+        overflowNum++;
+    }
+
+    FrozenHashMap *map = frozenHashMapAllocate(length, overflowNum, keySize, itemSize);
+    if (map == NULL) {
+        free(keyHashes);
+        free(hashes);
+        return NULL;
+    }
+
+    map->keyComp = keyComp;
+    map->hashFun = hashFun;
+
+    // the first key of every hash is kept for the perfect hash, and the other keys are copied to the overflow slots in the hashes order.
+    int primaryNum = 0, overflowIndex = 0;
+    for (int i = 0; i < length; i++) {
+        uint64_t hash = keyHashes[i].hash;
+        int keyIndex = keyHashes[i].index;
+
+        if (primaryNum > 0 && hash == hashes[primaryNum - 1]) {
+            char *slot = map->slots + (size_t) (length - overflowNum + overflowIndex) * map->slotSize;
+            memcpy(slot, keys[keyIndex], keySize);
+            memcpy(slot + map->itemOffset, items[keyIndex], itemSize);
+            map->overflowHashes[overflowIndex++] = hash;
+        } else {
+            hashes[primaryNum] = hash;
+            keyHashes[primaryNum++].index = keyIndex;
+        }
+
+    }
+
+    // the placing will write the slot index of every key in it's hash array cell.
+    if (!frozenHashMapPlaceKeys(map, hashes)) {
+        free(keyHashes);
+        free(hashes);
+        destroyFrozenHashMap(map);
+        return NULL;
+    }
+
+    for (int i = 0; i < primaryNum; i++) {
+        char *slot = map->slots + hashes[i] * map->slotSize;
+        memcpy(slot, keys[keyHashes[i].index], keySize);
+        memcpy(slot + map->itemOffset, items[keyHashes[i].index], itemSize);
+    }
+
+    free(keyHashes);
+    free(hashes);
+
+    return map;
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address, and the key address as a parameters,
+ * then it will return the address of the stored item copy if the key exists, other wise it will return NULL.
+ *
+ * Note: the returned address points inside the frozen hashmap, so it shouldn't be freed or changed.
+ *
+ * @param map the frozen hashmap address
+ * @param key the key address
+ * @return it will return the stored item address if the key was found, other wise it will return NULL
+ */
+
+void *frozenHashMapGet(FrozenHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    if (map->length == 0)
+        return NULL;
+
+    uint64_t hash = frozenHashMapHashCal(map->hashFun, key);
+    uint32_t seed = map->seeds[frozenHashMapBucket(hash, map->bucketsNum)];
+    char *slot = map->slots + (size_t) frozenHashMapPosition(hash, seed, map->length - map->overflowNum) * map->slotSize;
+
+    if (map->keyComp(key, slot) == 0)
+        return slot + map->itemOffset;
+
+    return map->overflowNum == 0 ? NULL : frozenHashMapOverflowGet(map, key, hash);
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address, and the key address as a parameters,
+ * then it will return one (1) if the key exists, other wise it will return zero (0).
+ *
+ * @param map the frozen hashmap address
+ * @param key the key address
+ * @return it will return one if the key exists, other wise it will return zero
+ */
+
+int frozenHashMapContains(FrozenHashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return -1;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    return frozenHashMapGet(map, key) != NULL;
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address as a parameter,
+ * then it will return the number of entries in the map.
+ *
+ * @param map the frozen hashmap address
+ * @return it will return the number of entries in the map
+ */
+
+int frozenHashMapGetLength(FrozenHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return map->length;
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address, and a file path as a parameters,
+ * then it will write the map memory block to the file, so it can be loaded later without rebuilding.
+ *
+ * Note: the file is written in the machine byte order, so it should be loaded on a machine with the same byte order.
+ *
+ * @param map the frozen hashmap address
+ * @param filePath the path of the file that the map will be written to
+ */
+
+void frozenHashMapSave(FrozenHashMap *map, char *filePath) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (filePath == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "file path", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    FILE *file = fopen(filePath, "wb");
+    if (file == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            return;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "open the file", "frozen hash map data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+    size_t written = fwrite(map->memory, 1, map->memorySize, file);
+    fclose(file);
+
+    if (written != map->memorySize) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            return;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "write the file", "frozen hash map data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+}
+
+
+
+
+
+/** This function will take a file path, the key comparator function, and the hashing function as a parameters,
+ * then it will load a frozen hashmap that was saved to the file, and it will return the map address.
+ *
+ * Note: the functions can't be saved with the map, so they should be the same functions that the map was built with.
+ *
+ * @param filePath the path of the file that has the saved map
+ * @param keyComp the key comparator function address
+ * @param hashFun the hashing function that the map was built with
+ * @return it will return the loaded frozen hashmap address
+ */
+
+FrozenHashMap *frozenHashMapLoad(char *filePath, int (*keyComp)(const void *, const void *), int (*hashFun)(const void *)) {
+    if (filePath == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "file path", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (keyComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "frozen hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    FILE *file = fopen(filePath, "rb");
+    if (file == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            return NULL;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "open the file", "frozen hash map data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+    uint32_t header[FROZEN_HASH_MAP_HEADER_WORDS];
+    FrozenHashMap *map = NULL;
+
+    if (fread(header, sizeof(uint32_t), FROZEN_HASH_MAP_HEADER_WORDS, file) == FROZEN_HASH_MAP_HEADER_WORDS
+        && header[0] == FROZEN_HASH_MAP_MAGIC && header[1] <= INT32_MAX && header[3] > 0 && header[3] <= INT32_MAX
+        && header[4] > 0 && header[4] <= INT32_MAX && (header[7] == 0 || header[7] < header[1]))
+        map = frozenHashMapAllocate((int) header[1], (int) header[7], (int) header[3], (int) header[4]);
+
+    if (map != NULL) {
+        size_t remainingSize = map->memorySize - sizeof(header);
+        if (fread((char *) map->memory + sizeof(header), 1, remainingSize, file) != remainingSize
+            || memcmp(map->memory, header, sizeof(header)) != 0) {
+            destroyFrozenHashMap(map);
+            map = NULL;
+        }
+
+    }
+
+    fclose(file);
+
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            return NULL;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "load the file", "frozen hash map data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+    map->keyComp = keyComp;
+    map->hashFun = hashFun;
+
+    return map;
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address as a parameter,
+ * then it will destroy and free the map with all it's entries copies.
+ *
+ * @param map the frozen hashmap address
+ */
+
+void destroyFrozenHashMap(FrozenHashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    free(map->memory);
+    free(map);
+
+}
+
+
+
+
+
+/** This function will take the number of entries, the number of the overflow keys, the size of one key, and the size of one item as a parameters,
+ * then it will allocate a new frozen hashmap with a zeroed memory block, that has it's header filled,
+ * then the function will return the map address.
+ *
+ * Note: the memory block starts with eight 32 bits header words, then the buckets seeds, then the slots, then the overflow hashes,
+ * and the seeds and every key and item are aligned to eight bytes.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param length the number of entries
+ * @param overflowNum the number of the keys in the overflow table
+ * @param keySize the size of one key in bytes
+ * @param itemSize the size of one item in bytes
+ * @return it will return the new frozen hashmap address
+ */
+
+FrozenHashMap *frozenHashMapAllocate(int length, int overflowNum, int keySize, int itemSize) {
+    FrozenHashMap *map = (FrozenHashMap *) malloc(sizeof(FrozenHashMap));
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "frozen hash map", "frozen hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    map->length = length;
+    map->overflowNum = overflowNum;
+    map->bucketsNum = length / FROZEN_HASH_MAP_BUCKET_KEYS + 1;
+    map->keySize = keySize;
+    map->itemSize = itemSize;
+    map->itemOffset = (keySize + 7) & ~7;
+    map->slotSize = map->itemOffset + ((itemSize + 7) & ~7);
+
+    size_t seedsSize = sizeof(uint32_t) * (size_t) ((map->bucketsNum + 1) & ~1);
+    map->memorySize = sizeof(uint32_t) * FROZEN_HASH_MAP_HEADER_WORDS + seedsSize + (size_t) map->slotSize * length
+                      + sizeof(uint64_t) * overflowNum;
+
+    map->memory = calloc(1, map->memorySize);
+    if (map->memory == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(map);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "memory block", "frozen hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    uint32_t *header = (uint32_t *) map->memory;
+    header[0] = FROZEN_HASH_MAP_MAGIC;
+    header[1] = (uint32_t) map->length;
+    header[2] = (uint32_t) map->bucketsNum;
+    header[3] = (uint32_t) map->keySize;
+    header[4] = (uint32_t) map->itemSize;
+    header[5] = (uint32_t) map->slotSize;
+    header[6] = (uint32_t) map->itemOffset;
+    header[7] = (uint32_t) map->overflowNum;
+
+    map->seeds = header + FROZEN_HASH_MAP_HEADER_WORDS;
+    map->slots = (char *) map->seeds + seedsSize;
+    map->overflowHashes = (uint64_t *) (map->slots + (size_t) map->slotSize * length);
+    map->keyComp = NULL;
+    map->hashFun = NULL;
+
+    return map;
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address, and the keys hashes array as a parameters,
+ * then it will find a seed for every bucket that places all the bucket keys in free slots,
+ * and it will replace every hash in the array with the slot index of it's key.
+ *
+ * Note: the array should have (length - overflowNum) different hashes, because two keys with the same hash always land in the same slot.
+ *
+ * Note: the buckets are placed from the biggest to the smallest, because the big buckets are hard to place when the slots are almost full.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param map the frozen hashmap address
+ * @param hashes the keys hashes array
+ * @return it will return one if all the keys were placed, other wise it will return zero
+ */
+
+int frozenHashMapPlaceKeys(FrozenHashMap *map, uint64_t *hashes) {
+    int length = map->length - map->overflowNum, bucketsNum = map->bucketsNum;
+
+    int *bucketStarts = (int *) calloc(bucketsNum + 1, sizeof(int));
+    int *bucketKeys = (int *) malloc(sizeof(int) * (length + 1));
+    int *bucketsOrder = (int *) malloc(sizeof(int) * bucketsNum);
+    char *takenSlots = (char *) calloc(length + 1, sizeof(char));
+    if (bucketStarts == NULL || bucketKeys == NULL || bucketsOrder == NULL || takenSlots == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            free(bucketStarts);
+            free(bucketKeys);
+            free(bucketsOrder);
+            free(takenSlots);
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return 0;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "building arrays", "frozen hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    // counting sort of the keys by their buckets.
+    for (int i = 0; i < length; i++)
+        bucketStarts[frozenHashMapBucket(hashes[i], bucketsNum) + 1]++;
+
+    int maxBucketSize = 0;
+    for (int i = 0; i < bucketsNum; i++) {
+        if (bucketStarts[i + 1] > maxBucketSize)
+            maxBucketSize = bucketStarts[i + 1];
+
+        bucketStarts[i + 1] += bucketStarts[i];
+    }
+
+    int *bucketFill = bucketsOrder;
+    memcpy(bucketFill, bucketStarts, sizeof(int) * bucketsNum);
+    for (int i = 0; i < length; i++)
+        bucketKeys[bucketFill[frozenHashMapBucket(hashes[i], bucketsNum)]++] = i;
+
+    int orderIndex = 0;
+    for (int size = maxBucketSize; size > 0; size--) {
+        for (int i = 0; i < bucketsNum; i++) {
+            if (bucketStarts[i + 1] - bucketStarts[i] == size)
+                bucketsOrder[orderIndex++] = i;
+        }
+    }
+
+    int placed = 1;
+    for (int i = 0; i < orderIndex && placed; i++) {
+        int bucket = bucketsOrder[i];
+        int *keysIndices = bucketKeys + bucketStarts[bucket];
+        int size = bucketStarts[bucket + 1] - bucketStarts[bucket];
+
+        uint32_t seed = 0;
+        for (; seed < FROZEN_HASH_MAP_MAX_SEED; seed++) {
+            int j = 0;
+            for (; j < size; j++) {
+                uint32_t position = frozenHashMapPosition(hashes[keysIndices[j]], seed, length);
+                if (takenSlots[position])
+                    break;
+
+                takenSlots[position] = 1;
+            }
+
+            if (j == size)
+                break;
+
+            while (--j >= 0)
+                takenSlots[frozenHashMapPosition(hashes[keysIndices[j]], seed, length)] = 0;
+
+        }
+
+        if (seed == FROZEN_HASH_MAP_MAX_SEED) {
+            placed = 0;
+            break;
+        }
+
+        map->seeds[bucket] = seed;
+        for (int j = 0; j < size; j++)
+            hashes[keysIndices[j]] = frozenHashMapPosition(hashes[keysIndices[j]], seed, length);
+
+    }
+
+    free(bucketStarts);
+    free(bucketKeys);
+    free(bucketsOrder);
+    free(takenSlots);
+
+    if (!placed) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = SOMETHING_WENT_WRONG;
+            return 0;
+        #else
+            fprintf(stderr, SOMETHING_WENT_WRONG_MESSAGE, "place the keys", "frozen hash map data structure");
+            exit(SOMETHING_WENT_WRONG);
+        #endif
+
+    }
+
+    return 1;
+
+}
+
+
+
+
+
+/** This function will take two key hashes structures as a parameters,
+ * then it will compare their hashes, so the keys can be sorted by their hashes.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param first the first key hash structure address
+ * @param second the second key hash structure address
+ * @return it will return a negative number if the first hash is smaller, a positive number if it's bigger, other wise zero
+ */
+
+int frozenHashMapCompareKeyHashes(const void *first, const void *second) {
+    uint64_t firstHash = ((FrozenHashMapKeyHash *) first)->hash, secondHash = ((FrozenHashMapKeyHash *) second)->hash;
+
+    return (firstHash > secondHash) - (firstHash < secondHash);
+
+}
+
+
+
+
+
+/** This function will take the frozen hashmap address, the key address, and the key mixed hash as a parameters,
+ * then it will binary search the overflow hashes for the key hash, and it will compare the key with every overflow key that has the same hash,
+ * then it will return the address of the stored item copy if the key was found, other wise it will return NULL.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param map the frozen hashmap address
+ * @param key the key address
+ * @param hash the key mixed hash
+ * @return it will return the stored item address if the key was found, other wise it will return NULL
+ */
+
+void *frozenHashMapOverflowGet(FrozenHashMap *map, void *key, uint64_t hash) {
+    int start = 0, end = map->overflowNum;
+    while (start < end) {
+        int middle = start + (end - start) / 2;
+        if (map->overflowHashes[middle] < hash)
+            start = middle + 1;
+        else
+            end = middle;
+    }
+
+    char *overflowSlots = map->slots + (size_t) (map->length - map->overflowNum) * map->slotSize;
+    for (int i = start; i < map->overflowNum && map->overflowHashes[i] == hash; i++) {
+        char *slot = overflowSlots + (size_t) i * map->slotSize;
+        if (map->keyComp(key, slot) == 0)
+            return slot + map->itemOffset;
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take the hashing function, and the key address as a parameters,
+ * then it will call the hashing function and spread the returned value over 64 bits.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param hashFun the hashing function address
+ * @param key the key address
+ * @return it will return the mixed 64 bits hash
+ */
+
+uint64_t frozenHashMapHashCal(int (*hashFun)(const void *), void *key) {
+    uint64_t hash = (uint32_t) hashFun(key);
+
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+
+    return hash;
+
+}
+
+
+
+
+
+/** This function will take the key mixed hash, and the number of buckets as a parameters,
+ * then it will return the index of the key bucket.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param hash the key mixed hash
+ * @param bucketsNum the number of buckets
+ * @return it will return the key bucket index
+ */
+
+uint32_t frozenHashMapBucket(uint64_t hash, int bucketsNum) {
+    return (uint32_t) (((hash >> 32) * (uint64_t) bucketsNum) >> 32);
+}
+
+
+
+
+
+/** This function will take the key mixed hash, the key bucket seed, and the number of slots as a parameters,
+ * then it will return the slot index of the key.
+ *
+ * Note: this function should only be called from the frozen hashmap functions.
+ *
+ * @param hash the key mixed hash
+ * @param seed the key bucket seed
+ * @param length the number of slots
+ * @return it will return the key slot index
+ */
+
+uint32_t frozenHashMapPosition(uint64_t hash, uint32_t seed, int length) {
+    uint64_t position = hash ^ ((uint64_t) seed * 0x9e3779b97f4a7c15ULL);
+
+    position = (position ^ (position >> 31)) * 0xd6e8feb86659fd93ULL;
+    position ^= position >> 32;
+
+    return (uint32_t) (((position & 0xffffffffULL) * (uint64_t) length) >> 32);
+
+}
@@ -5,6 +5,21 @@
 
 
 
+#if defined(__GNUC__) || defined(__clang__)
+    #define HASH_MAP_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define HASH_MAP_PREFETCH(address)
+#endif
+
+
+/// The number of keys that the batch functions hash and prefetch together before resolving them.
+#define HASH_MAP_BATCH_CHUNK 32
+
+/// The maximum percentage of the map array that the presized map should fill, so the probe sequences stay short.
+#define HASH_MAP_MAX_LOAD_PERCENT 75
+
+
+
 unsigned int hashMapFHashCal(int (*hashFun)(const void *), void *key, unsigned int length);
 
 
@@ -20,6 +35,27 @@ int calBPrime(int length);
 int getNextPrime(int num);
 
 
+int hashMapLengthForCapacity(int capacity);
+
+
+HashMap *hashMapInitializationWithLength(
+        int length
+        , void (*freeKey)(void *)
+        , void (*freeItem)(void *)
+        , int (*keyComp)(const void *, const void *)
+        , int (*hashFun)(const void *)
+        );
+
+
+void hashMapPrepareBatch(HashMap *map, void **keys, int length, unsigned int *fHashes, unsigned int *sHashes);
+
+
+int hashMapFindIndexWithHash(HashMap *map, void *key, unsigned int fHash, unsigned int sHash);
+
+
+void hashMapRehash(HashMap *map, int newLength);
+
+
 
 
 
@@ -63,77 +99,50 @@ HashMap *hashMapInitialization(
         , int (*hashFun)(const void *)
         ) {
 
-    if (freeKey == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "free key function pointer", "hash map data structure");
-     		exit(INVALID_ARG);
-     	#endif
+    return hashMapInitializationWithLength(getNextPrime(10), freeKey, freeItem, keyComp, hashFun); //the length of the map array should always be a prime number.
 
-    } else if (freeItem == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "free item function pointer", "hash map data structure");
-     		exit(INVALID_ARG);
-     	#endif
+}
 
-    } else if (keyComp == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "hash map data structure");
-     		exit(INVALID_ARG);
-     	#endif
 
-    } else if (hashFun == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-            ERROR_TEST->errorCode = INVALID_ARG;
-            return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "hash map data structure");
-            exit(INVALID_ARG);
-        #endif
 
-    }
 
-    HashMap *map = (HashMap *) malloc(sizeof(HashMap));
-    if (map == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
-     		return NULL;
-        #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map", "hash map data structure");
-     		exit(FAILED_ALLOCATION);
-     	#endif
 
-    }
+/** This function will take the initial capacity, the freeing item function address, the freeing key function address,
+ * the key comparator function, and the hash function as a parameters,
+ * then it will initialize a new hash map that can hold the passed number of entries without growing,
+ * then the function will return the address of the hash map.
+ *
+ * Note: the map array will be bigger than the capacity so it's never filled over the maximum load percentage,
+ * and it's length will be rounded up to a prime number that is never smaller than the default length.
+ *
+ * @param capacity the number of entries that the hash map should hold before it needs to grow
+ * @param freeKey the freeing key function address that will be called to free the items keys
+ * @param freeItem the freeing item function address that will be called to free the hash map items
+ * @param keyComp the function that will be called to compare the keys
+ * @param hashFun the hashing function that will return a unique integer representing the hash map key
+ * @return it will return the new initialized hash map address
+ */
 
-    map->length = getNextPrime(10); //the length of the map array should always be a prime number.
-    map->arr = (Entry **) calloc(sizeof(Entry *), map->length);
-    if (map == NULL) {
+HashMap *hashMapInitializationWithCapacity(
+        int capacity
+        , void (*freeKey)(void *)
+        , void (*freeItem)(void *)
+        , int (*keyComp)(const void *, const void *)
+        , int (*hashFun)(const void *)
+        ) {
+
+    if (capacity <= 0) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
-     		return NULL;
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
         #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map entries array", "hash map data structure");
-     		exit(FAILED_ALLOCATION);
-     	#endif
+            fprintf(stderr, INVALID_ARG_MESSAGE, "initial capacity", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    map->count = 0;
-    map->bPrime = calBPrime(map->length);
-    map->freeItemFun = freeItem;
-    map->freeKeyFun = freeKey;
-    map->keyComp = keyComp;
-    map->hashFun = hashFun;
-
-    return map;
+    return hashMapInitializationWithLength(hashMapLengthForCapacity(capacity), freeKey, freeItem, keyComp, hashFun);
 
 }
 
@@ -246,6 +255,154 @@ void hashMapInsert(HashMap *map, void *key, void *item) {
 
 
 
+/** This function will take the map address, the keys array, the items array, and the length of the arrays as a parameters,
+ * then it will insert every item with the key that has the same index in the keys array.
+ *
+ * Note: the map will be grown once before inserting, then the keys will be hashed in small chunks,
+ * and the home index of every key in the chunk will be prefetched before resolving any of them,
+ * so the cache misses of the chunk keys will overlap instead of waiting for each other.
+ *
+ * Note: if a key is already in the map then the map will override the data and free the old item and it's key.
+ *
+ * @param map the hash map address
+ * @param keys the keys array
+ * @param items the items array
+ * @param length the length of the keys and the items arrays
+ */
+
+void hashMapInsertBatch(HashMap *map, void **keys, void **items, int length) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (keys == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "arrays length", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    for (int i = 0; i < length; i++) {
+        if (keys[i] == NULL || items[i] == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = INVALID_ARG;
+                return;
+            #else
+                fprintf(stderr, INVALID_ARG_MESSAGE, keys[i] == NULL ? "key pointer" : "item pointer", "hash map data structure");
+                exit(INVALID_ARG);
+            #endif
+
+        }
+
+    }
+
+    if (map->count + length > map->length) {
+        int newLength = map->length;
+        while (map->count + length > newLength)
+            newLength *= 2;
+
+        newLength = getNextPrime(newLength); //the length of the map array should always be a prime number.
+        Entry **newArr = (Entry **) realloc(map->arr, sizeof(Entry *) * newLength);
+        if (newArr == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = FAILED_REALLOCATION;
+                return;
+            #else
+                fprintf(stderr, FAILED_REALLOCATION_MESSAGE, "entries array", "hash map data structure");
+                exit(FAILED_REALLOCATION);
+            #endif
+
+        }
+
+        for (int i = map->length; i < newLength; i++)
+            newArr[i] = NULL;
+
+        map->arr = newArr;
+        map->length = newLength;
+        map->bPrime = calBPrime(map->length);
+    }
+
+    unsigned int fHashes[HASH_MAP_BATCH_CHUNK], sHashes[HASH_MAP_BATCH_CHUNK];
+
+    for (int start = 0; start < length; start += HASH_MAP_BATCH_CHUNK) {
+        int chunkLength = length - start < HASH_MAP_BATCH_CHUNK ? length - start : HASH_MAP_BATCH_CHUNK;
+        hashMapPrepareBatch(map, keys + start, chunkLength, fHashes, sHashes);
+
+        for (int i = 0; i < chunkLength; i++) {
+            void *key = keys[start + i], *item = items[start + i];
+
+            unsigned int pHashIndex = 1;
+            unsigned int index = calIndex(fHashes[i], sHashes[i], pHashIndex, map->length);
+
+            while (map->arr[index] != NULL && map->keyComp(key, map->arr[index]->key) != 0)
+                index = calIndex(fHashes[i], sHashes[i], ++pHashIndex, map->length);
+
+            if (map->arr[index] != NULL) {
+                map->freeItemFun(map->arr[index]->item);
+                map->freeKeyFun(map->arr[index]->key);
+                map->arr[index]->key = key;
+                map->arr[index]->item = item;
+                continue;
+            }
+
+            Entry *newEntry = (Entry *) malloc(sizeof(Entry));
+            if (newEntry == NULL) {
+                #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                    ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                    return;
+                #else
+                    fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new entry", "hash map data structure");
+                    exit(FAILED_ALLOCATION);
+                #endif
+
+            }
+
+            newEntry->key = key;
+            newEntry->item = item;
+            newEntry->freeItemFun = map->freeItemFun;
+            newEntry->freeKeyFun = map->freeKeyFun;
+            map->arr[index] = newEntry;
+            map->count++;
+        }
+
+    }
+
+}
+
+
+
+
+
+
+
+
 
 
 /** This function will take the map address, and the key address as a parameters,
@@ -307,62 +464,75 @@ int hashMapContains(HashMap *map, void *key) {
 
 
 
-
-/** This function will take the map address, and the key address as a parameter,
- * then it will return the item address if the key existed,
- * other wise it will return NULL.
+/** This function will take the map address, the keys array, the length of the keys array, and the results array as a parameters,
+ * then it will set every index in the results array to one (1) if the key with the same index is in the map,
+ * other wise it will set it to zero (0).
  *
- * Note: this function will not free the passed key.
+ * Note: the keys will be hashed in small chunks, and the home index of every key in the chunk
+ * will be prefetched before resolving any of them.
+ *
+ * Note: this function will not free the passed keys.
  *
  * @param map the hash map address
- * @param key the key address
- * @return it will return the item with the provided key if found other wise it will return NULL
+ * @param keys the keys array
+ * @param length the length of the keys array
+ * @param results the array that will be filled with the results, and it should have at least the keys array length
  */
 
-void *hashMapGet(HashMap *map, void *key) {
+void hashMapContainsBatch(HashMap *map, void **keys, int length, int *results) {
     if (map == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return NULL;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            exit(NULL_POINTER);
+        #endif
 
-    } else if (key == NULL) {
+    } else if (keys == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
         #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "hash map data structure");
-     		exit(INVALID_ARG);
-     	#endif
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
 
-    }
+    } else if (results == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "results array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
 
-    unsigned int fHash = hashMapFHashCal(map->hashFun, key, map->length),
-    sHash = hashMapSHashCal(map->hashFun, key, map->bPrime);
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array length", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
 
-    unsigned int pHashIndex = 1;
-    unsigned int index = calIndex(fHash, sHash, pHashIndex, map->length);
-    unsigned int firstIndex = index;
+    }
 
-    do {
+    unsigned int fHashes[HASH_MAP_BATCH_CHUNK], sHashes[HASH_MAP_BATCH_CHUNK];
 
-        if (map->arr[index] != NULL) {
-            if (map->keyComp(key, map->arr[index]->key) == 0)
-                return map->arr[index]->item;
+    for (int start = 0; start < length; start += HASH_MAP_BATCH_CHUNK) {
+        int chunkLength = length - start < HASH_MAP_BATCH_CHUNK ? length - start : HASH_MAP_BATCH_CHUNK;
+        hashMapPrepareBatch(map, keys + start, chunkLength, fHashes, sHashes);
 
-        }
+        for (int i = 0; i < chunkLength; i++)
+            results[start + i] = hashMapFindIndexWithHash(map, keys[start + i], fHashes[i], sHashes[i]) != -1;
 
-        pHashIndex++;
-        index = calIndex(fHash, sHash, pHashIndex, map->length);
+    }
+
+}
 
-    } while (firstIndex != index);
 
-    return NULL;
 
-}
 
 
 
@@ -370,7 +540,7 @@ void *hashMapGet(HashMap *map, void *key) {
 
 
 /** This function will take the map address, and the key address as a parameter,
- * then it will return the key address if the key existed,
+ * then it will return the item address if the key existed,
  * other wise it will return NULL.
  *
  * Note: this function will not free the passed key.
@@ -380,7 +550,7 @@ void *hashMapGet(HashMap *map, void *key) {
  * @return it will return the item with the provided key if found other wise it will return NULL
  */
 
-void *hashMapGetKey(HashMap *map, void *key) {
+void *hashMapGet(HashMap *map, void *key) {
     if (map == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = NULL_POINTER;
@@ -412,7 +582,7 @@ void *hashMapGetKey(HashMap *map, void *key) {
 
         if (map->arr[index] != NULL) {
             if (map->keyComp(key, map->arr[index]->key) == 0)
-                return map->arr[index]->key;
+                return map->arr[index]->item;
 
         }
 
@@ -428,27 +598,164 @@ void *hashMapGetKey(HashMap *map, void *key) {
 
 
 
-
-/** This function will take the map address, and the key address as a parameters,
- * then it will delete and free the key and the item that linked to the key.
+/** This function will take the map address, the keys array, the length of the keys array, and the items array as a parameters,
+ * then it will set every index in the items array to the item of the key that has the same index,
+ * or to NULL if the key is not in the map.
  *
- * Note: if the key didn't found in the hash map, then the function will do nothing.
+ * Note: the keys will be hashed in small chunks, and the home index of every key in the chunk
+ * will be prefetched before resolving any of them.
+ *
+ * Note: this function will not free the passed keys.
  *
  * @param map the hash map address
- * @param key the key address
+ * @param keys the keys array
+ * @param length the length of the keys array
+ * @param items the array that will be filled with the items, and it should have at least the keys array length
  */
 
-void hashMapDelete(HashMap *map, void *key) {
+void hashMapGetBatch(HashMap *map, void **keys, int length, void **items) {
     if (map == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            exit(NULL_POINTER);
+        #endif
 
-    } else if (key == NULL) {
+    } else if (keys == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (items == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "items array pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    } else if (length < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "keys array length", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    unsigned int fHashes[HASH_MAP_BATCH_CHUNK], sHashes[HASH_MAP_BATCH_CHUNK];
+
+    for (int start = 0; start < length; start += HASH_MAP_BATCH_CHUNK) {
+        int chunkLength = length - start < HASH_MAP_BATCH_CHUNK ? length - start : HASH_MAP_BATCH_CHUNK;
+        hashMapPrepareBatch(map, keys + start, chunkLength, fHashes, sHashes);
+
+        for (int i = 0; i < chunkLength; i++) {
+            int index = hashMapFindIndexWithHash(map, keys[start + i], fHashes[i], sHashes[i]);
+            items[start + i] = index != -1 ? map->arr[index]->item : NULL;
+        }
+
+    }
+
+}
+
+
+
+
+
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameter,
+ * then it will return the key address if the key existed,
+ * other wise it will return NULL.
+ *
+ * Note: this function will not free the passed key.
+ *
+ * @param map the hash map address
+ * @param key the key address
+ * @return it will return the item with the provided key if found other wise it will return NULL
+ */
+
+void *hashMapGetKey(HashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    } else if (key == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "hash map data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    }
+
+    unsigned int fHash = hashMapFHashCal(map->hashFun, key, map->length),
+    sHash = hashMapSHashCal(map->hashFun, key, map->bPrime);
+
+    unsigned int pHashIndex = 1;
+    unsigned int index = calIndex(fHash, sHash, pHashIndex, map->length);
+    unsigned int firstIndex = index;
+
+    do {
+
+        if (map->arr[index] != NULL) {
+            if (map->keyComp(key, map->arr[index]->key) == 0)
+                return map->arr[index]->key;
+
+        }
+
+        pHashIndex++;
+        index = calIndex(fHash, sHash, pHashIndex, map->length);
+
+    } while (firstIndex != index);
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take the map address, and the key address as a parameters,
+ * then it will delete and free the key and the item that linked to the key.
+ *
+ * Note: if the key didn't found in the hash map, then the function will do nothing.
+ *
+ * @param map the hash map address
+ * @param key the key address
+ */
+
+void hashMapDelete(HashMap *map, void *key) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    } else if (key == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = INVALID_ARG;
      		return;
@@ -713,6 +1020,83 @@ Entry **hashMapToEntryArray(HashMap *map) {
 
 
 
+/** This function will take the map address, and the capacity as a parameters,
+ * then it will grow the map array so it can hold the passed number of entries without growing again.
+ *
+ * Note: this function is useful before loading a lot of entries, because the map will grow only once.
+ *
+ * Note: if the map can already hold the passed capacity, then the function will do nothing.
+ *
+ * @param map the hash map address
+ * @param capacity the number of entries that the map should be able to hold
+ */
+
+void hashMapReserve(HashMap *map, int capacity) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (capacity < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "capacity", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int newLength = hashMapLengthForCapacity(capacity);
+    if (newLength <= map->length)
+        return;
+
+    hashMapRehash(map, newLength);
+
+}
+
+
+
+
+/** This function will take the map address as a parameter,
+ * then it will shrink the map array to the smallest prime length that holds the current entries under the maximum load percentage.
+ *
+ * Note: this function is useful after deleting a lot of entries, because the map array never shrinks by itself.
+ *
+ * Note: the map length will never be smaller than the default length.
+ *
+ * @param map the hash map address
+ */
+
+void hashMapShrinkToFit(HashMap *map) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int newLength = hashMapLengthForCapacity(map->count);
+    if (newLength >= map->length)
+        return;
+
+    hashMapRehash(map, newLength);
+
+}
+
+
+
+
+
 /** This function will take the map address as a parameter,
  * then it will return the number of items in the map.
  *
@@ -768,6 +1152,185 @@ int hashMapIsEmpty(HashMap *map) {
 
 
 
+/** This function will take the map address, and the iterator address as a parameters,
+ * then it will setup the iterator to walk over the map entries.
+ *
+ * Note: the iterator will be positioned before the first entry, so you need to call hashMapIteratorNext before reading the first entry.
+ *
+ * Note: the iterator doesn't allocate any memory, so it can be declared on the stack.
+ *
+ * Note: inserting into the map while iterating over it will leave the iterator in undefined state,
+ * but deleting the current entry with hashMapIteratorRemove is safe.
+ *
+ * @param map the hash map address
+ * @param iterator the iterator address
+ */
+
+void hashMapIteratorBegin(HashMap *map, HashMapIterator *iterator) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    iterator->map = map;
+    iterator->index = -1;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will move the iterator to the next entry in the map.
+ *
+ * @param iterator the iterator address
+ * @return it will return one if the iterator moved to a new entry, other wise it will return zero if there is no more entries
+ */
+
+int hashMapIteratorNext(HashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    HashMap *map = iterator->map;
+    while (++iterator->index < map->length) {
+        if (map->arr[iterator->index] != NULL)
+            return 1;
+
+    }
+
+    iterator->index = map->length;
+    return 0;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will return the key of the current entry.
+ *
+ * Note: the function will return NULL if the iterator isn't positioned on an entry.
+ *
+ * @param iterator the iterator address
+ * @return it will return the current entry key
+ */
+
+void *hashMapIteratorKey(HashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    if (iterator->index < 0 || iterator->index >= iterator->map->length || iterator->map->arr[iterator->index] == NULL)
+        return NULL;
+
+    return iterator->map->arr[iterator->index]->key;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will return the item of the current entry.
+ *
+ * Note: the function will return NULL if the iterator isn't positioned on an entry.
+ *
+ * @param iterator the iterator address
+ * @return it will return the current entry item
+ */
+
+void *hashMapIteratorValue(HashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    if (iterator->index < 0 || iterator->index >= iterator->map->length || iterator->map->arr[iterator->index] == NULL)
+        return NULL;
+
+    return iterator->map->arr[iterator->index]->item;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will delete and free the current entry key and item from the map.
+ *
+ * Note: after the deletion the iterator will still point to the deleted place,
+ * so the next call of hashMapIteratorNext will move it to the entry after the deleted one.
+ *
+ * @param iterator the iterator address
+ */
+
+void hashMapIteratorRemove(HashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator->index < 0 || iterator->index >= iterator->map->length || iterator->map->arr[iterator->index] == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "hash map data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    freeEntry(iterator->map->arr[iterator->index]);
+    iterator->map->arr[iterator->index] = NULL;
+    iterator->map->count--;
+
+}
+
+
+
+
+
 /** This function will take the map address as a parameter,
  * then it will clear and free all the items and it's key from the map without freeing the map.
  *
@@ -939,4 +1502,274 @@ int getNextPrime(int num) {
 
     return 1;
 
-}
\ No newline at end of file
+}
+
+
+
+
+/** This function will take the map address, a chunk of keys, the chunk length, and two hashes arrays as a parameters,
+ * then it will hash every key in the chunk only once, and it will fill the first and the second hashes arrays.
+ *
+ * After hashing, the home slot of every key will be prefetched,
+ * then the entries in the home slots will be prefetched too,
+ * so all the chunk memory loads are in flight before the first key is resolved.
+ *
+ * Note: this function should only be called from the hash map batch functions.
+ *
+ * @param map the hash map address
+ * @param keys the chunk keys array
+ * @param length the chunk length
+ * @param fHashes the array that will be filled with the first hashes
+ * @param sHashes the array that will be filled with the second hashes
+ */
+
+void hashMapPrepareBatch(HashMap *map, void **keys, int length, unsigned int *fHashes, unsigned int *sHashes) {
+    for (int i = 0; i < length; i++) {
+        if (keys[i] == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = INVALID_ARG;
+                fHashes[i] = sHashes[i] = 0;
+                continue;
+            #else
+                fprintf(stderr, INVALID_ARG_MESSAGE, "key pointer", "hash map data structure");
+                exit(INVALID_ARG);
+            #endif
+
+        }
+
+        unsigned int hash = (unsigned int) map->hashFun(keys[i]);
+        fHashes[i] = hash % (unsigned int) map->length;
+        sHashes[i] = map->bPrime - hash % (unsigned int) map->bPrime;
+
+        HASH_MAP_PREFETCH(map->arr + calIndex(fHashes[i], sHashes[i], 1, map->length));
+    }
+
+    for (int i = 0; i < length; i++) {
+        Entry *entry = map->arr[calIndex(fHashes[i], sHashes[i], 1, map->length)];
+        if (entry != NULL)
+            HASH_MAP_PREFETCH(entry);
+
+    }
+
+}
+
+
+
+
+/** This function will take the map address, the key address, and the two hashes of the key as a parameters,
+ * then it will return the index of the key entry in the map array if found, other wise it will return -1.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * @param map the hash map address
+ * @param key the key address
+ * @param fHash the first hash of the key
+ * @param sHash the second hash of the key
+ * @return it will return the index of the key entry if found, other wise it will return -1
+ */
+
+int hashMapFindIndexWithHash(HashMap *map, void *key, unsigned int fHash, unsigned int sHash) {
+    if (key == NULL)
+        return -1;
+
+    unsigned int pHashIndex = 1;
+    unsigned int index = calIndex(fHash, sHash, pHashIndex, map->length);
+    unsigned int firstIndex = index;
+
+    do {
+
+        if (map->arr[index] != NULL && map->keyComp(key, map->arr[index]->key) == 0)
+            return (int) index;
+
+        pHashIndex++;
+        index = calIndex(fHash, sHash, pHashIndex, map->length);
+
+    } while (firstIndex != index);
+
+    return -1;
+
+}
+
+
+
+
+
+
+/** This function will take the map array length, the freeing item function address, the freeing key function address,
+ * the key comparator function, and the hash function as a parameters,
+ * then it will initialize a new hash map with the passed array length,
+ * then the function will return the address of the hash map.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * Note: the length should be a prime number.
+ *
+ * @param length the map array length
+ * @param freeKey the freeing key function address that will be called to free the items keys
+ * @param freeItem the freeing item function address that will be called to free the hash map items
+ * @param keyComp the function that will be called to compare the keys
+ * @param hashFun the hashing function that will return a unique integer representing the hash map key
+ * @return it will return the new initialized hash map address
+ */
+
+HashMap *hashMapInitializationWithLength(
+        int length
+        , void (*freeKey)(void *)
+        , void (*freeItem)(void *)
+        , int (*keyComp)(const void *, const void *)
+        , int (*hashFun)(const void *)
+        ) {
+
+    if (freeKey == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free key function pointer", "hash map data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free item function pointer", "hash map data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (keyComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "key comparator function pointer", "hash map data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "hash map data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    HashMap *map = (HashMap *) malloc(sizeof(HashMap));
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
+     		return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map", "hash map data structure");
+     		exit(FAILED_ALLOCATION);
+     	#endif
+
+    }
+
+    map->length = length;
+    map->arr = (Entry **) calloc(sizeof(Entry *), map->length);
+    if (map->arr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
+     		return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map entries array", "hash map data structure");
+     		exit(FAILED_ALLOCATION);
+     	#endif
+
+    }
+
+    map->count = 0;
+    map->bPrime = calBPrime(map->length);
+    map->freeItemFun = freeItem;
+    map->freeKeyFun = freeKey;
+    map->keyComp = keyComp;
+    map->hashFun = hashFun;
+
+    return map;
+
+}
+
+
+
+
+
+/** This function will take the number of entries as a parameter,
+ * then it will return the prime map array length that holds them without passing the maximum load percentage.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * Note: the returned length will never be smaller than the default length.
+ *
+ * @param capacity the number of entries that the map array should hold
+ * @return it will return the map array length
+ */
+
+int hashMapLengthForCapacity(int capacity) {
+    long long length = ((long long) capacity * 100 + HASH_MAP_MAX_LOAD_PERCENT - 1) / HASH_MAP_MAX_LOAD_PERCENT;
+    if (length > INT_MAX / 2)
+        length = INT_MAX / 2;
+
+    return getNextPrime(length < 10 ? 10 : (int) length); //the length of the map array should always be a prime number.
+
+}
+
+
+
+
+/** This function will take the map address, and the new length as a parameters,
+ * then it will allocate a new array with the new length and move all the entries into it,
+ * using the new length to calculate their indices.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * Note: the new length should be a prime number that is bigger than or equal to the number of entries.
+ *
+ * @param map the hash map address
+ * @param newLength the new length of the hash map array
+ */
+
+void hashMapRehash(HashMap *map, int newLength) {
+    Entry **newArr = (Entry **) calloc(sizeof(Entry *), newLength);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map entries array", "hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    int newBPrime = calBPrime(newLength);
+
+    for (int i = 0; i < map->length; i++) {
+        if (map->arr[i] == NULL)
+            continue;
+
+        unsigned int fHash = hashMapFHashCal(map->hashFun, map->arr[i]->key, newLength),
+        sHash = hashMapSHashCal(map->hashFun, map->arr[i]->key, newBPrime);
+
+        unsigned int pHashIndex = 1;
+        unsigned int index = calIndex(fHash, sHash, pHashIndex, newLength);
+
+        while (newArr[index] != NULL) {
+            pHashIndex++;
+            index = calIndex(fHash, sHash, pHashIndex, newLength);
+        }
+
+        newArr[index] = map->arr[i];
+
+    }
+
+    free(map->arr);
+    map->arr = newArr;
+    map->length = newLength;
+    map->bPrime = newBPrime;
+
+}
@@ -4,17 +4,36 @@
 #include <limits.h>
 
 
+/// The maximum percentage of the hash set array that the presized hash set should fill, so the probe sequences stay short.
+#define HASH_SET_MAX_LOAD_PERCENT 75
+
+
 
 int hashSetCalBPrime(int length);
 
 int hashSetGetNextPrime(int num);
 
+int hashSetLengthForCapacity(int capacity);
+
+HashSet *hashSetInitializationWithLength(
+        int length,
+        void (*freeItem)(void *),
+        int (*itemComp)(const void *, const void *),
+        int (*hashFun)(const void *)
+        );
+
 unsigned int hashSetFHashCal(int (*hashFun)(const void *), void *key, unsigned int length);
 
 unsigned int hashSetSHashCal(int (*hashFun)(const void *), void *key, unsigned int bPrime);
 
 unsigned int hashSetCalIndex(unsigned int fHash, unsigned int sHash, unsigned int index, unsigned int length);
 
+void hashSetRehash(HashSet *hashSet, int newLength);
+
+int hashSetFindIndexWithHash(HashSet *hashSet, void *item, unsigned int hash);
+
+void hashSetPutWithHash(HashSet *hashSet, void *item, unsigned int hash);
+
 
 
 
@@ -35,68 +54,46 @@ HashSet *hashSetInitialization(
         int (*hashFun)(const void *)
         ) {
 
-    if (freeItem == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "hash set data structure");
-     		exit(INVALID_ARG);
-     	#endif
+    return hashSetInitializationWithLength(hashSetGetNextPrime(10), freeItem, itemComp, hashFun);
 
-    } else if (itemComp == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = INVALID_ARG;
-     		return NULL;
-        #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "comparator function pointer", "hash set data structure");
-     		exit(INVALID_ARG);
-     	#endif
+}
 
-    } else if (hashFun == NULL) {
+
+
+
+
+/** This function will take the initial capacity, the freeing item function, and the comparing items function as a parameters,
+ * then it will return a new hash set address that can hold the passed number of items without growing.
+ *
+ * Note: the hash set array will be bigger than the capacity so it's never filled over the maximum load percentage,
+ * and it's length will be rounded up to a prime number that is never smaller than the default length.
+ *
+ * @param capacity the number of items that the hash set should hold before it needs to grow
+ * @param freeItem the freeing item function address, that will be called to free the hash set items
+ * @param itemComp the comparing item function address, that will be called to compare two items.
+ * @param hashFun the hashing function that will return a unique integer representing the hash set item
+ * @return it will return a new hash set pointer
+ */
+
+HashSet *hashSetInitializationWithCapacity(
+        int capacity,
+        void (*freeItem)(void *),
+        int (*itemComp)(const void *, const void *),
+        int (*hashFun)(const void *)
+        ) {
+
+    if (capacity <= 0) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
             ERROR_TEST->errorCode = INVALID_ARG;
             return NULL;
         #else
-            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "hash set data structure");
+            fprintf(stderr, INVALID_ARG_MESSAGE, "initial capacity", "hash set data structure");
             exit(INVALID_ARG);
         #endif
-    }
-
-    HashSet *hashSet = (HashSet *) malloc(sizeof(HashSet));
-    if (hashSet == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
-     		return NULL;
-        #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash set", "hash set data structure");
-     		exit(FAILED_ALLOCATION);
-     	#endif
-
-    }
-
-    hashSet->length = hashSetGetNextPrime(10);
-    hashSet->arr = (void **) calloc(sizeof(void *), hashSet->length);
-    if (hashSet->arr == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
-     		return NULL;
-        #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash set array", "hash set data structure");
-     		exit(FAILED_ALLOCATION);
-     	#endif
 
     }
 
-    hashSet->count = 0;
-    hashSet->freeItem = freeItem;
-    hashSet->bPrime = hashSetCalBPrime(hashSet->length);
-
-    hashSet->itemComp = itemComp;
-    hashSet->freeItem = freeItem;
-    hashSet->hashFun = hashFun;
-
-    return hashSet;
+    return hashSetInitializationWithLength(hashSetLengthForCapacity(capacity), freeItem, itemComp, hashFun);
 
 }
 
@@ -488,200 +485,813 @@ void **hashSetToArray(HashSet *hashSet) {
 
 
 
-/** This function will take the hash set address as a parameter,
- * then it will return the number of items in the hash set.
+/** This function will take two hash sets addresses, and the freeing item function of the result set as a parameters,
+ * then it will return a new hash set that contains all the items in the two sets.
  *
- * @param hashSet the hash set address
- * @return it will return the number of items in the hash set
+ * Note: the items will not be copied, the new hash set will reference the same items addresses,
+ * so pass a freeing function that doesn't free the items if the two sets will free them.
+ *
+ * Note: the two sets should use the same comparator and hashing functions, and the new set will use them too.
+ *
+ * Note: every item will be hashed only one time, and the new set will be allocated with it's final capacity.
+ *
+ * @param firstSet the first hash set address
+ * @param secondSet the second hash set address
+ * @param freeItem the freeing item function address of the new hash set
+ * @return it will return the union hash set address
  */
 
-int hashSetGetLength(HashSet *hashSet) {
-
-    if (hashSet == NULL) {
+HashSet *hashSetUnion(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *)) {
+    if (firstSet == NULL || secondSet == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return -1;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "hash set data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    return hashSet->count;
+    HashSet *biggerSet = firstSet->count >= secondSet->count ? firstSet : secondSet;
+    HashSet *smallerSet = biggerSet == firstSet ? secondSet : firstSet;
 
-}
+    int capacity = firstSet->count + secondSet->count;
+    HashSet *unionSet = hashSetInitializationWithCapacity(capacity == 0 ? 1 : capacity, freeItem, firstSet->itemComp, firstSet->hashFun);
+    if (unionSet == NULL)
+        return NULL;
 
+    for (int i = 0; i < biggerSet->length; i++) {
+        if (biggerSet->arr[i] != NULL)
+            hashSetPutWithHash(unionSet, biggerSet->arr[i], (unsigned int) biggerSet->hashFun(biggerSet->arr[i]));
 
+    }
 
+    for (int i = 0; i < smallerSet->length; i++) {
+        void *item = smallerSet->arr[i];
+        if (item == NULL)
+            continue;
 
+        unsigned int hash = (unsigned int) smallerSet->hashFun(item);
+        if (hashSetFindIndexWithHash(biggerSet, item, hash) == -1)
+            hashSetPutWithHash(unionSet, item, hash);
 
+    }
 
+    return unionSet;
 
+}
 
-/** This function will take the hash set address as a parameter,
- * then it will return one (1) if the hash set is empty,
- * other wise it will return zero (0).
+
+
+
+/** This function will take two hash sets addresses, and the freeing item function of the result set as a parameters,
+ * then it will return a new hash set that contains the items that are in the two sets.
  *
- * @param hashSet the hash set address
- * @return it will return one if the hash set is empty, other wise it will return zero
+ * Note: the items will not be copied, the new hash set will reference the items addresses of the smaller set,
+ * so pass a freeing function that doesn't free the items if the two sets will free them.
+ *
+ * Note: the two sets should use the same comparator and hashing functions, and the new set will use them too.
+ *
+ * Note: the function will walk over the smaller set only, and it will hash every item only one time.
+ *
+ * @param firstSet the first hash set address
+ * @param secondSet the second hash set address
+ * @param freeItem the freeing item function address of the new hash set
+ * @return it will return the intersection hash set address
  */
 
-int hashSetIsEmpty(HashSet *hashSet) {
-
-    if (hashSet == NULL) {
+HashSet *hashSetIntersection(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *)) {
+    if (firstSet == NULL || secondSet == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return -1;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
-     		exit(NULL_POINTER);
-     	#endif
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "hash set data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    return hashSet->count == 0;
-}
+    HashSet *biggerSet = firstSet->count >= secondSet->count ? firstSet : secondSet;
+    HashSet *smallerSet = biggerSet == firstSet ? secondSet : firstSet;
 
+    HashSet *intersectionSet = hashSetInitializationWithCapacity(smallerSet->count == 0 ? 1 : smallerSet->count, freeItem, firstSet->itemComp, firstSet->hashFun);
+    if (intersectionSet == NULL)
+        return NULL;
 
+    for (int i = 0; i < smallerSet->length; i++) {
+        void *item = smallerSet->arr[i];
+        if (item == NULL)
+            continue;
 
+        unsigned int hash = (unsigned int) smallerSet->hashFun(item);
+        if (hashSetFindIndexWithHash(biggerSet, item, hash) != -1)
+            hashSetPutWithHash(intersectionSet, item, hash);
 
+    }
 
+    return intersectionSet;
 
+}
 
 
 
-/** This function will take the hash set address as a parameter,
- * then it will clear and free all the items in the hash set,
- * without destroying the hash set.
+
+/** This function will take two hash sets addresses, and the freeing item function of the result set as a parameters,
+ * then it will return a new hash set that contains the items that are in the first set and not in the second set.
  *
- * @param hashSet the hash set address
+ * Note: the items will not be copied, the new hash set will reference the same items addresses,
+ * so pass a freeing function that doesn't free the items if the first set will free them.
+ *
+ * Note: the two sets should use the same comparator and hashing functions, and the new set will use them too.
+ *
+ * @param firstSet the first hash set address
+ * @param secondSet the second hash set address
+ * @param freeItem the freeing item function address of the new hash set
+ * @return it will return the difference hash set address
  */
 
-void clearHashSet(HashSet *hashSet) {
-
-    if (hashSet == NULL) {
+HashSet *hashSetDifference(HashSet *firstSet, HashSet *secondSet, void (*freeItem)(void *)) {
+    if (firstSet == NULL || secondSet == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = NULL_POINTER;
-     		return;
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
-     		exit(NULL_POINTER);
-     	#endif
-
-    }
+            exit(NULL_POINTER);
+        #endif
 
-    for (int i = 0; i < hashSet->length; i++) {
-        if (hashSet->arr[i] != NULL) {
-            hashSet->freeItem(hashSet->arr[i]);
-            hashSet->arr[i] = NULL;
-        }
+    } else if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "hash set data structure");
+            exit(INVALID_ARG);
+        #endif
 
     }
 
-    hashSet->count = 0;
+    HashSet *differenceSet = hashSetInitializationWithCapacity(firstSet->count == 0 ? 1 : firstSet->count, freeItem, firstSet->itemComp, firstSet->hashFun);
+    if (differenceSet == NULL)
+        return NULL;
 
-}
+    for (int i = 0; i < firstSet->length; i++) {
+        void *item = firstSet->arr[i];
+        if (item == NULL)
+            continue;
 
+        unsigned int hash = (unsigned int) firstSet->hashFun(item);
+        if (secondSet->count == 0 || hashSetFindIndexWithHash(secondSet, item, hash) == -1)
+            hashSetPutWithHash(differenceSet, item, hash);
 
+    }
 
+    return differenceSet;
 
+}
 
 
 
 
-/** This function will take the hash set address as a parameter,
- * then it will destroy and free the hash set and all it's items.
+/** This function will take two hash sets addresses as a parameters,
+ * then it will return one (1) if all the items in the first set are in the second set,
+ * other wise it will return zero (0).
  *
- * @param hashSet the hash set address
+ * @param firstSet the first hash set address
+ * @param secondSet the second hash set address
+ * @return it will return one if the first set is a subset of the second set, other wise it will return zero
  */
 
-void destroyHashSet(HashSet *hashSet) {
-
-    if (hashSet == NULL) {
+int hashSetIsSubset(HashSet *firstSet, HashSet *secondSet) {
+    if (firstSet == NULL || secondSet == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
             ERROR_TEST->errorCode = NULL_POINTER;
-            return;
+            return -1;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
-     		exit(NULL_POINTER);
+            exit(NULL_POINTER);
         #endif
 
     }
 
-    clearHashSet(hashSet);
-
-    free(hashSet->arr);
-    free(hashSet);
-
-}
+    if (firstSet->count > secondSet->count)
+        return 0;
 
+    for (int i = 0; i < firstSet->length; i++) {
+        void *item = firstSet->arr[i];
+        if (item != NULL && hashSetFindIndexWithHash(secondSet, item, (unsigned int) firstSet->hashFun(item)) == -1)
+            return 0;
 
+    }
 
+    return 1;
 
+}
 
 
 
 
-/** This function will take the hash function pointer, the key pointer, and the hash set array length as a parameters,
- * then it will return the first hash of this key.
+/** This function will take two hash sets addresses as a parameters,
+ * then it will insert all the items in the second set that are not in the first set into the first set.
  *
- * Note: this function should only be called from the hash set functions.
+ * Note: the items will not be copied, the two sets will reference the same added items,
+ * so only one of them should free these items.
  *
- * @param hashFun the hash function pointer
- * @param key the key pointer
- * @param length the length of the hash set array
- * @return it will return the first hashed key
+ * Note: the first set will grow only one time if it needs to.
+ *
+ * @param firstSet the first hash set address, that will hold the union
+ * @param secondSet the second hash set address
  */
 
-unsigned int hashSetFHashCal(int (*hashFun)(const void *), void *key, unsigned int length) {
-    return (hashFun(key) % length);
-}
+void hashSetUnionInPlace(HashSet *firstSet, HashSet *secondSet) {
+    if (firstSet == NULL || secondSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
 
+    }
 
+    hashSetReserve(firstSet, firstSet->count + secondSet->count);
 
+    for (int i = 0; i < secondSet->length; i++) {
+        void *item = secondSet->arr[i];
+        if (item == NULL)
+            continue;
 
+        unsigned int hash = (unsigned int) secondSet->hashFun(item);
+        if (hashSetFindIndexWithHash(firstSet, item, hash) == -1)
+            hashSetPutWithHash(firstSet, item, hash);
 
+    }
 
+}
 
 
-/** This function will take the hash function pointer, the key address, and the biggest prime number,
- * that smaller than the set array length as a parameters, then it will return the second hash of this key.
+
+
+/** This function will take two hash sets addresses as a parameters,
+ * then it will delete and free all the items in the first set that are not in the second set.
  *
- * Note: this function should only be called from the hash set functions.
+ * Note: the function will only search the items of the smaller set,
+ * but it will still walk over the first set array to free the deleted items.
  *
- * @param hashFun the hash function pointer
- * @param key the key pointer
- * @param bPrime the biggest prime number, that smaller than the set array length
- * @return it will return the second hashed key
+ * @param firstSet the first hash set address, that will hold the intersection
+ * @param secondSet the second hash set address
  */
 
-unsigned int hashSetSHashCal(int (*hashFun)(const void *), void *key, unsigned int bPrime) {
-    return (bPrime - (hashFun(key) % bPrime));
-}
+void hashSetIntersectionInPlace(HashSet *firstSet, HashSet *secondSet) {
+    if (firstSet == NULL || secondSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
 
+    }
 
+    // if the second set is smaller, its items are searched in the first set and the found places are marked to be kept.
+    char *keep = NULL;
+    if (secondSet->count > 0 && secondSet->count < firstSet->count) {
+        keep = (char *) calloc(firstSet->length, sizeof(char));
 
+        for (int i = 0; keep != NULL && i < secondSet->length; i++) {
+            void *item = secondSet->arr[i];
+            if (item == NULL)
+                continue;
 
+            int index = hashSetFindIndexWithHash(firstSet, item, (unsigned int) secondSet->hashFun(item));
+            if (index != -1)
+                keep[index] = 1;
 
+        }
 
+    }
 
+    // if the marking array couldn't be allocated, the first set items will be searched in the second set instead.
+    for (int i = 0; i < firstSet->length; i++) {
+        void *item = firstSet->arr[i];
+        if (item == NULL)
+            continue;
 
-/** This function will take the first hash of the key, the second hash of the key, the index, and the length of the hash set array
- * as a parameters, then it will return the next index that should be available.
- *
- * Note: this function should only be called from the hash set functions.
- *
- * @param fHash the first hashed key
- * @param sHash the second hashed key
- * @param index the current index that wasn't empty
- * @param length the length if the hash set array
- * @return it will return the new index that should be empty
- */
+        int found = keep != NULL
+                ? keep[i]
+                : secondSet->count > 0 && hashSetFindIndexWithHash(secondSet, item, (unsigned int) firstSet->hashFun(item)) != -1;
 
-unsigned int hashSetCalIndex(unsigned int fHash, unsigned int sHash, unsigned int index, unsigned int length) {
-    return ((fHash + (index * sHash))  % length);
-}
+        if (!found) {
+            firstSet->freeItem(item);
+            firstSet->arr[i] = NULL;
+            firstSet->count--;
+        }
+
+    }
+
+    free(keep);
+
+}
+
+
+
+
+/** This function will take two hash sets addresses as a parameters,
+ * then it will delete and free all the items in the first set that are in the second set.
+ *
+ * Note: the function will walk over the smaller set.
+ *
+ * @param firstSet the first hash set address, that will hold the difference
+ * @param secondSet the second hash set address
+ */
+
+void hashSetDifferenceInPlace(HashSet *firstSet, HashSet *secondSet) {
+    if (firstSet == NULL || secondSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    if (secondSet->count < firstSet->count) {
+
+        for (int i = 0; i < secondSet->length && firstSet->count > 0; i++) {
+            void *item = secondSet->arr[i];
+            if (item == NULL)
+                continue;
+
+            int index = hashSetFindIndexWithHash(firstSet, item, (unsigned int) secondSet->hashFun(item));
+            if (index != -1) {
+                firstSet->freeItem(firstSet->arr[index]);
+                firstSet->arr[index] = NULL;
+                firstSet->count--;
+            }
+
+        }
+
+    } else if (secondSet->count > 0) {
+
+        for (int i = 0; i < firstSet->length; i++) {
+            void *item = firstSet->arr[i];
+            if (item != NULL && hashSetFindIndexWithHash(secondSet, item, (unsigned int) firstSet->hashFun(item)) != -1) {
+                firstSet->freeItem(item);
+                firstSet->arr[i] = NULL;
+                firstSet->count--;
+            }
+
+        }
+
+    }
+
+}
+
+
+
+
+/** This function will take the hash set address, and the capacity as a parameters,
+ * then it will grow the hash set array so it can hold the passed number of items without growing again.
+ *
+ * Note: this function is useful before inserting a lot of items, because the hash set will grow only once.
+ *
+ * Note: if the hash set can already hold the passed capacity, then the function will do nothing.
+ *
+ * @param hashSet the hash set address
+ * @param capacity the number of items that the hash set should be able to hold
+ */
+
+void hashSetReserve(HashSet *hashSet, int capacity) {
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (capacity < 0) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "capacity", "hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+
+    }
+
+    int newLength = hashSetLengthForCapacity(capacity);
+    if (newLength <= hashSet->length)
+        return;
+
+    hashSetRehash(hashSet, newLength);
+
+}
+
+
+
+
+/** This function will take the hash set address as a parameter,
+ * then it will shrink the hash set array to the smallest prime length that holds the current items under the maximum load percentage.
+ *
+ * Note: this function is useful after deleting a lot of items, because the hash set array never shrinks by itself.
+ *
+ * Note: the hash set length will never be smaller than the default length.
+ *
+ * @param hashSet the hash set address
+ */
+
+void hashSetShrinkToFit(HashSet *hashSet) {
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    int newLength = hashSetLengthForCapacity(hashSet->count);
+    if (newLength >= hashSet->length)
+        return;
+
+    hashSetRehash(hashSet, newLength);
+
+}
+
+
+
+
+/** This function will take the hash set address as a parameter,
+ * then it will return the number of items in the hash set.
+ *
+ * @param hashSet the hash set address
+ * @return it will return the number of items in the hash set
+ */
+
+int hashSetGetLength(HashSet *hashSet) {
+
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    }
+
+    return hashSet->count;
+
+}
+
+
+
+
+
+
+
+
+/** This function will take the hash set address as a parameter,
+ * then it will return one (1) if the hash set is empty,
+ * other wise it will return zero (0).
+ *
+ * @param hashSet the hash set address
+ * @return it will return one if the hash set is empty, other wise it will return zero
+ */
+
+int hashSetIsEmpty(HashSet *hashSet) {
+
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return -1;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    }
+
+    return hashSet->count == 0;
+}
+
+
+
+
+
+
+
+
+
+/** This function will take the hash set address, and the iterator address as a parameters,
+ * then it will setup the iterator to walk over the hash set items.
+ *
+ * Note: the iterator will be positioned before the first item, so you need to call hashSetIteratorNext before reading the first item.
+ *
+ * Note: the iterator doesn't allocate any memory, so it can be declared on the stack.
+ *
+ * Note: inserting into the hash set while iterating over it will leave the iterator in undefined state,
+ * but deleting the current item with hashSetIteratorRemove is safe.
+ *
+ * @param hashSet the hash set address
+ * @param iterator the iterator address
+ */
+
+void hashSetIteratorBegin(HashSet *hashSet, HashSetIterator *iterator) {
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    iterator->hashSet = hashSet;
+    iterator->index = -1;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will move the iterator to the next item in the hash set.
+ *
+ * @param iterator the iterator address
+ * @return it will return one if the iterator moved to a new item, other wise it will return zero if there is no more items
+ */
+
+int hashSetIteratorNext(HashSetIterator *iterator) {
+    if (iterator == NULL || iterator->hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    HashSet *hashSet = iterator->hashSet;
+    while (++iterator->index < hashSet->length) {
+        if (hashSet->arr[iterator->index] != NULL)
+            return 1;
+
+    }
+
+    iterator->index = hashSet->length;
+    return 0;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will return the current item.
+ *
+ * Note: the function will return NULL if the iterator isn't positioned on an item.
+ *
+ * @param iterator the iterator address
+ * @return it will return the current item
+ */
+
+void *hashSetIteratorItem(HashSetIterator *iterator) {
+    if (iterator == NULL || iterator->hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    if (iterator->index < 0 || iterator->index >= iterator->hashSet->length)
+        return NULL;
+
+    return iterator->hashSet->arr[iterator->index];
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will delete and free the current item from the hash set.
+ *
+ * Note: after the deletion the iterator will still point to the deleted place,
+ * so the next call of hashSetIteratorNext will move it to the item after the deleted one.
+ *
+ * @param iterator the iterator address
+ */
+
+void hashSetIteratorRemove(HashSetIterator *iterator) {
+    if (iterator == NULL || iterator->hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator", "hash set data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator->index < 0 || iterator->index >= iterator->hashSet->length || iterator->hashSet->arr[iterator->index] == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "hash set data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    iterator->hashSet->freeItem(iterator->hashSet->arr[iterator->index]);
+    iterator->hashSet->arr[iterator->index] = NULL;
+    iterator->hashSet->count--;
+
+}
+
+
+
+
+
+/** This function will take the hash set address as a parameter,
+ * then it will clear and free all the items in the hash set,
+ * without destroying the hash set.
+ *
+ * @param hashSet the hash set address
+ */
+
+void clearHashSet(HashSet *hashSet) {
+
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = NULL_POINTER;
+     		return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+     		exit(NULL_POINTER);
+     	#endif
+
+    }
+
+    for (int i = 0; i < hashSet->length; i++) {
+        if (hashSet->arr[i] != NULL) {
+            hashSet->freeItem(hashSet->arr[i]);
+            hashSet->arr[i] = NULL;
+        }
+
+    }
+
+    hashSet->count = 0;
+
+}
+
+
+
+
+
+
+
+
+/** This function will take the hash set address as a parameter,
+ * then it will destroy and free the hash set and all it's items.
+ *
+ * @param hashSet the hash set address
+ */
+
+void destroyHashSet(HashSet *hashSet) {
+
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash set", "hash set data structure");
+     		exit(NULL_POINTER);
+        #endif
+
+    }
+
+    clearHashSet(hashSet);
+
+    free(hashSet->arr);
+    free(hashSet);
+
+}
+
+
+
+
+
+
+
+
+/** This function will take the hash function pointer, the key pointer, and the hash set array length as a parameters,
+ * then it will return the first hash of this key.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * @param hashFun the hash function pointer
+ * @param key the key pointer
+ * @param length the length of the hash set array
+ * @return it will return the first hashed key
+ */
+
+unsigned int hashSetFHashCal(int (*hashFun)(const void *), void *key, unsigned int length) {
+    return (hashFun(key) % length);
+}
+
+
+
+
+
+
+
+
+/** This function will take the hash function pointer, the key address, and the biggest prime number,
+ * that smaller than the set array length as a parameters, then it will return the second hash of this key.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * @param hashFun the hash function pointer
+ * @param key the key pointer
+ * @param bPrime the biggest prime number, that smaller than the set array length
+ * @return it will return the second hashed key
+ */
+
+unsigned int hashSetSHashCal(int (*hashFun)(const void *), void *key, unsigned int bPrime) {
+    return (bPrime - (hashFun(key) % bPrime));
+}
+
+
+
+
+
+
+
+
+/** This function will take the first hash of the key, the second hash of the key, the index, and the length of the hash set array
+ * as a parameters, then it will return the next index that should be available.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * @param fHash the first hashed key
+ * @param sHash the second hashed key
+ * @param index the current index that wasn't empty
+ * @param length the length if the hash set array
+ * @return it will return the new index that should be empty
+ */
+
+unsigned int hashSetCalIndex(unsigned int fHash, unsigned int sHash, unsigned int index, unsigned int length) {
+    return ((fHash + (index * sHash))  % length);
+}
 
 
 
@@ -744,3 +1354,245 @@ int hashSetGetNextPrime(int num) {
 
 }
 
+
+
+
+
+
+/** This function will take the hash set array length, the freeing item function, the comparing items function,
+ * and the hashing function as a parameters,
+ * then it will return a new hash set address that has the passed array length.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * Note: the length should be a prime number.
+ *
+ * @param length the hash set array length
+ * @param freeItem the freeing item function address, that will be called to free the hash set items
+ * @param itemComp the comparing item function address, that will be called to compare two items.
+ * @param hashFun the hashing function that will return a unique integer representing the hash set item
+ * @return it will return a new hash set pointer
+ */
+
+HashSet *hashSetInitializationWithLength(
+        int length,
+        void (*freeItem)(void *),
+        int (*itemComp)(const void *, const void *),
+        int (*hashFun)(const void *)
+        ) {
+
+    if (freeItem == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "free function pointer", "hash set data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (itemComp == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = INVALID_ARG;
+     		return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "comparator function pointer", "hash set data structure");
+     		exit(INVALID_ARG);
+     	#endif
+
+    } else if (hashFun == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = INVALID_ARG;
+            return NULL;
+        #else
+            fprintf(stderr, INVALID_ARG_MESSAGE, "hash function pointer", "hash set data structure");
+            exit(INVALID_ARG);
+        #endif
+    }
+
+    HashSet *hashSet = (HashSet *) malloc(sizeof(HashSet));
+    if (hashSet == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
+     		return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash set", "hash set data structure");
+     		exit(FAILED_ALLOCATION);
+     	#endif
+
+    }
+
+    hashSet->length = length;
+    hashSet->arr = (void **) calloc(sizeof(void *), hashSet->length);
+    if (hashSet->arr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
+     		return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash set array", "hash set data structure");
+     		exit(FAILED_ALLOCATION);
+     	#endif
+
+    }
+
+    hashSet->count = 0;
+    hashSet->freeItem = freeItem;
+    hashSet->bPrime = hashSetCalBPrime(hashSet->length);
+
+    hashSet->itemComp = itemComp;
+    hashSet->freeItem = freeItem;
+    hashSet->hashFun = hashFun;
+
+    return hashSet;
+
+}
+
+
+
+
+
+/** This function will take the number of items as a parameter,
+ * then it will return the prime hash set array length that holds them without passing the maximum load percentage.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * Note: the returned length will never be smaller than the default length.
+ *
+ * @param capacity the number of items that the hash set array should hold
+ * @return it will return the hash set array length
+ */
+
+int hashSetLengthForCapacity(int capacity) {
+    long long length = ((long long) capacity * 100 + HASH_SET_MAX_LOAD_PERCENT - 1) / HASH_SET_MAX_LOAD_PERCENT;
+    if (length > INT_MAX / 2)
+        length = INT_MAX / 2;
+
+    return hashSetGetNextPrime(length < 10 ? 10 : (int) length);
+
+}
+
+
+
+
+/** This function will take the hash set address, and the new length as a parameters,
+ * then it will allocate a new array with the new length and move all the items into it,
+ * using the new length to calculate their indices.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * Note: the new length should be a prime number that is bigger than or equal to the number of items.
+ *
+ * @param hashSet the hash set address
+ * @param newLength the new length of the hash set array
+ */
+
+void hashSetRehash(HashSet *hashSet, int newLength) {
+    void **newArr = (void **) calloc(sizeof(void *), newLength);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash set array", "hash set data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    int newBPrime = hashSetCalBPrime(newLength);
+
+    for (int i = 0; i < hashSet->length; i++) {
+        if (hashSet->arr[i] == NULL)
+            continue;
+
+        unsigned int fHash = hashSetFHashCal(hashSet->hashFun, hashSet->arr[i], newLength),
+        sHash = hashSetSHashCal(hashSet->hashFun, hashSet->arr[i], newBPrime);
+
+        unsigned int pHashIndex = 1;
+        unsigned int index = hashSetCalIndex(fHash, sHash, pHashIndex, newLength);
+
+        while (newArr[index] != NULL) {
+            pHashIndex++;
+            index = hashSetCalIndex(fHash, sHash, pHashIndex, newLength);
+        }
+
+        newArr[index] = hashSet->arr[i];
+
+    }
+
+    free(hashSet->arr);
+    hashSet->arr = newArr;
+    hashSet->length = newLength;
+    hashSet->bPrime = newBPrime;
+
+}
+
+
+
+
+
+
+/** This function will take the hash set address, the item address, and the item hash as a parameters,
+ * then it will return the index of the item in the hash set array,
+ * using the passed hash instead of calling the hashing function again.
+ *
+ * Note: this function should only be called from the hash set functions.
+ *
+ * @param hashSet the hash set address
+ * @param item the item address
+ * @param hash the value that the hashing function returned for the item
+ * @return it will return the item index if found, other wise it will return -1
+ */
+
+int hashSetFindIndexWithHash(HashSet *hashSet, void *item, unsigned int hash) {
+    unsigned int fHash = hash % hashSet->length,
+    sHash = hashSet->bPrime - hash % hashSet->bPrime;
+
+    unsigned int pHashIndex = 1;
+    unsigned int index = hashSetCalIndex(fHash, sHash, pHashIndex, hashSet->length);
+    unsigned int firstIndex = index;
+
+    do {
+
+        if (hashSet->arr[index] != NULL && hashSet->itemComp(item, hashSet->arr[index]) == 0)
+            return (int) index;
+
+        pHashIndex++;
+        index = hashSetCalIndex(fHash, sHash, pHashIndex, hashSet->length);
+
+    } while (firstIndex != index);
+
+    return -1;
+
+}
+
+
+
+
+
+/** This function will take the hash set address, the item address, and the item hash as a parameters,
+ * then it will put the item in the first empty place of it's probe sequence.
+ *
+ * Note: this function should only be called from the hash set functions,
+ * and only when the item isn't in the hash set and the hash set has an empty place.
+ *
+ * @param hashSet the hash set address
+ * @param item the item address
+ * @param hash the value that the hashing function returned for the item
+ */
+
+void hashSetPutWithHash(HashSet *hashSet, void *item, unsigned int hash) {
+    unsigned int fHash = hash % hashSet->length,
+    sHash = hashSet->bPrime - hash % hashSet->bPrime;
+
+    unsigned int pHashIndex = 1;
+    unsigned int index = hashSetCalIndex(fHash, sHash, pHashIndex, hashSet->length);
+
+    while (hashSet->arr[index] != NULL) {
+        pHashIndex++;
+        index = hashSetCalIndex(fHash, sHash, pHashIndex, hashSet->length);
+    }
+
+    hashSet->arr[index] = item;
+    hashSet->count++;
+
+}
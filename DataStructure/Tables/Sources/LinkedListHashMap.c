@@ -1,47 +1,43 @@
 #include "../Headers/LinkedListHashMap.h"
-#include "../../LinkedLists/Headers/DoublyLinkedList.h"
 #include "../../../System/Utils.h"
 #include "../../../Unit Test/CuTest/CuTest.h"
+#include <limits.h>
 
-unsigned int LLHashMapFHashCal(int (*hashFun)(const void *), void *key, unsigned int length);
 
+/// The number of nodes in the first slab, every next slab will double that number until it reaches the maximum.
+#define LL_HASH_MAP_FIRST_SLAB_LENGTH 16
 
+/// The maximum number of nodes in one slab.
+#define LL_HASH_MAP_MAX_SLAB_LENGTH 4096
 
-/** This function will take two entries pointers as it's parameters,
- * then it will return zero (0) if the key of the two entries are the same.
- *
- * Note: this function should only be called from the linked list hash map functions.
- *
- * This function will be useful to pass it to the linked list functions to know if the linked list contains the key or not.
- *
- * @param p1 the first entry address
- * @param p2 the second entry address
- * @return it will return zero if the two entries has the same key value, other wise it will return one
- */
 
-int entriesCompFun(const void *p1, const void *p2) {
-    Entry *entry1 = (Entry *) p1;
-    Entry *entry2 = (Entry *) p2;
 
-    return entry1->keyCompFun(entry1->key, entry2->key);
+/** @struct LLHashMapSlab
+*  @brief This structure implements a block of nodes that the linked list hashmap allocates at once.
+*  @var LLHashMapSlab::next
+*  Member 'next' is a pointer to the previously allocated slab.
+*  @var LLHashMapSlab::nodes
+*  Member 'nodes' is the slab nodes array.
+*/
 
-}
+typedef struct LLHashMapSlab {
+    struct LLHashMapSlab *next;
+    LLHashMapNode nodes[];
+} LLHashMapSlab;
 
 
-/** The freeing entry function.
- *
- * @param entry the entry address.
- */
 
-void freeEntryFun(void *entry) {
-    Entry *entryToFree = (Entry *) entry;
-    entryToFree->freeItemFun(entryToFree->item);
-    entryToFree->freeKeyFun(entryToFree->key);
-    free(entryToFree);
+unsigned int llHashMapHashCal(int (*hashFun)(const void *), void *key);
 
-}
+LLHashMapNode **llHashMapFindLink(LinkedListHashMap *map, void *key, unsigned int hash);
+
+LLHashMapNode *llHashMapAllocateNode(LinkedListHashMap *map);
 
+void llHashMapReleaseNode(LinkedListHashMap *map, LLHashMapNode *node);
 
+void llHashMapGrow(LinkedListHashMap *map);
+
+void llHashMapFreeSlabs(LinkedListHashMap *map);
 
 
 
@@ -51,6 +47,9 @@ void freeEntryFun(void *entry) {
  * then it will allocate a new linked list hash map in the memory,
  * then the function will return the hash map address.
  *
+ * Note: the passed length is only the initial number of chains, the map will double it when the entries count exceeds
+ * three quarters of the chains number.
+ *
  * @param mapLength the hash map length
  * @param freeFun the free function address, that will be called to free the hash map items
  * @param keyComp the key comparator function address, that will be called to compare two keys
@@ -102,7 +101,7 @@ LinkedListHashMap *linkedListHashMapInitialization(
      		exit(INVALID_ARG);
      	#endif
 
-    } else if (keyComp == NULL) {
+    } else if (hashFun == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
             ERROR_TEST->errorCode = INVALID_ARG;
             return NULL;
@@ -126,19 +125,22 @@ LinkedListHashMap *linkedListHashMapInitialization(
 
 
     hashMap->length = mapLength;
-    hashMap->arr = (DoublyLinkedList **) calloc(sizeof(DoublyLinkedList *), hashMap->length);
+    hashMap->arr = (LLHashMapNode **) calloc(sizeof(LLHashMapNode *), hashMap->length);
     if (hashMap->arr == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
      		return NULL;
         #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map linked lists array", "linked list hash map data structure");
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map chains array", "linked list hash map data structure");
      		exit(FAILED_ALLOCATION);
      	#endif
 
     }
 
     hashMap->count = 0;
+    hashMap->freeNodes = NULL;
+    hashMap->slabs = NULL;
+    hashMap->slabLength = 0;
     hashMap->freeKeyFun = freeKey;
     hashMap->freeItemFun = freeItem;
     hashMap->keyCompFun = keyComp;
@@ -155,6 +157,8 @@ LinkedListHashMap *linkedListHashMapInitialization(
 /** This function will take the hash map address, the key address, and the item address as a parameters,
  * then it will add the item and it's key in the hash map.
  *
+ * Note: if the key is already in the hash map then the function will free the old key and item, and replace them with the new ones.
+ *
  * @param map the hash map address
  * @param key the key address
  * @param item the new item address
@@ -190,35 +194,37 @@ void lLHashMapInsert(LinkedListHashMap *map, void *key, void *item) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
-        map->arr[index] = doublyLinkedListInitialization(freeEntryFun, entriesCompFun);
-
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    if (entry == NULL) {
-        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
-     		return;
-        #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "new entry", "linked list hash map data structure");
-     		exit(FAILED_ALLOCATION);
-     	#endif
+    unsigned int hash = llHashMapHashCal(map->hashFun, key);
+    LLHashMapNode **link = llHashMapFindLink(map, key, hash);
 
+    if (link != NULL) {
+        LLHashMapNode *oldNode = *link;
+        map->freeItemFun(oldNode->entry.item);
+        map->freeKeyFun(oldNode->entry.key);
+        oldNode->entry.key = key;
+        oldNode->entry.item = item;
+        return;
     }
 
-    entry->key = key;
-    entry->item = item;
-    entry->freeItemFun = map->freeItemFun;
-    entry->freeKeyFun = map->freeKeyFun;
-    entry->keyCompFun = map->keyCompFun;
+    LLHashMapNode *newNode = llHashMapAllocateNode(map);
+    if (newNode == NULL)
+        return;
 
-    int entryIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    if (entryIndex != -1)
-        doublyLinkedListDeleteAtIndex(map->arr[index], entryIndex);
+    newNode->entry.key = key;
+    newNode->entry.item = item;
+    newNode->entry.freeItemFun = map->freeItemFun;
+    newNode->entry.freeKeyFun = map->freeKeyFun;
+    newNode->entry.keyCompFun = map->keyCompFun;
+    newNode->hash = hash;
 
-    doublyLinkedListAddLast(map->arr[index], entry);
+    unsigned int index = hash % map->length;
+    newNode->next = map->arr[index];
+    map->arr[index] = newNode;
     map->count++;
 
+    if ((long) map->count * 4 > (long) map->length * 3)
+        llHashMapGrow(map);
+
 }
 
 
@@ -257,17 +263,7 @@ int lLHashMapContains(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
-        return 0;
-
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
-
-    int boolean = doublyLinkedListContains(map->arr[index], entry);
-    free(entry);
-    return boolean;
+    return llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key)) != NULL;
 
 }
 
@@ -308,22 +304,11 @@ void *lLHashMapGet(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
-        return 0;
-
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
-
-    int itemIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    free(entry);
-    if (itemIndex == -1)
+    LLHashMapNode **link = llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key));
+    if (link == NULL)
         return NULL;
 
-    void *item = ((Entry *) doublyLinkedListGet(map->arr[index], itemIndex))->item;
-
-    return item;
+    return (*link)->entry.item;
 
 }
 
@@ -362,22 +347,11 @@ void *lLHashMapGetKey(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
-        return 0;
-
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
-
-    int itemIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    free(entry);
-    if (itemIndex == -1)
+    LLHashMapNode **link = llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key));
+    if (link == NULL)
         return NULL;
 
-    void *returnKey = ((Entry *) doublyLinkedListGet(map->arr[index], itemIndex))->key;
-
-    return returnKey;
+    return (*link)->entry.key;
 
 }
 
@@ -415,20 +389,16 @@ void lLHashMapDelete(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
+    LLHashMapNode **link = llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key));
+    if (link == NULL)
         return;
 
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
-
-    int itemIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    free(entry);
-    if (itemIndex == -1)
-        return;
+    LLHashMapNode *deletedNode = *link;
+    *link = deletedNode->next;
+    map->freeItemFun(deletedNode->entry.item);
+    map->freeKeyFun(deletedNode->entry.key);
+    llHashMapReleaseNode(map, deletedNode);
 
-    doublyLinkedListDeleteAtIndex(map->arr[index], itemIndex);
     map->count--;
 
 }
@@ -470,23 +440,15 @@ void *lLHashMapDeleteWtoFr(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
+    LLHashMapNode **link = llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key));
+    if (link == NULL)
         return NULL;
 
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
-
-    int itemIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    free(entry);
-    if (itemIndex == -1)
-        return NULL;
-
-    Entry *deletedEntry = doublyLinkedListDeleteAtIndexWtoFr(map->arr[index], itemIndex);
-    map->freeKeyFun(deletedEntry->key);
-    void *returnItem = deletedEntry->item;
-    free(deletedEntry);
+    LLHashMapNode *deletedNode = *link;
+    *link = deletedNode->next;
+    map->freeKeyFun(deletedNode->entry.key);
+    void *returnItem = deletedNode->entry.item;
+    llHashMapReleaseNode(map, deletedNode);
 
     map->count--;
 
@@ -505,6 +467,8 @@ void *lLHashMapDeleteWtoFr(LinkedListHashMap *map, void *key) {
  *
  * Note: this function will not free the passed key after it's done.
  *
+ * Note: the returned entry is a new allocated entry, so it should be freed after using it.
+ *
  * @param map the hash map address
  * @param key the key address
  * @return it will return the deleted entry pointer if found, other wise it will return NULL
@@ -531,20 +495,26 @@ Entry *lLHashMapDeleteWtoFrAll(LinkedListHashMap *map, void *key) {
 
     }
 
-    unsigned int index = LLHashMapFHashCal(map->hashFun, key, map->length);
-    if (map->arr[index] == NULL)
+    LLHashMapNode **link = llHashMapFindLink(map, key, llHashMapHashCal(map->hashFun, key));
+    if (link == NULL)
         return NULL;
 
-    Entry *entry = (Entry *) malloc(sizeof(Entry));
-    entry->key = key;
-    entry->keyCompFun = map->keyCompFun;
+    Entry *deletedEntry = (Entry *) malloc(sizeof(Entry));
+    if (deletedEntry == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+     		ERROR_TEST->errorCode = FAILED_ALLOCATION;
+     		return NULL;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "deleted entry", "linked list hash map data structure");
+     		exit(FAILED_ALLOCATION);
+     	#endif
 
-    int itemIndex = doublyLinkedListGetIndex(map->arr[index], entry);
-    free(entry);
-    if (itemIndex == -1)
-        return NULL;
+    }
 
-    Entry *deletedEntry = doublyLinkedListDeleteAtIndexWtoFr(map->arr[index], itemIndex);
+    LLHashMapNode *deletedNode = *link;
+    *link = deletedNode->next;
+    *deletedEntry = deletedNode->entry;
+    llHashMapReleaseNode(map, deletedNode);
 
     map->count--;
 
@@ -568,7 +538,7 @@ Entry *lLHashMapDeleteWtoFrAll(LinkedListHashMap *map, void *key) {
 void **lLHashMapToArray(LinkedListHashMap *map) {
     if (map == NULL) {
         #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
-            ERROR_TEST->errorCode = NULL_POINTER;
+     		ERROR_TEST->errorCode = NULL_POINTER;
      		return NULL;
         #else
             fprintf(stderr, NULL_POINTER_MESSAGE, "hash map pointer", "linked list hash map data structure");
@@ -592,13 +562,8 @@ void **lLHashMapToArray(LinkedListHashMap *map) {
     int index = 0;
 
     for (int i = 0; i < map->length; i++) {
-        if (map->arr[i] != NULL) {
-            for (int j = 0; j < doublyLinkedListGetLength(map->arr[i]); j++) {
-                Entry *entry = (Entry *) doublyLinkedListGet(map->arr[i], j);
-                arr[index++] = entry->item;
-            }
-
-        }
+        for (LLHashMapNode *node = map->arr[i]; node != NULL; node = node->next)
+            arr[index++] = node->entry.item;
 
     }
 
@@ -615,6 +580,8 @@ void **lLHashMapToArray(LinkedListHashMap *map) {
  *
  * Note: the returned Entries will not be a really copy of the keys and items, it will reference to the same addresses.
  *
+ * Note: the returned entries are owned by the hash map, so only the returned array should be freed.
+ *
  * @param map the hash map address
  * @return it will return a double Entry pointer array that contains a copy of all the entries in the hash map
  */
@@ -637,7 +604,7 @@ Entry **lLHashMapToEntryArray(LinkedListHashMap *map) {
      		ERROR_TEST->errorCode = FAILED_ALLOCATION;
      		return NULL;
         #else
-            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "to entries array", "linked list hash map data structure");
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "to array", "linked list hash map data structure");
      		exit(FAILED_ALLOCATION);
      	#endif
 
@@ -646,11 +613,8 @@ Entry **lLHashMapToEntryArray(LinkedListHashMap *map) {
     int index = 0;
 
     for (int i = 0; i < map->length; i++) {
-        if (map->arr[i] != NULL) {
-            for (int j = 0; j < doublyLinkedListGetLength(map->arr[i]); j++)
-                arr[index++] = doublyLinkedListGet(map->arr[i], j);
-
-        }
+        for (LLHashMapNode *node = map->arr[i]; node != NULL; node = node->next)
+            arr[index++] = &node->entry;
 
     }
 
@@ -716,6 +680,207 @@ int lLHashMapIsEmpty(LinkedListHashMap *map) {
 
 
 
+/** This function will take the hash map address, and the iterator address as a parameters,
+ * then it will setup the iterator to walk over the hash map entries.
+ *
+ * Note: the iterator will be positioned before the first entry, so you need to call lLHashMapIteratorNext before reading the first entry.
+ *
+ * Note: the iterator doesn't allocate any memory, so it can be declared on the stack.
+ *
+ * Note: inserting into the hash map while iterating over it will leave the iterator in undefined state,
+ * but deleting the current entry with lLHashMapIteratorRemove is safe.
+ *
+ * @param map the hash map address
+ * @param iterator the iterator address
+ */
+
+void lLHashMapIteratorBegin(LinkedListHashMap *map, LLHashMapIterator *iterator) {
+    if (map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "hash map pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    iterator->map = map;
+    iterator->bucketIndex = 0;
+    iterator->prevNode = NULL;
+    iterator->node = NULL;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will move the iterator to the next entry in the hash map.
+ *
+ * @param iterator the iterator address
+ * @return it will return one if the iterator moved to a new entry, other wise it will return zero if there is no more entries
+ */
+
+int lLHashMapIteratorNext(LLHashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return 0;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    LinkedListHashMap *map = iterator->map;
+    if (iterator->bucketIndex >= map->length)
+        return 0;
+
+    // if the current node was removed, then the next node is the one after the previous node.
+    if (iterator->node != NULL)
+        iterator->prevNode = iterator->node;
+
+    LLHashMapNode *nextNode = iterator->prevNode != NULL ? iterator->prevNode->next : map->arr[iterator->bucketIndex];
+
+    while (nextNode == NULL) {
+        iterator->bucketIndex++;
+        iterator->prevNode = NULL;
+
+        if (iterator->bucketIndex >= map->length) {
+            iterator->node = NULL;
+            return 0;
+        }
+
+        nextNode = map->arr[iterator->bucketIndex];
+
+    }
+
+    iterator->node = nextNode;
+    return 1;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will return the key of the current entry.
+ *
+ * Note: the function will return NULL if the iterator isn't positioned on an entry.
+ *
+ * @param iterator the iterator address
+ * @return it will return the current entry key
+ */
+
+void *lLHashMapIteratorKey(LLHashMapIterator *iterator) {
+    if (iterator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return iterator->node == NULL ? NULL : iterator->node->entry.key;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will return the item of the current entry.
+ *
+ * Note: the function will return NULL if the iterator isn't positioned on an entry.
+ *
+ * @param iterator the iterator address
+ * @return it will return the current entry item
+ */
+
+void *lLHashMapIteratorValue(LLHashMapIterator *iterator) {
+    if (iterator == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return NULL;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    }
+
+    return iterator->node == NULL ? NULL : iterator->node->entry.item;
+
+}
+
+
+
+
+/** This function will take the iterator address as a parameter,
+ * then it will delete and free the current entry key and item from the hash map.
+ *
+ * Note: after the deletion the next call of lLHashMapIteratorNext will move the iterator to the entry after the deleted one.
+ *
+ * @param iterator the iterator address
+ */
+
+void lLHashMapIteratorRemove(LLHashMapIterator *iterator) {
+    if (iterator == NULL || iterator->map == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = NULL_POINTER;
+            return;
+        #else
+            fprintf(stderr, NULL_POINTER_MESSAGE, "iterator pointer", "linked list hash map data structure");
+            exit(NULL_POINTER);
+        #endif
+
+    } else if (iterator->node == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = OUT_OF_RANGE;
+            return;
+        #else
+            fprintf(stderr, OUT_OF_RANGE_MESSAGE, "linked list hash map data structure");
+            exit(OUT_OF_RANGE);
+        #endif
+
+    }
+
+    LinkedListHashMap *map = iterator->map;
+    LLHashMapNode *deletedNode = iterator->node;
+
+    if (iterator->prevNode == NULL)
+        map->arr[iterator->bucketIndex] = deletedNode->next;
+    else
+        iterator->prevNode->next = deletedNode->next;
+
+    map->freeItemFun(deletedNode->entry.item);
+    map->freeKeyFun(deletedNode->entry.key);
+    llHashMapReleaseNode(map, deletedNode);
+
+    map->count--;
+    iterator->node = NULL;
+
+}
+
+
+
+
+
 /** This function will take the hash map address as a parameter,
  * then it will clear and free all the hash map entries,
  * without destroying the hash map it self.
@@ -736,13 +901,16 @@ void clearLLHashMap(LinkedListHashMap *map) {
     }
 
     for (int i = 0; i < map->length; i++) {
-        if (map->arr[i] != NULL) {
-            destroyDoublyLinkedList(map->arr[i]);
-            map->arr[i] = NULL;
+        for (LLHashMapNode *node = map->arr[i]; node != NULL; node = node->next) {
+            map->freeItemFun(node->entry.item);
+            map->freeKeyFun(node->entry.key);
         }
 
+        map->arr[i] = NULL;
+
     }
 
+    llHashMapFreeSlabs(map);
     map->count = 0;
 
 }
@@ -782,17 +950,198 @@ void destroyLLHashMap(LinkedListHashMap *map) {
 
 
 
-/** This function will take the hash function pointer, the key pointer, and the hash map array length as a parameters,
- * then it will return the first hash of this key.
+/** This function will take the hash function pointer, and the key pointer as a parameters,
+ * then it will return the hash of this key, that will be cached in the key node.
  *
  * Note: this function should only be called from the hash map functions.
- * 
+ *
  * @param hashFun the hash function pointer
  * @param key the key pointer
- * @param length the length of the hash map array
- * @return it will return the first hashed key
+ * @return it will return the hashed key
+ */
+
+unsigned int llHashMapHashCal(int (*hashFun)(const void *), void *key) {
+    return (unsigned int) hashFun(key);
+}
+
+
+
+
+
+/** This function will take the hash map address, the key address, and the key hash as a parameters,
+ * then it will return the address of the link that points to the node with the provided key,
+ * so the caller can read the node or unlink it from it's chain.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * Note: the key comparator will only be called on the nodes that have the same cached hash.
+ *
+ * @param map the hash map address
+ * @param key the key address
+ * @param hash the key hash
+ * @return it will return the address of the link that points to the key node if found, other wise it will return NULL
  */
 
-unsigned int LLHashMapFHashCal(int (*hashFun)(const void *), void *key, unsigned int length) {
-    return (hashFun(key) % length);
-}
\ No newline at end of file
+LLHashMapNode **llHashMapFindLink(LinkedListHashMap *map, void *key, unsigned int hash) {
+    LLHashMapNode **link = &map->arr[hash % map->length];
+
+    while (*link != NULL) {
+        if ((*link)->hash == hash && map->keyCompFun(key, (*link)->entry.key) == 0)
+            return link;
+
+        link = &(*link)->next;
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** This function will take the hash map address as a parameter,
+ * then it will return a free node from the hash map free nodes list.
+ *
+ * Note: if there is no free nodes, then the function will allocate a new slab of nodes,
+ * and every new slab will be double the size of the previous one until it reaches the maximum slab length.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * @param map the hash map address
+ * @return it will return a free node address
+ */
+
+LLHashMapNode *llHashMapAllocateNode(LinkedListHashMap *map) {
+    if (map->freeNodes == NULL) {
+        int slabLength = map->slabLength == 0 ? LL_HASH_MAP_FIRST_SLAB_LENGTH : map->slabLength * 2;
+        if (slabLength > LL_HASH_MAP_MAX_SLAB_LENGTH)
+            slabLength = LL_HASH_MAP_MAX_SLAB_LENGTH;
+
+        LLHashMapSlab *slab = (LLHashMapSlab *) malloc(sizeof(LLHashMapSlab) + sizeof(LLHashMapNode) * slabLength);
+        if (slab == NULL) {
+            #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+                ERROR_TEST->errorCode = FAILED_ALLOCATION;
+                return NULL;
+            #else
+                fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "nodes slab", "linked list hash map data structure");
+                exit(FAILED_ALLOCATION);
+            #endif
+
+        }
+
+        for (int i = 0; i < slabLength - 1; i++)
+            slab->nodes[i].next = &slab->nodes[i + 1];
+
+        slab->nodes[slabLength - 1].next = NULL;
+
+        slab->next = map->slabs;
+        map->slabs = slab;
+        map->slabLength = slabLength;
+        map->freeNodes = slab->nodes;
+
+    }
+
+    LLHashMapNode *node = map->freeNodes;
+    map->freeNodes = node->next;
+
+    return node;
+
+}
+
+
+
+
+
+/** This function will take the hash map address, and the node address as a parameters,
+ * then it will push the node into the hash map free nodes list, so it can be used by the next insertion.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * @param map the hash map address
+ * @param node the node address
+ */
+
+void llHashMapReleaseNode(LinkedListHashMap *map, LLHashMapNode *node) {
+    node->next = map->freeNodes;
+    map->freeNodes = node;
+}
+
+
+
+
+
+/** This function will take the hash map address as a parameter,
+ * then it will double the number of the hash map chains, and move every node into it's new chain,
+ * using the cached node hash without calling the hash function.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * @param map the hash map address
+ */
+
+void llHashMapGrow(LinkedListHashMap *map) {
+    if (map->length > INT_MAX / 2)
+        return;
+
+    int newLength = map->length * 2;
+    LLHashMapNode **newArr = (LLHashMapNode **) calloc(sizeof(LLHashMapNode *), newLength);
+    if (newArr == NULL) {
+        #ifdef C_DATASTRUCTURES_ERRORSTESTSTRUCT_H
+            ERROR_TEST->errorCode = FAILED_ALLOCATION;
+            return;
+        #else
+            fprintf(stderr, FAILED_ALLOCATION_MESSAGE, "hash map chains array", "linked list hash map data structure");
+            exit(FAILED_ALLOCATION);
+        #endif
+
+    }
+
+    for (int i = 0; i < map->length; i++) {
+        LLHashMapNode *node = map->arr[i];
+
+        while (node != NULL) {
+            LLHashMapNode *nextNode = node->next;
+            unsigned int index = node->hash % newLength;
+            node->next = newArr[index];
+            newArr[index] = node;
+            node = nextNode;
+        }
+
+    }
+
+    free(map->arr);
+    map->arr = newArr;
+    map->length = newLength;
+
+}
+
+
+
+
+
+/** This function will take the hash map address as a parameter,
+ * then it will free all the hash map nodes slabs, and empty the free nodes list.
+ *
+ * Note: this function will not free the keys and the items in the nodes.
+ *
+ * Note: this function should only be called from the hash map functions.
+ *
+ * @param map the hash map address
+ */
+
+void llHashMapFreeSlabs(LinkedListHashMap *map) {
+    LLHashMapSlab *slab = map->slabs;
+
+    while (slab != NULL) {
+        LLHashMapSlab *nextSlab = slab->next;
+        free(slab);
+        slab = nextSlab;
+    }
+
+    map->slabs = NULL;
+    map->slabLength = 0;
+    map->freeNodes = NULL;
+
+}
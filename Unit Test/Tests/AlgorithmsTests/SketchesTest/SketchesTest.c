@@ -0,0 +1,364 @@
+#include "SketchesTest.h"
+#include "../../../CuTest/CuTest.h"
+#include "../../../../System/Utils.h"
+#include "../../../../Algorithms/Sketches/Headers/CountMinSketch.h"
+#include "../../../../Algorithms/Sketches/Headers/HyperLogLog.h"
+#include "../../../../Algorithms/Sketches/Headers/HeavyHitters.h"
+
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersSKT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunSKT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+void testInvalidCountMinSketchInitialization(CuTest *cuTest) {
+
+    countMinSketchInitialization(0, 0.01, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    countMinSketchInitialization(0.01, 1, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    countMinSketchInitialization(0.01, 0.01, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testCountMinSketchEstimate(CuTest *cuTest) {
+
+    CountMinSketch *sketch = countMinSketchInitialization(0.001, 0.01, intHashFunSKT);
+    CuAssertIntEquals(cuTest, 2719, sketch->width);
+    CuAssertIntEquals(cuTest, 5, sketch->depth);
+
+    // item i appears i % 100 + 1 times.
+    for (int i = 0; i < 10000; i++)
+        countMinSketchAdd(sketch, &i, i % 100 + 1);
+
+    uint64_t total = countMinSketchGetTotal(sketch);
+    CuAssertTrue(cuTest, total == 505000);
+
+    int badEstimates = 0;
+    for (int i = 0; i < 10000; i++) {
+        uint64_t estimate = countMinSketchEstimate(sketch, &i);
+        CuAssertTrue(cuTest, estimate >= (uint64_t) (i % 100 + 1));
+        if (estimate > (uint64_t) (i % 100 + 1) + total / 1000)
+            badEstimates++;
+
+    }
+
+    CuAssertTrue(cuTest, badEstimates <= 100);
+
+    clearCountMinSketch(sketch);
+    int item = 5;
+    CuAssertTrue(cuTest, countMinSketchEstimate(sketch, &item) == 0);
+    CuAssertTrue(cuTest, countMinSketchGetTotal(sketch) == 0);
+
+    destroyCountMinSketch(sketch);
+
+}
+
+
+void testCountMinSketchMerge(CuTest *cuTest) {
+
+    CountMinSketch *sketch = countMinSketchInitialization(0.01, 0.01, intHashFunSKT);
+    CountMinSketch *firstHalf = countMinSketchInitialization(0.01, 0.01, intHashFunSKT);
+    CountMinSketch *secondHalf = countMinSketchInitialization(0.01, 0.01, intHashFunSKT);
+
+    for (int i = 0; i < 2000; i++) {
+        countMinSketchAdd(sketch, &i, 1);
+        countMinSketchAdd(i < 1000 ? firstHalf : secondHalf, &i, 1);
+    }
+
+    countMinSketchMerge(firstHalf, secondHalf);
+    CuAssertTrue(cuTest, countMinSketchGetTotal(firstHalf) == 2000);
+    for (int i = 0; i < 2000; i++)
+        CuAssertTrue(cuTest, countMinSketchEstimate(firstHalf, &i) == countMinSketchEstimate(sketch, &i));
+
+    CountMinSketch *otherSize = countMinSketchInitialization(0.1, 0.01, intHashFunSKT);
+    ERROR_TEST->errorCode = -1;
+    countMinSketchMerge(sketch, otherSize);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyCountMinSketch(sketch);
+    destroyCountMinSketch(firstHalf);
+    destroyCountMinSketch(secondHalf);
+    destroyCountMinSketch(otherSize);
+
+}
+
+
+void testInvalidHyperLogLogInitialization(CuTest *cuTest) {
+
+    hyperLogLogInitialization(3, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hyperLogLogInitialization(19, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hyperLogLogInitialization(14, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testHyperLogLogEstimate(CuTest *cuTest) {
+
+    HyperLogLog *counter = hyperLogLogInitialization(14, intHashFunSKT);
+    CuAssertDblEquals(cuTest, 0, hyperLogLogEstimate(counter), 0);
+
+    for (int i = 0; i < 100; i++) {
+        hyperLogLogAdd(counter, &i);
+        hyperLogLogAdd(counter, &i);
+    }
+
+    CuAssertDblEquals(cuTest, 100, hyperLogLogEstimate(counter), 3);
+
+    for (int i = 0; i < 1000000; i++)
+        hyperLogLogAdd(counter, &i);
+
+    CuAssertDblEquals(cuTest, 1000000, hyperLogLogEstimate(counter), 1000000 * 0.04);
+
+    clearHyperLogLog(counter);
+    CuAssertDblEquals(cuTest, 0, hyperLogLogEstimate(counter), 0);
+
+    destroyHyperLogLog(counter);
+
+}
+
+
+void testHyperLogLogMerge(CuTest *cuTest) {
+
+    HyperLogLog *counter = hyperLogLogInitialization(12, intHashFunSKT);
+    HyperLogLog *firstHalf = hyperLogLogInitialization(12, intHashFunSKT);
+    HyperLogLog *secondHalf = hyperLogLogInitialization(12, intHashFunSKT);
+
+    // the two halves overlap, so the merge should count the union only.
+    for (int i = 0; i < 60000; i++)
+        hyperLogLogAdd(counter, &i);
+
+    for (int i = 0; i < 40000; i++)
+        hyperLogLogAdd(firstHalf, &i);
+
+    for (int i = 20000; i < 60000; i++)
+        hyperLogLogAdd(secondHalf, &i);
+
+    hyperLogLogMerge(firstHalf, secondHalf);
+    CuAssertDblEquals(cuTest, hyperLogLogEstimate(counter), hyperLogLogEstimate(firstHalf), 0);
+
+    HyperLogLog *otherPrecision = hyperLogLogInitialization(10, intHashFunSKT);
+    ERROR_TEST->errorCode = -1;
+    hyperLogLogMerge(counter, otherPrecision);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyHyperLogLog(counter);
+    destroyHyperLogLog(firstHalf);
+    destroyHyperLogLog(secondHalf);
+    destroyHyperLogLog(otherPrecision);
+
+}
+
+
+void testInvalidHeavyHittersInitialization(CuTest *cuTest) {
+
+    heavyHittersInitialization(0, sizeof(int), compareIntPointersSKT, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    heavyHittersInitialization(10, 0, compareIntPointersSKT, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    heavyHittersInitialization(10, sizeof(int), NULL, intHashFunSKT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    heavyHittersInitialization(10, sizeof(int), compareIntPointersSKT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testHeavyHittersTopItems(CuTest *cuTest) {
+
+    HeavyHitters *heavyHitters = heavyHittersInitialization(20, sizeof(int), compareIntPointersSKT, intHashFunSKT);
+
+    // items 0 to 4 take 50% of the stream, and the rest are spread over 5000 items.
+    for (int i = 0; i < 100000; i++) {
+        int item = i % 2 == 0 ? (i / 2) % 5 : 5 + (i * 7919) % 5000;
+        heavyHittersAdd(heavyHitters, &item, 1);
+    }
+
+    CuAssertTrue(cuTest, heavyHittersGetTotal(heavyHitters) == 100000);
+
+    int items[5];
+    uint64_t counts[5];
+    CuAssertIntEquals(cuTest, 5, heavyHittersGetTop(heavyHitters, items, counts, 5));
+
+    qsort(items, 5, sizeof(int), compareIntPointersSKT);
+    for (int i = 0; i < 5; i++) {
+        CuAssertIntEquals(cuTest, i, items[i]);
+        CuAssertTrue(cuTest, counts[i] >= 10000);
+        CuAssertTrue(cuTest, counts[i] <= 10000 + 100000 / 20);
+    }
+
+    int rareItem = 4000;
+    CuAssertTrue(cuTest, heavyHittersEstimate(heavyHitters, &rareItem) <= 100000 / 20);
+
+    clearHeavyHitters(heavyHitters);
+    CuAssertIntEquals(cuTest, 0, heavyHittersGetTop(heavyHitters, items, counts, 5));
+    CuAssertTrue(cuTest, heavyHittersEstimate(heavyHitters, &rareItem) == 0);
+
+    destroyHeavyHitters(heavyHitters);
+
+}
+
+
+void testHeavyHittersExactCounts(CuTest *cuTest) {
+
+    HeavyHitters *heavyHitters = heavyHittersInitialization(10, sizeof(int), compareIntPointersSKT, intHashFunSKT);
+
+    // with fewer distinct items than counters, the counts are exact.
+    for (int i = 0; i < 10; i++)
+        for (int j = 0; j <= i; j++)
+            heavyHittersAdd(heavyHitters, &i, 2);
+
+    int items[10];
+    uint64_t counts[10];
+    CuAssertIntEquals(cuTest, 10, heavyHittersGetTop(heavyHitters, items, counts, 20));
+
+    for (int i = 0; i < 10; i++) {
+        CuAssertIntEquals(cuTest, 9 - i, items[i]);
+        CuAssertTrue(cuTest, counts[i] == (uint64_t) (10 - i) * 2);
+        CuAssertTrue(cuTest, heavyHittersEstimate(heavyHitters, &items[i]) == counts[i]);
+    }
+
+    destroyHeavyHitters(heavyHitters);
+
+}
+
+
+void testHeavyHittersMerge(CuTest *cuTest) {
+
+    HeavyHitters *firstHalf = heavyHittersInitialization(20, sizeof(int), compareIntPointersSKT, intHashFunSKT);
+    HeavyHitters *secondHalf = heavyHittersInitialization(20, sizeof(int), compareIntPointersSKT, intHashFunSKT);
+
+    // the first half sees the heavy items 0 to 2, and the second half sees 1 to 3.
+    for (int i = 0; i < 50000; i++) {
+        int item = i % 2 == 0 ? (i / 2) % 3 : 10 + (i * 7919) % 3000;
+        heavyHittersAdd(firstHalf, &item, 1);
+
+        item = i % 2 == 0 ? 1 + (i / 2) % 3 : 10 + (i * 7907) % 3000;
+        heavyHittersAdd(secondHalf, &item, 1);
+    }
+
+    heavyHittersMerge(firstHalf, secondHalf);
+    CuAssertTrue(cuTest, heavyHittersGetTotal(firstHalf) == 100000);
+
+    int items[4];
+    uint64_t counts[4];
+    CuAssertIntEquals(cuTest, 4, heavyHittersGetTop(firstHalf, items, counts, 4));
+
+    // items 1 and 2 appeared about 16666 times, and items 0 and 3 about 8333 times.
+    CuAssertTrue(cuTest, (items[0] == 1 && items[1] == 2) || (items[0] == 2 && items[1] == 1));
+    CuAssertTrue(cuTest, (items[2] == 0 && items[3] == 3) || (items[2] == 3 && items[3] == 0));
+    CuAssertTrue(cuTest, counts[0] >= 16666 && counts[1] >= 16666);
+    CuAssertTrue(cuTest, counts[2] >= 8333 && counts[3] >= 8333);
+
+    for (int i = 0; i < 4; i++)
+        CuAssertTrue(cuTest, heavyHittersEstimate(firstHalf, &items[i]) == counts[i]);
+
+    HeavyHitters *otherSize = heavyHittersInitialization(20, sizeof(long long), compareIntPointersSKT, intHashFunSKT);
+    ERROR_TEST->errorCode = -1;
+    heavyHittersMerge(firstHalf, otherSize);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyHeavyHitters(firstHalf);
+    destroyHeavyHitters(secondHalf);
+    destroyHeavyHitters(otherSize);
+
+}
+
+
+void testDestroyNullSketches(CuTest *cuTest) {
+
+    destroyCountMinSketch(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    ERROR_TEST->errorCode = -1;
+    destroyHyperLogLog(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    ERROR_TEST->errorCode = -1;
+    destroyHeavyHitters(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createSketchesTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidCountMinSketchInitialization);
+    SUITE_ADD_TEST(suite, testCountMinSketchEstimate);
+    SUITE_ADD_TEST(suite, testCountMinSketchMerge);
+    SUITE_ADD_TEST(suite, testInvalidHyperLogLogInitialization);
+    SUITE_ADD_TEST(suite, testHyperLogLogEstimate);
+    SUITE_ADD_TEST(suite, testHyperLogLogMerge);
+    SUITE_ADD_TEST(suite, testInvalidHeavyHittersInitialization);
+    SUITE_ADD_TEST(suite, testHeavyHittersTopItems);
+    SUITE_ADD_TEST(suite, testHeavyHittersExactCounts);
+    SUITE_ADD_TEST(suite, testHeavyHittersMerge);
+    SUITE_ADD_TEST(suite, testDestroyNullSketches);
+
+    return suite;
+
+}
+
+
+
+void sketchesUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Sketches Test**\n");
+
+    CuSuite *suite = createSketchesTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,10 @@
+#ifndef C_DATASTRUCTURES_SKETCHESTEST_H
+#define C_DATASTRUCTURES_SKETCHESTEST_H
+
+
+#include "../../../ErrorsTestStruct.h"
+
+void sketchesUnitTest();
+
+
+#endif //C_DATASTRUCTURES_SKETCHESTEST_H
@@ -288,6 +288,46 @@ void testDLLDequeToArray(CuTest *cuTest) {
 
 
 
+void testDLLDequeCursor(CuTest *cuTest) {
+
+    DLDeque *dLDeque = dlDequeInitialization(free);
+
+    dLDequeCursorInitialization(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 5; i++)
+        dLDequeInsertRear(dLDeque, generateIntPointerDLLDT(i));
+
+    DoublyLinkedListCursor cursor;
+    dLDequeCursorInitialization(&cursor, dLDeque);
+
+    // walk the deque from the rear to the front.
+    doublyLinkedListCursorPrev(&cursor);
+    for (int i = 4; i >= 0; i--) {
+        doublyLinkedListCursorPrev(&cursor);
+        CuAssertIntEquals(cuTest, i, *(int *) doublyLinkedListCursorGet(&cursor));
+    }
+
+    doublyLinkedListCursorNext(&cursor);
+    doublyLinkedListCursorInsertBefore(&cursor, generateIntPointerDLLDT(10));
+    CuAssertIntEquals(cuTest, 6, dLDequeGetLength(dLDeque));
+    CuAssertIntEquals(cuTest, 0, *(int *) dLDequePeekFront(dLDeque));
+
+    int *item = (int *) dLDequeGetFront(dLDeque);
+    free(item);
+    item = (int *) dLDequeGetFront(dLDeque);
+    CuAssertIntEquals(cuTest, 10, *item);
+    free(item);
+
+    destroyDLDeque(dLDeque);
+
+}
+
+
+
+
+
+
 void testDLLDequeGetLength(CuTest *cuTest) {
 
     DLDeque *dLDeque = dlDequeInitialization(free);
@@ -521,6 +561,7 @@ CuSuite *createDoublyLinkedListDequeTestsSuite() {
     SUITE_ADD_TEST(suite, testDLLDequePeekFront);
     SUITE_ADD_TEST(suite, testDLLDequePeekRear);
     SUITE_ADD_TEST(suite, testDLLDequeToArray);
+    SUITE_ADD_TEST(suite, testDLLDequeCursor);
     SUITE_ADD_TEST(suite, testDLLDequeGetLength);
     SUITE_ADD_TEST(suite, testDLLDequeIsEmpty);
     SUITE_ADD_TEST(suite, testClearDLLDeque);
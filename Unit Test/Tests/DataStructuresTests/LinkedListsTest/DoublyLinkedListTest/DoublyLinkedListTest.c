@@ -620,6 +620,207 @@ void printDoublyLinkedListFunLLT(const void *item) {
     doublyLinkedListAddLast(printingDoublyLinkedList, generateIntPointerDLLT(*(int *)item));
 }
 
+/** This function will return the index of the passed address in the addresses array.
+ * @param items the addresses array
+ * @param item the address
+ * @return it will return the address index
+ */
+
+int doublyLinkedListGetIndexOfAddressDLLT(void **items, void *item) {
+    int index = 0;
+    while (items[index] != item)
+        index++;
+
+    return index;
+}
+
+
+
+
+void testDoublyLinkedListSort(CuTest *cuTest) {
+
+    DoublyLinkedList *linkedList = doublyLinkedListInitialization(free, compareIntPointersDLLT);
+
+    doublyLinkedListSort(linkedList, compareIntPointersDLLT);
+    CuAssertIntEquals(cuTest, 0, doublyLinkedListGetLength(linkedList));
+
+    doublyLinkedListSort(linkedList, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    doublyLinkedListAddLast(linkedList, generateIntPointerDLLT(1));
+    doublyLinkedListSort(linkedList, compareIntPointersDLLT);
+    CuAssertIntEquals(cuTest, 1, *(int *) doublyLinkedListGetLast(linkedList));
+    doublyLinkedListDeleteFirst(linkedList);
+
+    // every value is added ten times, so the sort stability can be checked by the items addresses.
+    void *items[200];
+    for (int i = 0; i < 200; i++) {
+        items[i] = generateIntPointerDLLT((i * 7) % 20);
+        doublyLinkedListAddLast(linkedList, items[i]);
+    }
+
+    doublyLinkedListSort(linkedList, compareIntPointersDLLT);
+
+    CuAssertIntEquals(cuTest, 200, doublyLinkedListGetLength(linkedList));
+    void *prevItem = NULL;
+    for (int i = 0; i < 200; i++) {
+        void *item = doublyLinkedListGet(linkedList, i);
+        CuAssertIntEquals(cuTest, i / 10, *(int *) item);
+
+        // the equal items keep the order that they were added in.
+        if (prevItem != NULL && *(int *) prevItem == *(int *) item)
+            CuAssertTrue(cuTest, doublyLinkedListGetIndexOfAddressDLLT(items, prevItem) < doublyLinkedListGetIndexOfAddressDLLT(items, item));
+
+        prevItem = item;
+    }
+
+    CuAssertIntEquals(cuTest, 19, *(int *) doublyLinkedListGetLast(linkedList));
+    doublyLinkedListAddLast(linkedList, generateIntPointerDLLT(20));
+    CuAssertIntEquals(cuTest, 20, *(int *) doublyLinkedListGet(linkedList, 200));
+    doublyLinkedListDeleteLast(linkedList);
+
+    // the previous links are fixed after sorting.
+    DoublyLinkedListCursor cursor;
+    doublyLinkedListCursorInitialization(&cursor, linkedList);
+    doublyLinkedListCursorPrev(&cursor);
+    for (int i = 199; i >= 0; i--) {
+        doublyLinkedListCursorPrev(&cursor);
+        CuAssertIntEquals(cuTest, i / 10, *(int *) doublyLinkedListCursorGet(&cursor));
+    }
+
+    destroyDoublyLinkedList(linkedList);
+
+}
+
+
+
+
+void testDoublyLinkedListNodePool(CuTest *cuTest) {
+
+    DoublyLinkedList *linkedList = doublyLinkedListInitialization(free, compareIntPointersDLLT);
+    CuAssertIntEquals(cuTest, 0, linkedList->sharedNodePool);
+
+    for (int i = 0; i < 100; i++)
+        doublyLinkedListAddLast(linkedList, generateIntPointerDLLT(i));
+
+    CuAssertIntEquals(cuTest, 100, nodePoolGetUsedCount(linkedList->nodePool));
+
+    // the deleted nodes are reused by the next additions.
+    doublyLinkedListDeleteFirst(linkedList);
+    void *freedNode = linkedList->nodePool->freeNodes;
+    CuAssertPtrNotNull(cuTest, freedNode);
+
+    doublyLinkedListAddFirst(linkedList, generateIntPointerDLLT(0));
+    CuAssertPtrEquals(cuTest, freedNode, linkedList->head);
+    CuAssertPtrEquals(cuTest, NULL, linkedList->nodePool->freeNodes);
+
+    // clearing the list releases the private pool slabs at once.
+    doublyLinkedListClear(linkedList);
+    CuAssertPtrEquals(cuTest, NULL, linkedList->nodePool->slabs);
+    CuAssertIntEquals(cuTest, 0, nodePoolGetUsedCount(linkedList->nodePool));
+
+    doublyLinkedListAddLast(linkedList, generateIntPointerDLLT(5));
+    CuAssertIntEquals(cuTest, 5, *(int *) doublyLinkedListGetFirst(linkedList));
+
+    destroyDoublyLinkedList(linkedList);
+
+    doublyLinkedListSharedPoolInitialization(free, compareIntPointersDLLT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    NodePool *pool = doublyLinkedListNodePoolInitialization();
+    DoublyLinkedList *firstList = doublyLinkedListSharedPoolInitialization(free, compareIntPointersDLLT, pool);
+    DoublyLinkedList *secondList = doublyLinkedListSharedPoolInitialization(free, compareIntPointersDLLT, pool);
+
+    for (int i = 0; i < 10; i++) {
+        doublyLinkedListAddLast(firstList, generateIntPointerDLLT(i));
+        doublyLinkedListAddLast(secondList, generateIntPointerDLLT(i * 10));
+    }
+
+    CuAssertIntEquals(cuTest, 20, nodePoolGetUsedCount(pool));
+
+    // clearing a list with a shared pool returns only it's nodes to the pool.
+    doublyLinkedListClear(firstList);
+    CuAssertIntEquals(cuTest, 10, nodePoolGetUsedCount(pool));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i * 10, *(int *) doublyLinkedListGet(secondList, i));
+
+    destroyDoublyLinkedList(firstList);
+    destroyDoublyLinkedList(secondList);
+    CuAssertIntEquals(cuTest, 0, nodePoolGetUsedCount(pool));
+
+    destroyNodePool(pool);
+
+}
+
+
+
+
+void testDoublyLinkedListCursor(CuTest *cuTest) {
+
+    DoublyLinkedList *linkedList = doublyLinkedListInitialization(free, compareIntPointersDLLT);
+
+    for (int i = 0; i < 10; i++)
+        doublyLinkedListAddLast(linkedList, generateIntPointerDLLT(i));
+
+    DoublyLinkedListCursor cursor;
+    doublyLinkedListCursorInitialization(&cursor, linkedList);
+
+    // walking backward from the first item passes by the end of the list, then it reaches the last item.
+    doublyLinkedListCursorPrev(&cursor);
+    CuAssertPtrEquals(cuTest, NULL, doublyLinkedListCursorGet(&cursor));
+
+    for (int i = 9; i >= 0; i--) {
+        doublyLinkedListCursorPrev(&cursor);
+        CuAssertIntEquals(cuTest, i, *(int *) doublyLinkedListCursorGet(&cursor));
+    }
+
+    // remove the odd items, and insert a copy multiplied by 10 before every even item.
+    for (int *item; (item = (int *) doublyLinkedListCursorGet(&cursor)) != NULL; ) {
+        if (*item % 2 == 1) {
+            doublyLinkedListCursorRemove(&cursor);
+            continue;
+        }
+
+        doublyLinkedListCursorInsertBefore(&cursor, generateIntPointerDLLT(*item * 10));
+        doublyLinkedListCursorNext(&cursor);
+    }
+
+    int expected[] = {0, 0, 20, 2, 40, 4, 60, 6, 80, 8};
+    CuAssertIntEquals(cuTest, 10, doublyLinkedListGetLength(linkedList));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) doublyLinkedListGet(linkedList, i));
+
+    // the previous links stay valid after the cursor changes.
+    doublyLinkedListCursorPrev(&cursor);
+    for (int i = 9; i >= 0; i--) {
+        CuAssertIntEquals(cuTest, expected[i], *(int *) doublyLinkedListCursorGet(&cursor));
+        doublyLinkedListCursorPrev(&cursor);
+    }
+
+    doublyLinkedListCursorRemove(&cursor);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    doublyLinkedListCursorInsertAfter(&cursor, generateIntPointerDLLT(-1));
+    doublyLinkedListCursorInsertBefore(&cursor, generateIntPointerDLLT(100));
+    CuAssertIntEquals(cuTest, -1, *(int *) doublyLinkedListGetFirst(linkedList));
+    CuAssertIntEquals(cuTest, 100, *(int *) doublyLinkedListGetLast(linkedList));
+
+    doublyLinkedListCursorPrev(&cursor);
+    int *removedItem = (int *) doublyLinkedListCursorRemoveWtoFr(&cursor);
+    CuAssertIntEquals(cuTest, 100, *removedItem);
+    CuAssertIntEquals(cuTest, 8, *(int *) doublyLinkedListGetLast(linkedList));
+    CuAssertPtrEquals(cuTest, NULL, doublyLinkedListCursorGet(&cursor));
+    free(removedItem);
+
+    CuAssertIntEquals(cuTest, 11, doublyLinkedListGetLength(linkedList));
+
+    destroyDoublyLinkedList(linkedList);
+
+}
+
+
+
+
 void testPrintDoublyLinkedList(CuTest *cuTest) {
     DoublyLinkedList *list = doublyLinkedListInitialization(free, compareIntPointersDLLT);
     printingDoublyLinkedList = doublyLinkedListInitialization(free, compareIntPointersDLLT);
@@ -862,6 +1063,9 @@ CuSuite *createDoublyLinkedListTestsSuite() {
     SUITE_ADD_TEST(suite, testDoublyLinkedListGetLength);
     SUITE_ADD_TEST(suite, testDoublyLinkedListToArray);
     SUITE_ADD_TEST(suite, testDoublyLinkedListIsEmpty);
+    SUITE_ADD_TEST(suite, testDoublyLinkedListNodePool);
+    SUITE_ADD_TEST(suite, testDoublyLinkedListSort);
+    SUITE_ADD_TEST(suite, testDoublyLinkedListCursor);
     SUITE_ADD_TEST(suite, testPrintDoublyLinkedList);
     SUITE_ADD_TEST(suite, testClearDoublyLinkedList);
     SUITE_ADD_TEST(suite, testDestroyDoublyLinkedList);
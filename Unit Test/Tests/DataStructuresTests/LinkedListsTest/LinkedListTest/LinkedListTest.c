@@ -615,6 +615,192 @@ void printLinkedListFunLLT(const void *item) {
     linkedListAddLast(printingLinkedList, generateIntPointerLLT(*(int *)item));
 }
 
+/** This function will return the index of the passed address in the addresses array.
+ * @param items the addresses array
+ * @param item the address
+ * @return it will return the address index
+ */
+
+int linkedListGetIndexOfAddressLLT(void **items, void *item) {
+    int index = 0;
+    while (items[index] != item)
+        index++;
+
+    return index;
+}
+
+
+
+
+void testLinkedListSort(CuTest *cuTest) {
+
+    LinkedList *linkedList = linkedListInitialization(free, compareIntPointersLLT);
+
+    linkedListSort(linkedList, compareIntPointersLLT);
+    CuAssertIntEquals(cuTest, 0, linkedListGetLength(linkedList));
+
+    linkedListSort(linkedList, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    linkedListAddLast(linkedList, generateIntPointerLLT(1));
+    linkedListSort(linkedList, compareIntPointersLLT);
+    CuAssertIntEquals(cuTest, 1, *(int *) linkedListGetLast(linkedList));
+    linkedListDeleteFirst(linkedList);
+
+    // every value is added ten times, so the sort stability can be checked by the items addresses.
+    void *items[200];
+    for (int i = 0; i < 200; i++) {
+        items[i] = generateIntPointerLLT((i * 7) % 20);
+        linkedListAddLast(linkedList, items[i]);
+    }
+
+    linkedListSort(linkedList, compareIntPointersLLT);
+
+    CuAssertIntEquals(cuTest, 200, linkedListGetLength(linkedList));
+    void *prevItem = NULL;
+    for (int i = 0; i < 200; i++) {
+        void *item = linkedListGet(linkedList, i);
+        CuAssertIntEquals(cuTest, i / 10, *(int *) item);
+
+        // the equal items keep the order that they were added in.
+        if (prevItem != NULL && *(int *) prevItem == *(int *) item)
+            CuAssertTrue(cuTest, linkedListGetIndexOfAddressLLT(items, prevItem) < linkedListGetIndexOfAddressLLT(items, item));
+
+        prevItem = item;
+    }
+
+    CuAssertIntEquals(cuTest, 19, *(int *) linkedListGetLast(linkedList));
+    linkedListAddLast(linkedList, generateIntPointerLLT(20));
+    CuAssertIntEquals(cuTest, 20, *(int *) linkedListGet(linkedList, 200));
+    linkedListDeleteLast(linkedList);
+
+    destroyLinkedList(linkedList);
+
+}
+
+
+
+
+void testLinkedListNodePool(CuTest *cuTest) {
+
+    LinkedList *linkedList = linkedListInitialization(free, compareIntPointersLLT);
+    CuAssertIntEquals(cuTest, 0, linkedList->sharedNodePool);
+
+    for (int i = 0; i < 100; i++)
+        linkedListAddLast(linkedList, generateIntPointerLLT(i));
+
+    CuAssertIntEquals(cuTest, 100, nodePoolGetUsedCount(linkedList->nodePool));
+
+    // the deleted nodes are reused by the next additions.
+    linkedListDeleteFirst(linkedList);
+    void *freedNode = linkedList->nodePool->freeNodes;
+    CuAssertPtrNotNull(cuTest, freedNode);
+
+    linkedListAddFirst(linkedList, generateIntPointerLLT(0));
+    CuAssertPtrEquals(cuTest, freedNode, linkedList->head);
+    CuAssertPtrEquals(cuTest, NULL, linkedList->nodePool->freeNodes);
+
+    // clearing the list releases the private pool slabs at once.
+    linkedListClear(linkedList);
+    CuAssertPtrEquals(cuTest, NULL, linkedList->nodePool->slabs);
+    CuAssertIntEquals(cuTest, 0, nodePoolGetUsedCount(linkedList->nodePool));
+
+    linkedListAddLast(linkedList, generateIntPointerLLT(5));
+    CuAssertIntEquals(cuTest, 5, *(int *) linkedListGetFirst(linkedList));
+
+    destroyLinkedList(linkedList);
+
+    linkedListSharedPoolInitialization(free, compareIntPointersLLT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    NodePool *pool = linkedListNodePoolInitialization();
+    LinkedList *firstList = linkedListSharedPoolInitialization(free, compareIntPointersLLT, pool);
+    LinkedList *secondList = linkedListSharedPoolInitialization(free, compareIntPointersLLT, pool);
+
+    for (int i = 0; i < 10; i++) {
+        linkedListAddLast(firstList, generateIntPointerLLT(i));
+        linkedListAddLast(secondList, generateIntPointerLLT(i * 10));
+    }
+
+    CuAssertIntEquals(cuTest, 20, nodePoolGetUsedCount(pool));
+
+    // clearing a list with a shared pool returns only it's nodes to the pool.
+    linkedListClear(firstList);
+    CuAssertIntEquals(cuTest, 10, nodePoolGetUsedCount(pool));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i * 10, *(int *) linkedListGet(secondList, i));
+
+    destroyLinkedList(firstList);
+    destroyLinkedList(secondList);
+    CuAssertIntEquals(cuTest, 0, nodePoolGetUsedCount(pool));
+
+    destroyNodePool(pool);
+
+}
+
+
+
+
+void testLinkedListCursor(CuTest *cuTest) {
+
+    LinkedList *linkedList = linkedListInitialization(free, compareIntPointersLLT);
+
+    for (int i = 0; i < 10; i++)
+        linkedListAddLast(linkedList, generateIntPointerLLT(i));
+
+    LinkedListCursor cursor;
+    linkedListCursorInitialization(&cursor, linkedList);
+
+    // remove the odd items, and insert a copy multiplied by 10 after every even item.
+    for (int *item; (item = (int *) linkedListCursorGet(&cursor)) != NULL; ) {
+        if (*item % 2 == 1) {
+            linkedListCursorRemove(&cursor);
+            continue;
+        }
+
+        linkedListCursorInsertAfter(&cursor, generateIntPointerLLT(*item * 10));
+        linkedListCursorNext(&cursor);
+        linkedListCursorNext(&cursor);
+    }
+
+    int expected[] = {0, 0, 2, 20, 4, 40, 6, 60, 8, 80};
+    CuAssertIntEquals(cuTest, 10, linkedListGetLength(linkedList));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) linkedListGet(linkedList, i));
+
+    CuAssertIntEquals(cuTest, 80, *(int *) linkedListGetLast(linkedList));
+
+    // the end of the list is between the last and the first items.
+    linkedListCursorRemove(&cursor);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    linkedListCursorInsertBefore(&cursor, generateIntPointerLLT(100));
+    linkedListCursorInsertAfter(&cursor, generateIntPointerLLT(-1));
+    CuAssertIntEquals(cuTest, 100, *(int *) linkedListGetLast(linkedList));
+    CuAssertIntEquals(cuTest, -1, *(int *) linkedListGetFirst(linkedList));
+
+    linkedListCursorNext(&cursor);
+    CuAssertIntEquals(cuTest, -1, *(int *) linkedListCursorGet(&cursor));
+
+    int *removedItem = (int *) linkedListCursorRemoveWtoFr(&cursor);
+    CuAssertIntEquals(cuTest, -1, *removedItem);
+    CuAssertIntEquals(cuTest, 0, *(int *) linkedListGetFirst(linkedList));
+    free(removedItem);
+
+    linkedListCursorInsertBefore(&cursor, generateIntPointerLLT(-2));
+    CuAssertIntEquals(cuTest, -2, *(int *) linkedListGetFirst(linkedList));
+    CuAssertIntEquals(cuTest, 12, linkedListGetLength(linkedList));
+
+    linkedListCursorInsertBefore(&cursor, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyLinkedList(linkedList);
+
+}
+
+
+
+
 void testPrintLinkedList(CuTest *cuTest) {
     LinkedList *list = linkedListInitialization(free, compareIntPointersLLT);
     printingLinkedList = linkedListInitialization(free, compareIntPointersLLT);
@@ -857,6 +1043,9 @@ CuSuite *createLinkedListTestsSuite() {
     SUITE_ADD_TEST(suite, testLinkedListGetLength);
     SUITE_ADD_TEST(suite, testLinkedListToArray);
     SUITE_ADD_TEST(suite, testLinkedListIsEmpty);
+    SUITE_ADD_TEST(suite, testLinkedListNodePool);
+    SUITE_ADD_TEST(suite, testLinkedListSort);
+    SUITE_ADD_TEST(suite, testLinkedListCursor);
     SUITE_ADD_TEST(suite, testPrintLinkedList);
     SUITE_ADD_TEST(suite, testClearLinkedList);
     SUITE_ADD_TEST(suite, testDestroyLinkedList);
@@ -0,0 +1,121 @@
+#include "NodePoolTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/LinkedLists/Headers/NodePool.h"
+#include "../../../../../System/Utils.h"
+
+
+
+
+
+void testInvalidNodePoolInitialization(CuTest *cuTest) {
+
+    nodePoolInitialization(0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testNodePoolAllocate(CuTest *cuTest) {
+
+    NodePool *pool = nodePoolInitialization(3);
+
+    // the node size is aligned to the pointer size.
+    CuAssertIntEquals(cuTest, (int) sizeof(void *), pool->nodeSize);
+    CuAssertPtrEquals(cuTest, NULL, pool->slabs);
+
+    char *firstNode = (char *) nodePoolAllocate(pool);
+    void *firstSlab = pool->slabs;
+
+    // the first slab nodes are carved one after the other.
+    for (int i = 1; i < NODE_POOL_FIRST_SLAB_LENGTH; i++)
+        CuAssertPtrEquals(cuTest, firstNode + i * pool->nodeSize, nodePoolAllocate(pool));
+
+    CuAssertPtrEquals(cuTest, firstSlab, pool->slabs);
+
+    nodePoolAllocate(pool);
+    CuAssertTrue(cuTest, firstSlab != pool->slabs);
+    CuAssertPtrEquals(cuTest, firstSlab, *(void **) pool->slabs);
+    CuAssertIntEquals(cuTest, NODE_POOL_FIRST_SLAB_LENGTH * 4, pool->nextSlabLength);
+    CuAssertIntEquals(cuTest, NODE_POOL_FIRST_SLAB_LENGTH + 1, nodePoolGetUsedCount(pool));
+
+    destroyNodePool(pool);
+
+}
+
+
+void testNodePoolFreeAndReset(CuTest *cuTest) {
+
+    NodePool *pool = nodePoolInitialization(sizeof(int) * 4);
+
+    void *nodes[100];
+    for (int i = 0; i < 100; i++)
+        nodes[i] = nodePoolAllocate(pool);
+
+    nodePoolFree(pool, nodes[10]);
+    nodePoolFree(pool, nodes[20]);
+    CuAssertIntEquals(cuTest, 98, nodePoolGetUsedCount(pool));
+
+    // the freed nodes are reused in the reversed order.
+    CuAssertPtrEquals(cuTest, nodes[20], nodePoolAllocate(pool));
+    CuAssertPtrEquals(cuTest, nodes[10], nodePoolAllocate(pool));
+
+    nodePoolFree(pool, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    nodePoolReset(pool);
+    CuAssertPtrEquals(cuTest, NULL, pool->slabs);
+    CuAssertPtrEquals(cuTest, NULL, pool->freeNodes);
+    CuAssertIntEquals(cuTest, 0, nodePoolGetUsedCount(pool));
+    CuAssertIntEquals(cuTest, NODE_POOL_FIRST_SLAB_LENGTH, pool->nextSlabLength);
+
+    CuAssertPtrNotNull(cuTest, nodePoolAllocate(pool));
+
+    destroyNodePool(pool);
+
+}
+
+
+void testDestroyNodePool(CuTest *cuTest) {
+
+    destroyNodePool(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createNodePoolTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidNodePoolInitialization);
+    SUITE_ADD_TEST(suite, testNodePoolAllocate);
+    SUITE_ADD_TEST(suite, testNodePoolFreeAndReset);
+    SUITE_ADD_TEST(suite, testDestroyNodePool);
+
+    return suite;
+
+}
+
+
+
+void nodePoolUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Node Pool Test**\n");
+
+    CuSuite *suite = createNodePoolTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
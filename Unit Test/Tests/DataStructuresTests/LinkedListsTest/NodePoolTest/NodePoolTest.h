@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_NODEPOOLTEST_H
+#define C_DATASTRUCTURES_NODEPOOLTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void nodePoolUnitTest();
+
+#endif //C_DATASTRUCTURES_NODEPOOLTEST_H
@@ -0,0 +1,306 @@
+#include "SkipListTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/LinkedLists/Headers/SkipList.h"
+#include "../../../../../System/Utils.h"
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerSLT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersSLT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will compare two integers, so it can be used with qsort.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return the difference between the two integers
+ */
+
+int compareIntsSLT(const void *a, const void *b) {
+    return *(const int *)a - *(const int *)b;
+}
+
+
+
+
+int rangeSumSLT;
+
+/** This function will add the passed integer to the range sum.
+ * @param item the integer pointer
+ */
+
+void addToRangeSumSLT(void *item) {
+    rangeSumSLT += *(int *) item;
+}
+
+
+
+
+/** This function will check that the list items are equal to the expected sorted values,
+ * using the to array, the get at index, and the get index functions.
+ * @param cuTest the test address
+ * @param list the skip list address
+ * @param expected the expected sorted values array
+ * @param length the expected values array length
+ */
+
+void assertListItemsSLT(CuTest *cuTest, SkipList *list, int *expected, int length) {
+    CuAssertIntEquals(cuTest, length, skipListGetSize(list));
+
+    void **arr = skipListToArray(list);
+    for (int i = 0; i < length; i++) {
+        CuAssertIntEquals(cuTest, expected[i], *(int *) arr[i]);
+        CuAssertIntEquals(cuTest, expected[i], *(int *) skipListGetAtIndex(list, i));
+
+        // the index of an item is the index of the first item that is equal to it.
+        int firstIndex = i;
+        while (firstIndex > 0 && expected[firstIndex - 1] == expected[i])
+            firstIndex--;
+
+        CuAssertIntEquals(cuTest, firstIndex, skipListGetIndex(list, expected + i));
+    }
+
+    free(arr);
+
+}
+
+
+
+
+
+void testInvalidSkipListInitialization(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, NULL);
+    CuAssertPtrEquals(cuTest, NULL, list);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testSkipListInsert(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, compareIntPointersSLT);
+    int expected[500];
+
+    srand(3);
+    for (int i = 0; i < 500; i++) {
+        expected[i] = rand() % 300;
+        skipListInsert(list, generateIntPointerSLT(expected[i]));
+    }
+
+    qsort(expected, 500, sizeof(int), compareIntsSLT);
+    assertListItemsSLT(cuTest, list, expected, 500);
+    CuAssertTrue(cuTest, list->level > 1);
+
+    int missingItem = 1000;
+    CuAssertIntEquals(cuTest, 0, skipListContains(list, &missingItem));
+    CuAssertIntEquals(cuTest, -1, skipListGetIndex(list, &missingItem));
+    CuAssertPtrEquals(cuTest, NULL, skipListGet(list, &missingItem));
+
+    CuAssertPtrEquals(cuTest, NULL, skipListGetAtIndex(list, 500));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    skipListInsert(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroySkipList(list);
+
+}
+
+
+void testSkipListEqualItemsOrder(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, compareIntPointersSLT);
+
+    void *items[20];
+    for (int i = 0; i < 20; i++)
+        items[i] = generateIntPointerSLT(i % 2);
+
+    skipListInsertAll(list, items, 20);
+
+    // the equal items keep their insertion order.
+    for (int i = 0; i < 10; i++) {
+        CuAssertPtrEquals(cuTest, items[i * 2], skipListGetAtIndex(list, i));
+        CuAssertPtrEquals(cuTest, items[i * 2 + 1], skipListGetAtIndex(list, 10 + i));
+    }
+
+    CuAssertPtrEquals(cuTest, items[1], skipListDeleteWtoFr(list, items[5]));
+    CuAssertIntEquals(cuTest, 10, skipListGetIndex(list, items[5]));
+
+    free(items[1]);
+    destroySkipList(list);
+
+}
+
+
+void testSkipListDelete(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, compareIntPointersSLT);
+    int expected[400];
+    int length = 400;
+
+    for (int i = 0; i < length; i++) {
+        expected[i] = i;
+        skipListInsert(list, generateIntPointerSLT(i));
+    }
+
+    srand(5);
+    while (length > 100) {
+        int index = rand() % length;
+
+        if (length % 2 == 0)
+            skipListDelete(list, expected + index);
+        else
+            skipListDeleteAtIndex(list, index);
+
+        memmove(expected + index, expected + index + 1, sizeof(int) * (--length - index));
+    }
+
+    assertListItemsSLT(cuTest, list, expected, length);
+
+    // deleting a missing item does nothing.
+    int missingItem = -1;
+    skipListDelete(list, &missingItem);
+    CuAssertPtrEquals(cuTest, NULL, skipListDeleteWtoFr(list, &missingItem));
+    CuAssertIntEquals(cuTest, length, skipListGetSize(list));
+
+    int *item = (int *) skipListDeleteAtIndexWtoFr(list, 0);
+    CuAssertIntEquals(cuTest, expected[0], *item);
+    free(item);
+
+    while (!skipListIsEmpty(list))
+        skipListDeleteAtIndex(list, skipListGetSize(list) - 1);
+
+    CuAssertIntEquals(cuTest, 1, list->level);
+
+    skipListDeleteAtIndex(list, 0);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    destroySkipList(list);
+
+}
+
+
+void testSkipListForEachInRange(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, compareIntPointersSLT);
+
+    for (int i = 0; i < 100; i++)
+        skipListInsert(list, generateIntPointerSLT(i * 2));
+
+    int fromItem = 11, toItem = 20;
+    rangeSumSLT = 0;
+    skipListForEachInRange(list, &fromItem, &toItem, addToRangeSumSLT);
+    CuAssertIntEquals(cuTest, 12 + 14 + 16 + 18 + 20, rangeSumSLT);
+
+    fromItem = 300, toItem = 400;
+    rangeSumSLT = 0;
+    skipListForEachInRange(list, &fromItem, &toItem, addToRangeSumSLT);
+    CuAssertIntEquals(cuTest, 0, rangeSumSLT);
+
+    skipListForEachInRange(list, &fromItem, &toItem, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroySkipList(list);
+
+}
+
+
+void testClearSkipList(CuTest *cuTest) {
+
+    SkipList *list = skipListInitialization(free, compareIntPointersSLT);
+
+    for (int i = 0; i < 50; i++)
+        skipListInsert(list, generateIntPointerSLT(50 - i));
+
+    clearSkipList(list);
+    CuAssertIntEquals(cuTest, 1, skipListIsEmpty(list));
+    CuAssertIntEquals(cuTest, 1, list->level);
+
+    // the list can be used again after clearing it.
+    int expected[3] = {1, 2, 3};
+    skipListInsert(list, generateIntPointerSLT(3));
+    skipListInsert(list, generateIntPointerSLT(1));
+    skipListInsert(list, generateIntPointerSLT(2));
+    assertListItemsSLT(cuTest, list, expected, 3);
+
+    destroySkipList(list);
+
+}
+
+
+void testDestroySkipList(CuTest *cuTest) {
+
+    destroySkipList(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createSkipListTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidSkipListInitialization);
+    SUITE_ADD_TEST(suite, testSkipListInsert);
+    SUITE_ADD_TEST(suite, testSkipListEqualItemsOrder);
+    SUITE_ADD_TEST(suite, testSkipListDelete);
+    SUITE_ADD_TEST(suite, testSkipListForEachInRange);
+    SUITE_ADD_TEST(suite, testClearSkipList);
+    SUITE_ADD_TEST(suite, testDestroySkipList);
+
+    return suite;
+
+}
+
+
+
+void skipListUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Skip List Test**\n");
+
+    CuSuite *suite = createSkipListTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
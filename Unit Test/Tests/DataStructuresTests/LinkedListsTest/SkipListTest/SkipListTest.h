@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_SKIPLISTTEST_H
+#define C_DATASTRUCTURES_SKIPLISTTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void skipListUnitTest();
+
+#endif //C_DATASTRUCTURES_SKIPLISTTEST_H
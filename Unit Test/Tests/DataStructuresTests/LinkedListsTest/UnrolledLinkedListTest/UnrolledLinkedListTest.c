@@ -0,0 +1,303 @@
+#include "UnrolledLinkedListTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/LinkedLists/Headers/UnrolledLinkedList.h"
+#include "../../../../../System/Utils.h"
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerULLT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersULLT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will check that the list items are equal to the expected values, using the get and the to array functions.
+ * @param cuTest the test address
+ * @param list the unrolled linked list address
+ * @param expected the expected values array
+ * @param length the expected values array length
+ */
+
+void assertListItemsULLT(CuTest *cuTest, UnrolledLinkedList *list, int *expected, int length) {
+    CuAssertIntEquals(cuTest, length, unrolledLinkedListGetLength(list));
+
+    void **arr = unrolledLinkedListToArray(list);
+    for (int i = 0; i < length; i++) {
+        CuAssertIntEquals(cuTest, expected[i], *(int *) arr[i]);
+        CuAssertIntEquals(cuTest, expected[i], *(int *) unrolledLinkedListGet(list, i));
+    }
+
+    free(arr);
+
+}
+
+
+
+
+
+void testInvalidUnrolledLinkedListInitialization(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(NULL, compareIntPointersULLT);
+    CuAssertPtrEquals(cuTest, NULL, list);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testUnrolledLinkedListAddFirstAndLast(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(free, compareIntPointersULLT);
+    int expected[100];
+
+    // the nodes that are filled from the end of the list are full.
+    for (int i = 0; i < 50; i++) {
+        unrolledLinkedListAddLast(list, generateIntPointerULLT(i));
+        expected[50 + i] = i;
+    }
+
+    CuAssertIntEquals(cuTest, (50 + UNROLLED_LINKED_LIST_NODE_CAPACITY - 1) / UNROLLED_LINKED_LIST_NODE_CAPACITY, list->nodesCount);
+
+    for (int i = 0; i < 50; i++) {
+        unrolledLinkedListAddFirst(list, generateIntPointerULLT(-i));
+        expected[49 - i] = -i;
+    }
+
+    assertListItemsULLT(cuTest, list, expected, 100);
+    CuAssertIntEquals(cuTest, -49, *(int *) unrolledLinkedListGetFirst(list));
+    CuAssertIntEquals(cuTest, 49, *(int *) unrolledLinkedListGetLast(list));
+
+    unrolledLinkedListAddLast(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyUnrolledLinkedList(list);
+
+}
+
+
+void testUnrolledLinkedListAddAtIndex(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(free, compareIntPointersULLT);
+    int expected[200];
+    int length = 0;
+
+    for (int i = 0; i < UNROLLED_LINKED_LIST_NODE_CAPACITY * 2; i++) {
+        unrolledLinkedListAddLast(list, generateIntPointerULLT(i));
+        expected[length++] = i;
+    }
+
+    CuAssertIntEquals(cuTest, 2, list->nodesCount);
+
+    // inserting in a full node splits it.
+    unrolledLinkedListAddAtIndex(list, 1, generateIntPointerULLT(1000));
+    memmove(expected + 2, expected + 1, sizeof(int) * (length - 1));
+    expected[1] = 1000;
+    length++;
+
+    CuAssertIntEquals(cuTest, 3, list->nodesCount);
+    assertListItemsULLT(cuTest, list, expected, length);
+
+    srand(7);
+    while (length < 200) {
+        int index = rand() % length;
+        unrolledLinkedListAddAtIndex(list, index, generateIntPointerULLT(length));
+        memmove(expected + index + 1, expected + index, sizeof(int) * (length - index));
+        expected[index] = length++;
+    }
+
+    assertListItemsULLT(cuTest, list, expected, length);
+
+    int outOfRangeItem = 0;
+    unrolledLinkedListAddAtIndex(list, length, &outOfRangeItem);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    destroyUnrolledLinkedList(list);
+
+}
+
+
+void testUnrolledLinkedListDelete(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(free, compareIntPointersULLT);
+    int expected[200];
+    int length = 0;
+
+    for (int i = 0; i < 200; i++) {
+        unrolledLinkedListAddLast(list, generateIntPointerULLT(i));
+        expected[length++] = i;
+    }
+
+    unrolledLinkedListDeleteFirst(list);
+    memmove(expected, expected + 1, sizeof(int) * --length);
+
+    int *item = (int *) unrolledLinkedListDeleteLastWtoFr(list);
+    CuAssertIntEquals(cuTest, 199, *item);
+    free(item);
+    length--;
+
+    item = (int *) unrolledLinkedListDeleteAtIndexWtoFr(list, 10);
+    CuAssertIntEquals(cuTest, 11, *item);
+    free(item);
+    memmove(expected + 10, expected + 11, sizeof(int) * (--length - 10));
+
+    assertListItemsULLT(cuTest, list, expected, length);
+
+    srand(11);
+    while (length > 20) {
+        int index = rand() % length;
+        unrolledLinkedListDeleteAtIndex(list, index);
+        memmove(expected + index, expected + index + 1, sizeof(int) * (--length - index));
+    }
+
+    assertListItemsULLT(cuTest, list, expected, length);
+
+    // the nodes that became less than half full are merged with their next nodes.
+    CuAssertTrue(cuTest, list->nodesCount <= (length + UNROLLED_LINKED_LIST_NODE_CAPACITY / 2 - 1) / (UNROLLED_LINKED_LIST_NODE_CAPACITY / 2));
+
+    while (length > 0) {
+        unrolledLinkedListDeleteLast(list);
+        length--;
+    }
+
+    CuAssertIntEquals(cuTest, 1, unrolledLinkedListIsEmpty(list));
+    CuAssertIntEquals(cuTest, 0, list->nodesCount);
+    CuAssertPtrEquals(cuTest, NULL, list->head);
+    CuAssertPtrEquals(cuTest, NULL, list->tail);
+
+    unrolledLinkedListDeleteFirst(list);
+    CuAssertIntEquals(cuTest, EMPTY_DATA_STRUCTURE, ERROR_TEST->errorCode);
+
+    CuAssertPtrEquals(cuTest, NULL, unrolledLinkedListGetLast(list));
+    CuAssertIntEquals(cuTest, EMPTY_DATA_STRUCTURE, ERROR_TEST->errorCode);
+
+    destroyUnrolledLinkedList(list);
+
+}
+
+
+void testUnrolledLinkedListSearch(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(free, compareIntPointersULLT);
+
+    for (int i = 0; i < 40; i++)
+        unrolledLinkedListAddLast(list, generateIntPointerULLT(i * 2));
+
+    int *item = generateIntPointerULLT(30);
+    CuAssertIntEquals(cuTest, 1, unrolledLinkedListContains(list, item));
+    CuAssertIntEquals(cuTest, 15, unrolledLinkedListGetIndex(list, item));
+    CuAssertIntEquals(cuTest, 30, *(int *) unrolledLinkedListGetItem(list, item));
+
+    *item = 31;
+    CuAssertIntEquals(cuTest, 0, unrolledLinkedListContains(list, item));
+    CuAssertIntEquals(cuTest, -1, unrolledLinkedListGetIndex(list, item));
+    CuAssertPtrEquals(cuTest, NULL, unrolledLinkedListGetItem(list, item));
+
+    CuAssertPtrEquals(cuTest, NULL, unrolledLinkedListGet(list, 40));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    free(item);
+    destroyUnrolledLinkedList(list);
+
+}
+
+
+void testUnrolledLinkedListAddAllAndClear(CuTest *cuTest) {
+
+    UnrolledLinkedList *list = unrolledLinkedListInitialization(free, compareIntPointersULLT);
+
+    void *items[30];
+    int expected[30];
+    for (int i = 0; i < 30; i++) {
+        items[i] = generateIntPointerULLT(i);
+        expected[i] = i;
+    }
+
+    unrolledLinkedListAddAll(list, items, 30);
+    assertListItemsULLT(cuTest, list, expected, 30);
+
+    unrolledLinkedListClear(list);
+    CuAssertIntEquals(cuTest, 0, unrolledLinkedListGetLength(list));
+    CuAssertIntEquals(cuTest, 0, list->nodesCount);
+
+    // the list can be used again after clearing it.
+    unrolledLinkedListAddFirst(list, generateIntPointerULLT(5));
+    CuAssertIntEquals(cuTest, 5, *(int *) unrolledLinkedListGetLast(list));
+
+    destroyUnrolledLinkedList(list);
+
+}
+
+
+void testDestroyUnrolledLinkedList(CuTest *cuTest) {
+
+    destroyUnrolledLinkedList(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createUnrolledLinkedListTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidUnrolledLinkedListInitialization);
+    SUITE_ADD_TEST(suite, testUnrolledLinkedListAddFirstAndLast);
+    SUITE_ADD_TEST(suite, testUnrolledLinkedListAddAtIndex);
+    SUITE_ADD_TEST(suite, testUnrolledLinkedListDelete);
+    SUITE_ADD_TEST(suite, testUnrolledLinkedListSearch);
+    SUITE_ADD_TEST(suite, testUnrolledLinkedListAddAllAndClear);
+    SUITE_ADD_TEST(suite, testDestroyUnrolledLinkedList);
+
+    return suite;
+
+}
+
+
+
+void unrolledLinkedListUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Unrolled Linked List Test**\n");
+
+    CuSuite *suite = createUnrolledLinkedListTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
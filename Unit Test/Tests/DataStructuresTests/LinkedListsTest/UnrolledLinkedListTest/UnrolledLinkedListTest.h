@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_UNROLLEDLINKEDLISTTEST_H
+#define C_DATASTRUCTURES_UNROLLEDLINKEDLISTTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void unrolledLinkedListUnitTest();
+
+#endif //C_DATASTRUCTURES_UNROLLEDLINKEDLISTTEST_H
@@ -26,6 +26,20 @@ int *generateIntPointerALT(int integer) {
 
 
 
+/** This function will take an integer pointer,
+ * then it will return one if the integer is even, other wise it will return zero.
+ *
+ * @param integer the integer pointer
+ * @return it will return one if the integer is even, other wise it will return zero
+ */
+
+int isEvenIntPointerALT(const void *integer) {
+    return *(int *) integer % 2 == 0;
+}
+
+
+
+
 /** This function will compare to integers pointers,
  * then it will return zero if they are equal, negative number if the second integer is bigger,
  * and positive number if the first integer is bigger.
@@ -42,6 +56,61 @@ int compareIntPointersALT(const void *a, const void *b) {
 
 
 
+/** This function will take an integer pointer,
+ * then it will increment the integer by one.
+ *
+ * @param integer the integer pointer
+ */
+
+void incrementIntPointerALT(void *integer) {
+    (*(int *) integer)++;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will allocate a new integer that holds the double of the integer value, and return it.
+ *
+ * @param integer the integer pointer
+ * @return it will return the new allocated integer pointer
+ */
+
+void *doubleIntPointerALT(const void *integer) {
+    return generateIntPointerALT(*(int *) integer * 2);
+}
+
+
+
+
+/** This function will take a partial sum pointer, and an integer pointer,
+ * then it will add the integer to the partial sum.
+ *
+ * @param partial the partial sum pointer
+ * @param integer the integer pointer
+ */
+
+void sumIntPointersALT(void *partial, const void *integer) {
+    *(long long *) partial += *(int *) integer;
+}
+
+
+
+
+/** This function will take a sum pointer, and a partial sum pointer,
+ * then it will add the partial sum to the sum.
+ *
+ * @param sum the sum pointer
+ * @param partial the partial sum pointer
+ */
+
+void combineSumsALT(void *sum, const void *partial) {
+    *(long long *) sum += *(long long *) partial;
+}
+
+
+
+
 /** This function will take a char array
  * then it will allocate a new one and copy the original char array into the new one,
  * and finally return the new allocated char array.
@@ -309,6 +378,233 @@ void testArrayListExpansion(CuTest *cuTest) {
 
 
 
+void testArrayListReserveAndShrinkToFit(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(1, free, compareIntPointersALT);
+
+    arrayListReserve(arrayList, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    arrayListReserve(arrayList, 100);
+    CuAssertIntEquals(cuTest, 100, arrayListGetCapacity(arrayList));
+
+    arrayListReserve(arrayList, 10);
+    CuAssertIntEquals(cuTest, 100, arrayListGetCapacity(arrayList));
+
+    for (int i = 0; i < 100; i++)
+        arrayListAdd(arrayList, generateIntPointerALT(i));
+
+    CuAssertIntEquals(cuTest, 100, arrayListGetCapacity(arrayList));
+
+    for (int i = 0; i < 90; i++)
+        arrayListRemove(arrayList);
+
+    arrayListShrinkToFit(arrayList);
+    CuAssertIntEquals(cuTest, 10, arrayListGetCapacity(arrayList));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) arrayListGet(arrayList, i));
+
+    clearArrayList(arrayList);
+    arrayListShrinkToFit(arrayList);
+    CuAssertIntEquals(cuTest, 1, arrayListGetCapacity(arrayList));
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
+void testArrayListGrowthPolicy(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(2, free, compareIntPointersALT);
+
+    arrayListSetGrowthPolicy(arrayList, 1, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    arrayListSetGrowthPolicy(arrayList, 2, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    // the length doubles until it reaches the maximum growth, then it grows by the maximum growth.
+    arrayListSetGrowthPolicy(arrayList, 2, 8);
+    int expectedCapacities[] = {2, 4, 8, 16, 24, 32};
+    for (int i = 0, expectedIndex = 0; i < 32; i++) {
+        if (i == arrayListGetCapacity(arrayList))
+            expectedIndex++;
+
+        arrayListAdd(arrayList, generateIntPointerALT(i));
+        CuAssertIntEquals(cuTest, expectedCapacities[expectedIndex], arrayListGetCapacity(arrayList));
+    }
+
+    // adding an array grows the memory one time only, to fit all the items.
+    void *items[100];
+    for (int i = 0; i < 100; i++)
+        items[i] = generateIntPointerALT(i + 32);
+
+    arrayListAddAll(arrayList, items, 100);
+    CuAssertIntEquals(cuTest, 132, arrayListGetLength(arrayList));
+    CuAssertIntEquals(cuTest, 132, arrayListGetCapacity(arrayList));
+    for (int i = 0; i < 132; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) arrayListGet(arrayList, i));
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
+void testArrayListInsertRange(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(2, free, compareIntPointersALT);
+
+    arrayListInsertRange(NULL, 0, NULL, 0);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    arrayListInsertRange(arrayList, 0, NULL, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 4; i++)
+        arrayListAdd(arrayList, generateIntPointerALT(i * 10));
+
+    void *items[3] = {generateIntPointerALT(11), generateIntPointerALT(12), generateIntPointerALT(13)};
+    arrayListInsertRange(arrayList, 5, items, 3);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    arrayListInsertRange(arrayList, 2, items, 3);
+
+    // 0, 10, 11, 12, 13, 20, 30
+    int expected[] = {0, 10, 11, 12, 13, 20, 30};
+    CuAssertIntEquals(cuTest, 7, arrayListGetLength(arrayList));
+    for (int i = 0; i < 7; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) arrayListGet(arrayList, i));
+
+    void *lastItems[2] = {generateIntPointerALT(40), generateIntPointerALT(50)};
+    arrayListInsertRange(arrayList, 7, lastItems, 2);
+    CuAssertIntEquals(cuTest, 9, arrayListGetLength(arrayList));
+    CuAssertIntEquals(cuTest, 50, *(int *) arrayListGet(arrayList, 8));
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
+void testArrayListRemoveRange(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(2, free, compareIntPointersALT);
+
+    for (int i = 0; i < 10; i++)
+        arrayListAdd(arrayList, generateIntPointerALT(i));
+
+    arrayListRemoveRange(arrayList, 5, 11);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    arrayListRemoveRange(arrayList, 6, 5);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    arrayListRemoveRange(arrayList, 2, 5);
+
+    // 0, 1, 5, 6, 7, 8, 9
+    int expected[] = {0, 1, 5, 6, 7, 8, 9};
+    CuAssertIntEquals(cuTest, 7, arrayListGetLength(arrayList));
+    for (int i = 0; i < 7; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) arrayListGet(arrayList, i));
+
+    int *lastItem = (int *) arrayListGet(arrayList, 6);
+    arrayListRemoveRangeWtFr(arrayList, 6, 7);
+    CuAssertIntEquals(cuTest, 6, arrayListGetLength(arrayList));
+    CuAssertIntEquals(cuTest, 9, *lastItem);
+    free(lastItem);
+
+    arrayListRemoveRange(arrayList, 0, 6);
+    CuAssertIntEquals(cuTest, 1, arrayListIsEmpty(arrayList));
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
+void testArrayListRemoveIf(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(2, free, compareIntPointersALT);
+
+    arrayListRemoveIf(arrayList, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 20; i++)
+        arrayListAdd(arrayList, generateIntPointerALT(i));
+
+    CuAssertIntEquals(cuTest, 10, arrayListRemoveIf(arrayList, isEvenIntPointerALT));
+    CuAssertIntEquals(cuTest, 10, arrayListGetLength(arrayList));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i * 2 + 1, *(int *) arrayListGet(arrayList, i));
+
+    CuAssertIntEquals(cuTest, 0, arrayListRemoveIf(arrayList, isEvenIntPointerALT));
+
+    int *evenItem = generateIntPointerALT(100);
+    arrayListAdd(arrayList, evenItem);
+    CuAssertIntEquals(cuTest, 1, arrayListRemoveIfWtFr(arrayList, isEvenIntPointerALT));
+    CuAssertIntEquals(cuTest, 100, *evenItem);
+    free(evenItem);
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
+void testArrayListParallelOperations(CuTest *cuTest) {
+    ArrayList *arrayList = arrayListInitialization(2, free, compareIntPointersALT);
+
+    arrayListParallelForEach(arrayList, NULL, 4);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    arrayListParallelForEach(arrayList, incrementIntPointerALT, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 10000; i++)
+        arrayListAdd(arrayList, generateIntPointerALT(i));
+
+    arrayListParallelForEach(arrayList, incrementIntPointerALT, 4);
+    for (int i = 0; i < 10000; i++)
+        CuAssertIntEquals(cuTest, i + 1, *(int *) arrayListGet(arrayList, i));
+
+    void **output = (void **) malloc(sizeof(void *) * 10000);
+    arrayListParallelMap(arrayList, output, doubleIntPointerALT, 3);
+    for (int i = 0; i < 10000; i++) {
+        CuAssertIntEquals(cuTest, (i + 1) * 2, *(int *) output[i]);
+        free(output[i]);
+    }
+
+    // 1, 2, 3, ... 10000 so the even items are 2, 4, 6, ... 10000.
+    CuAssertIntEquals(cuTest, 5000, arrayListParallelFilter(arrayList, output, isEvenIntPointerALT, 7));
+    for (int i = 0; i < 5000; i++)
+        CuAssertIntEquals(cuTest, (i + 1) * 2, *(int *) output[i]);
+
+    free(output);
+
+    long long sum = 0;
+    arrayListParallelReduce(arrayList, &sum, sizeof(long long), sumIntPointersALT, combineSumsALT, 8);
+    CuAssertTrue(cuTest, sum == 10000LL * 10001 / 2);
+
+    // more threads than items.
+    arrayListRemoveRange(arrayList, 3, 10000);
+    sum = 0;
+    arrayListParallelReduce(arrayList, &sum, sizeof(long long), sumIntPointersALT, combineSumsALT, 16);
+    CuAssertTrue(cuTest, sum == 6);
+
+    clearArrayList(arrayList);
+    sum = 0;
+    arrayListParallelReduce(arrayList, &sum, sizeof(long long), sumIntPointersALT, combineSumsALT, 4);
+    CuAssertTrue(cuTest, sum == 0);
+
+    destroyArrayList(arrayList);
+
+}
+
+
+
+
 void testArrayListContains(CuTest *cuTest) {
     ArrayList *arrayList = arrayListInitialization(1, free, compareIntPointersALT);
 
@@ -834,6 +1130,12 @@ CuSuite *createArrayListTestsSuite() {
     SUITE_ADD_TEST(suite, testArrayListRemoveAtIndex);
     SUITE_ADD_TEST(suite, testArrayListRemoveAtIndexWtoFr);
     SUITE_ADD_TEST(suite, testArrayListExpansion);
+    SUITE_ADD_TEST(suite, testArrayListReserveAndShrinkToFit);
+    SUITE_ADD_TEST(suite, testArrayListGrowthPolicy);
+    SUITE_ADD_TEST(suite, testArrayListInsertRange);
+    SUITE_ADD_TEST(suite, testArrayListRemoveRange);
+    SUITE_ADD_TEST(suite, testArrayListRemoveIf);
+    SUITE_ADD_TEST(suite, testArrayListParallelOperations);
     SUITE_ADD_TEST(suite, testArrayListContains);
     SUITE_ADD_TEST(suite, testArrayListGetIndex);
     SUITE_ADD_TEST(suite, testArrayListGetLastIndex);
@@ -0,0 +1,191 @@
+#include "GapBufferTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/Lists/Headers/GapBuffer.h"
+#include "../../../../../System/Utils.h"
+
+
+
+
+
+/** This function will check that the buffer items are equal to the expected integers array.
+ * @param cuTest the test pointer
+ * @param buffer the buffer address
+ * @param expected the expected integers array
+ * @param length the expected array length
+ */
+
+void assertBufferItemsGBT(CuTest *cuTest, GapBuffer *buffer, int *expected, int length) {
+    CuAssertIntEquals(cuTest, length, gapBufferGetLength(buffer));
+
+    for (int i = 0; i < length; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) gapBufferGet(buffer, i));
+
+}
+
+
+
+
+void testInvalidGapBufferInitialization(CuTest *cuTest) {
+
+    gapBufferInitialization(0, 10);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    gapBufferInitialization(sizeof(int), 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testGapBufferAddAndGet(CuTest *cuTest) {
+
+    GapBuffer *buffer = gapBufferInitialization(sizeof(int), 1);
+    CuAssertIntEquals(cuTest, 1, gapBufferIsEmpty(buffer));
+
+    for (int i = 0; i < 1000; i++)
+        gapBufferAdd(buffer, &i);
+
+    CuAssertIntEquals(cuTest, 1000, gapBufferGetLength(buffer));
+    CuAssertIntEquals(cuTest, 0, gapBufferIsEmpty(buffer));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) gapBufferGet(buffer, i));
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, gapBufferGet(buffer, 1000));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    gapBufferAdd(buffer, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyGapBuffer(buffer);
+
+}
+
+
+void testGapBufferCursorEdits(CuTest *cuTest) {
+
+    GapBuffer *buffer = gapBufferInitialization(sizeof(int), 2);
+
+    int values[] = {0, 1, 2, 3, 4, 5};
+    gapBufferAddArrayAtIndex(buffer, 0, values, 6);
+
+    // typing at a cursor in the middle of the buffer.
+    int cursor = 3;
+    for (int i = 10; i < 13; i++) {
+        gapBufferAddAtIndex(buffer, cursor, &i);
+        cursor++;
+    }
+
+    int expected[] = {0, 1, 2, 10, 11, 12, 3, 4, 5};
+    assertBufferItemsGBT(cuTest, buffer, expected, 9);
+
+    // the gap follows the cursor, so it starts right after the last typed item.
+    CuAssertIntEquals(cuTest, 6, buffer->gapStart);
+
+    // deleting backward from the cursor.
+    gapBufferRemoveAtIndex(buffer, --cursor);
+    gapBufferRemoveAtIndex(buffer, --cursor);
+
+    int expectedAfterRemove[] = {0, 1, 2, 10, 3, 4, 5};
+    assertBufferItemsGBT(cuTest, buffer, expectedAfterRemove, 7);
+
+    // editing at the start and the end of the buffer.
+    int item = -1;
+    gapBufferAddAtIndex(buffer, 0, &item);
+    item = 6;
+    gapBufferAddAtIndex(buffer, 8, &item);
+    gapBufferRemoveAtIndex(buffer, 4);
+
+    int expectedAfterEdges[] = {-1, 0, 1, 2, 3, 4, 5, 6};
+    assertBufferItemsGBT(cuTest, buffer, expectedAfterEdges, 8);
+
+    ERROR_TEST->errorCode = -1;
+    gapBufferAddAtIndex(buffer, 9, &item);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    ERROR_TEST->errorCode = -1;
+    gapBufferRemoveAtIndex(buffer, 8);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    destroyGapBuffer(buffer);
+
+}
+
+
+void testGapBufferRemoveRangeAndGetArray(CuTest *cuTest) {
+
+    GapBuffer *buffer = gapBufferInitialization(sizeof(int), 4);
+
+    for (int i = 0; i < 10; i++)
+        gapBufferAdd(buffer, &i);
+
+    int item = 100;
+    gapBufferAddAtIndex(buffer, 2, &item);
+    gapBufferRemoveRange(buffer, 5, 9);
+
+    int expected[] = {0, 1, 100, 2, 3, 8, 9};
+    CuAssertIntEquals(cuTest, 7, gapBufferGetLength(buffer));
+    CuAssertTrue(cuTest, memcmp(expected, gapBufferGetArray(buffer), sizeof(expected)) == 0);
+    CuAssertIntEquals(cuTest, 7, buffer->gapStart);
+
+    ERROR_TEST->errorCode = -1;
+    gapBufferRemoveRange(buffer, 3, 8);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    gapBufferRemoveRange(buffer, 0, 7);
+    CuAssertIntEquals(cuTest, 1, gapBufferIsEmpty(buffer));
+
+    gapBufferAdd(buffer, &item);
+    clearGapBuffer(buffer);
+    CuAssertIntEquals(cuTest, 0, gapBufferGetLength(buffer));
+
+    destroyGapBuffer(buffer);
+
+}
+
+
+void testDestroyGapBuffer(CuTest *cuTest) {
+
+    destroyGapBuffer(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createGapBufferTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidGapBufferInitialization);
+    SUITE_ADD_TEST(suite, testGapBufferAddAndGet);
+    SUITE_ADD_TEST(suite, testGapBufferCursorEdits);
+    SUITE_ADD_TEST(suite, testGapBufferRemoveRangeAndGetArray);
+    SUITE_ADD_TEST(suite, testDestroyGapBuffer);
+
+    return suite;
+
+}
+
+
+
+void gapBufferUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Gap Buffer Test**\n");
+
+    CuSuite *suite = createGapBufferTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_GAPBUFFERTEST_H
+#define C_DATASTRUCTURES_GAPBUFFERTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void gapBufferUnitTest();
+
+#endif //C_DATASTRUCTURES_GAPBUFFERTEST_H
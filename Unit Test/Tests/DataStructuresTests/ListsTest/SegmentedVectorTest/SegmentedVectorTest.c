@@ -0,0 +1,212 @@
+#include "SegmentedVectorTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/Lists/Headers/SegmentedVector.h"
+#include "../../../../../System/Utils.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerSGVT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersSGVT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+void testInvalidSegmentedVectorInitialization(CuTest *cuTest) {
+
+    segmentedVectorInitialization(NULL, compareIntPointersSGVT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testSegmentedVectorAddAndGet(CuTest *cuTest) {
+
+    SegmentedVector *list = segmentedVectorInitialization(free, compareIntPointersSGVT);
+    CuAssertIntEquals(cuTest, 1, segmentedVectorIsEmpty(list));
+    CuAssertIntEquals(cuTest, 0, list->chunksCount);
+
+    for (int i = 0; i < 100000; i++)
+        segmentedVectorAdd(list, generateIntPointerSGVT(i));
+
+    CuAssertIntEquals(cuTest, 100000, segmentedVectorGetLength(list));
+
+    for (int i = 0; i < 100000; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) segmentedVectorGet(list, i));
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, segmentedVectorGet(list, 100000));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    segmentedVectorAdd(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroySegmentedVector(list);
+
+}
+
+
+void testSegmentedVectorChunks(CuTest *cuTest) {
+
+    SegmentedVector *list = segmentedVectorInitialization(free, compareIntPointersSGVT);
+
+    // the chunks lengths are 16, 32, 64, ... so they start at the indices 0, 16, 48, 112, ...
+    for (int i = 0; i < SEGMENTED_VECTOR_FIRST_CHUNK_LENGTH; i++)
+        segmentedVectorAdd(list, generateIntPointerSGVT(i));
+
+    CuAssertIntEquals(cuTest, 1, list->chunksCount);
+
+    segmentedVectorAdd(list, generateIntPointerSGVT(16));
+    CuAssertIntEquals(cuTest, 2, list->chunksCount);
+    CuAssertPtrEquals(cuTest, list->chunks[1], segmentedVectorGetItemAddress(list, 16));
+
+    for (int i = 17; i < 49; i++)
+        segmentedVectorAdd(list, generateIntPointerSGVT(i));
+
+    CuAssertIntEquals(cuTest, 3, list->chunksCount);
+    CuAssertPtrEquals(cuTest, list->chunks[1] + 31, segmentedVectorGetItemAddress(list, 47));
+    CuAssertPtrEquals(cuTest, list->chunks[2], segmentedVectorGetItemAddress(list, 48));
+
+    // removing keeps the chunks until the vector is shrunk.
+    for (int i = 0; i < 33; i++)
+        segmentedVectorRemove(list);
+
+    CuAssertIntEquals(cuTest, 3, list->chunksCount);
+    segmentedVectorShrinkToFit(list);
+    CuAssertIntEquals(cuTest, 1, list->chunksCount);
+    CuAssertIntEquals(cuTest, 15, *(int *) segmentedVectorGet(list, 15));
+
+    int *item = (int *) segmentedVectorGet(list, 15);
+    segmentedVectorRemoveWtFr(list);
+    free(item);
+
+    clearSegmentedVector(list);
+    segmentedVectorShrinkToFit(list);
+    CuAssertIntEquals(cuTest, 0, list->chunksCount);
+
+    ERROR_TEST->errorCode = -1;
+    segmentedVectorRemove(list);
+    CuAssertIntEquals(cuTest, EMPTY_DATA_STRUCTURE, ERROR_TEST->errorCode);
+
+    destroySegmentedVector(list);
+
+}
+
+
+void testSegmentedVectorStableAddresses(CuTest *cuTest) {
+
+    SegmentedVector *list = segmentedVectorInitialization(free, compareIntPointersSGVT);
+
+    segmentedVectorAdd(list, generateIntPointerSGVT(0));
+    segmentedVectorAdd(list, generateIntPointerSGVT(1));
+
+    void **firstAddress = segmentedVectorGetItemAddress(list, 0);
+    void **secondAddress = segmentedVectorGetItemAddress(list, 1);
+
+    for (int i = 2; i < 10000; i++)
+        segmentedVectorAdd(list, generateIntPointerSGVT(i));
+
+    // the old items are never moved by the growth.
+    CuAssertPtrEquals(cuTest, firstAddress, segmentedVectorGetItemAddress(list, 0));
+    CuAssertPtrEquals(cuTest, secondAddress, segmentedVectorGetItemAddress(list, 1));
+    CuAssertIntEquals(cuTest, 1, *(int *) *secondAddress);
+
+    destroySegmentedVector(list);
+
+}
+
+
+void testSegmentedVectorGetIndexAndContains(CuTest *cuTest) {
+
+    SegmentedVector *list = segmentedVectorInitialization(free, compareIntPointersSGVT);
+
+    for (int i = 0; i < 1000; i++)
+        segmentedVectorAdd(list, generateIntPointerSGVT(i * 2));
+
+    int item = 1000;
+    CuAssertIntEquals(cuTest, 500, segmentedVectorGetIndex(list, &item));
+    CuAssertIntEquals(cuTest, 1, segmentedVectorContains(list, &item));
+
+    item = 1001;
+    CuAssertIntEquals(cuTest, -1, segmentedVectorGetIndex(list, &item));
+    CuAssertIntEquals(cuTest, 0, segmentedVectorContains(list, &item));
+
+    destroySegmentedVector(list);
+
+}
+
+
+void testDestroySegmentedVector(CuTest *cuTest) {
+
+    destroySegmentedVector(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createSegmentedVectorTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidSegmentedVectorInitialization);
+    SUITE_ADD_TEST(suite, testSegmentedVectorAddAndGet);
+    SUITE_ADD_TEST(suite, testSegmentedVectorChunks);
+    SUITE_ADD_TEST(suite, testSegmentedVectorStableAddresses);
+    SUITE_ADD_TEST(suite, testSegmentedVectorGetIndexAndContains);
+    SUITE_ADD_TEST(suite, testDestroySegmentedVector);
+
+    return suite;
+
+}
+
+
+
+void segmentedVectorUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Segmented Vector Test**\n");
+
+    CuSuite *suite = createSegmentedVectorTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
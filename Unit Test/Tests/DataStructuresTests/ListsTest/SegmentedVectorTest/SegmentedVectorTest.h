@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_SEGMENTEDVECTORTEST_H
+#define C_DATASTRUCTURES_SEGMENTEDVECTORTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void segmentedVectorUnitTest();
+
+#endif //C_DATASTRUCTURES_SEGMENTEDVECTORTEST_H
@@ -0,0 +1,237 @@
+#include "SmallVectorTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/Lists/Headers/SmallVector.h"
+#include "../../../../../System/Utils.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerSVT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersSVT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+void testInvalidSmallVectorInitialization(CuTest *cuTest) {
+
+    smallVectorInitialization(NULL, compareIntPointersSVT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    smallVectorEmbeddedInitialization(NULL, free, compareIntPointersSVT);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+void testSmallVectorInlineItems(CuTest *cuTest) {
+
+    SmallVector *list = smallVectorInitialization(free, compareIntPointersSVT);
+    CuAssertIntEquals(cuTest, 1, smallVectorIsEmpty(list));
+
+    for (int i = 0; i < SMALL_VECTOR_INLINE_LENGTH; i++)
+        smallVectorAdd(list, generateIntPointerSVT(i));
+
+    // the items still fit inside the structure, so there is no heap array.
+    CuAssertPtrEquals(cuTest, NULL, list->heapItems);
+    CuAssertIntEquals(cuTest, SMALL_VECTOR_INLINE_LENGTH, smallVectorGetLength(list));
+
+    for (int i = 0; i < SMALL_VECTOR_INLINE_LENGTH; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) smallVectorGet(list, i));
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, smallVectorGet(list, SMALL_VECTOR_INLINE_LENGTH));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    smallVectorAdd(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroySmallVector(list);
+
+}
+
+
+void testSmallVectorSpillToHeap(CuTest *cuTest) {
+
+    SmallVector *list = smallVectorInitialization(free, compareIntPointersSVT);
+
+    for (int i = 0; i < 100; i++)
+        smallVectorAdd(list, generateIntPointerSVT(i));
+
+    CuAssertPtrNotNull(cuTest, list->heapItems);
+    CuAssertIntEquals(cuTest, 100, smallVectorGetLength(list));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) smallVectorGet(list, i));
+
+    clearSmallVector(list);
+    CuAssertPtrEquals(cuTest, NULL, list->heapItems);
+    CuAssertIntEquals(cuTest, 0, smallVectorGetLength(list));
+
+    smallVectorAdd(list, generateIntPointerSVT(5));
+    CuAssertIntEquals(cuTest, 5, *(int *) smallVectorGet(list, 0));
+
+    destroySmallVector(list);
+
+}
+
+
+void testSmallVectorRemove(CuTest *cuTest) {
+
+    SmallVector *list = smallVectorInitialization(free, compareIntPointersSVT);
+
+    ERROR_TEST->errorCode = -1;
+    smallVectorRemove(list);
+    CuAssertIntEquals(cuTest, EMPTY_DATA_STRUCTURE, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 6; i++)
+        smallVectorAdd(list, generateIntPointerSVT(i));
+
+    smallVectorRemove(list);
+    smallVectorRemoveAtIndex(list, 0);
+
+    int *item = (int *) smallVectorGet(list, 1);
+    smallVectorRemoveAtIndexWtFr(list, 1);
+    CuAssertIntEquals(cuTest, 2, *item);
+    free(item);
+
+    // 1, 3, 4
+    CuAssertIntEquals(cuTest, 3, smallVectorGetLength(list));
+    CuAssertIntEquals(cuTest, 1, *(int *) smallVectorGet(list, 0));
+    CuAssertIntEquals(cuTest, 3, *(int *) smallVectorGet(list, 1));
+    CuAssertIntEquals(cuTest, 4, *(int *) smallVectorGet(list, 2));
+
+    item = (int *) smallVectorGet(list, 2);
+    smallVectorRemoveWtFr(list);
+    CuAssertIntEquals(cuTest, 4, *item);
+    free(item);
+
+    ERROR_TEST->errorCode = -1;
+    smallVectorRemoveAtIndex(list, 2);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    destroySmallVector(list);
+
+}
+
+
+void testSmallVectorGetIndexAndContains(CuTest *cuTest) {
+
+    SmallVector *list = smallVectorInitialization(free, compareIntPointersSVT);
+
+    for (int i = 0; i < 10; i++)
+        smallVectorAdd(list, generateIntPointerSVT(i * 10));
+
+    int item = 70;
+    CuAssertIntEquals(cuTest, 7, smallVectorGetIndex(list, &item));
+    CuAssertIntEquals(cuTest, 1, smallVectorContains(list, &item));
+
+    item = 75;
+    CuAssertIntEquals(cuTest, -1, smallVectorGetIndex(list, &item));
+    CuAssertIntEquals(cuTest, 0, smallVectorContains(list, &item));
+
+    destroySmallVector(list);
+
+}
+
+
+void testEmbeddedSmallVector(CuTest *cuTest) {
+
+    SmallVector list;
+    smallVectorEmbeddedInitialization(&list, free, NULL);
+
+    for (int i = 0; i < 3; i++)
+        smallVectorAdd(&list, generateIntPointerSVT(i));
+
+    CuAssertIntEquals(cuTest, 3, smallVectorGetLength(&list));
+
+    ERROR_TEST->errorCode = -1;
+    int item = 1;
+    smallVectorContains(&list, &item);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 3; i < 20; i++)
+        smallVectorAdd(&list, generateIntPointerSVT(i));
+
+    CuAssertIntEquals(cuTest, 19, *(int *) smallVectorGet(&list, 19));
+
+    clearSmallVector(&list);
+    CuAssertIntEquals(cuTest, 1, smallVectorIsEmpty(&list));
+
+}
+
+
+void testDestroySmallVector(CuTest *cuTest) {
+
+    destroySmallVector(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createSmallVectorTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidSmallVectorInitialization);
+    SUITE_ADD_TEST(suite, testSmallVectorInlineItems);
+    SUITE_ADD_TEST(suite, testSmallVectorSpillToHeap);
+    SUITE_ADD_TEST(suite, testSmallVectorRemove);
+    SUITE_ADD_TEST(suite, testSmallVectorGetIndexAndContains);
+    SUITE_ADD_TEST(suite, testEmbeddedSmallVector);
+    SUITE_ADD_TEST(suite, testDestroySmallVector);
+
+    return suite;
+
+}
+
+
+
+void smallVectorUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Small Vector Test**\n");
+
+    CuSuite *suite = createSmallVectorTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_SMALLVECTORTEST_H
+#define C_DATASTRUCTURES_SMALLVECTORTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void smallVectorUnitTest();
+
+#endif //C_DATASTRUCTURES_SMALLVECTORTEST_H
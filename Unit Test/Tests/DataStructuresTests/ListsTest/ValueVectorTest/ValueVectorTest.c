@@ -0,0 +1,276 @@
+#include "ValueVectorTest.h"
+
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../DataStructure/Lists/Headers/ValueVector.h"
+#include "../../../../../System/Utils.h"
+
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersVVT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+// a plain value item that is bigger than a pointer.
+
+typedef struct PointVVT {
+    double x;
+    double y;
+    int id;
+} PointVVT;
+
+
+
+
+void testInvalidValueVectorInitialization(CuTest *cuTest) {
+
+    valueVectorInitialization(0, 10, compareIntPointersVVT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    valueVectorInitialization(sizeof(int), 0, compareIntPointersVVT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testValueVectorPushAndGet(CuTest *cuTest) {
+
+    ValueVector *list = valueVectorInitialization(sizeof(int), 1, compareIntPointersVVT);
+
+    for (int i = 0; i < 1000; i++)
+        valueVectorPush(list, &i);
+
+    CuAssertIntEquals(cuTest, 1000, valueVectorGetLength(list));
+    CuAssertIntEquals(cuTest, 1024, list->length);
+
+    int *array = (int *) valueVectorGetArray(list);
+    for (int i = 0; i < 1000; i++) {
+        CuAssertIntEquals(cuTest, i, *(int *) valueVectorGet(list, i));
+        CuAssertIntEquals(cuTest, i, array[i]);
+    }
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, valueVectorGet(list, 1000));
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    valueVectorPush(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyValueVector(list);
+
+}
+
+
+void testValueVectorPop(CuTest *cuTest) {
+
+    ValueVector *list = valueVectorInitialization(sizeof(PointVVT), 4, NULL);
+
+    for (int i = 0; i < 10; i++) {
+        PointVVT point = {i * 0.5, i * 2.0, i};
+        valueVectorPush(list, &point);
+    }
+
+    PointVVT point;
+    valueVectorPop(list, &point);
+    CuAssertIntEquals(cuTest, 9, point.id);
+    CuAssertDblEquals(cuTest, 4.5, point.x, 0);
+    CuAssertDblEquals(cuTest, 18, point.y, 0);
+
+    valueVectorPop(list, NULL);
+    CuAssertIntEquals(cuTest, 8, valueVectorGetLength(list));
+    CuAssertIntEquals(cuTest, 7, ((PointVVT *) valueVectorGet(list, 7))->id);
+
+    clearValueVector(list);
+    CuAssertIntEquals(cuTest, 1, valueVectorIsEmpty(list));
+
+    ERROR_TEST->errorCode = -1;
+    valueVectorPop(list, &point);
+    CuAssertIntEquals(cuTest, EMPTY_DATA_STRUCTURE, ERROR_TEST->errorCode);
+
+    destroyValueVector(list);
+
+}
+
+
+void testValueVectorInsertAndErase(CuTest *cuTest) {
+
+    ValueVector *list = valueVectorInitialization(sizeof(int), 2, compareIntPointersVVT);
+
+    int values[] = {1, 3, 5};
+    for (int i = 0; i < 3; i++)
+        valueVectorPush(list, &values[i]);
+
+    int item = 0;
+    valueVectorInsert(list, 0, &item);
+    item = 2;
+    valueVectorInsert(list, 2, &item);
+    item = 6;
+    valueVectorInsert(list, 5, &item);
+
+    CuAssertIntEquals(cuTest, 6, valueVectorGetLength(list));
+    int expected[] = {0, 1, 2, 3, 5, 6};
+    CuAssertTrue(cuTest, memcmp(expected, valueVectorGetArray(list), sizeof(expected)) == 0);
+
+    ERROR_TEST->errorCode = -1;
+    valueVectorInsert(list, 7, &item);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    valueVectorErase(list, 0);
+    valueVectorErase(list, 4);
+    valueVectorErase(list, 1);
+
+    int expectedAfterErase[] = {1, 3, 5};
+    CuAssertIntEquals(cuTest, 3, valueVectorGetLength(list));
+    CuAssertTrue(cuTest, memcmp(expectedAfterErase, valueVectorGetArray(list), sizeof(expectedAfterErase)) == 0);
+
+    ERROR_TEST->errorCode = -1;
+    valueVectorErase(list, 3);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    item = 10;
+    valueVectorSet(list, 1, &item);
+    CuAssertIntEquals(cuTest, 10, *(int *) valueVectorGet(list, 1));
+
+    destroyValueVector(list);
+
+}
+
+
+void testValueVectorPushAndInsertOwnItem(CuTest *cuTest) {
+
+    ValueVector *list = valueVectorInitialization(sizeof(PointVVT), 2, NULL);
+
+    for (int i = 0; i < 2; i++) {
+        PointVVT point = {i * 0.5, i * 2.0, i};
+        valueVectorPush(list, &point);
+    }
+
+    // the vector is full, so pushing it's own item will move the memory before copying.
+    valueVectorPush(list, valueVectorGet(list, 0));
+    CuAssertIntEquals(cuTest, 3, valueVectorGetLength(list));
+    CuAssertIntEquals(cuTest, 4, list->length);
+    CuAssertIntEquals(cuTest, 0, ((PointVVT *) valueVectorGet(list, 2))->id);
+    CuAssertDblEquals(cuTest, 0, ((PointVVT *) valueVectorGet(list, 2))->y, 0);
+
+    valueVectorPush(list, valueVectorGet(list, 1));
+    CuAssertIntEquals(cuTest, 4, list->length);
+
+    // the vector is full again, and the inserted item is shifted by the insertion.
+    valueVectorInsert(list, 0, valueVectorGet(list, 1));
+    CuAssertIntEquals(cuTest, 5, valueVectorGetLength(list));
+    CuAssertIntEquals(cuTest, 8, list->length);
+
+    int expectedIds[] = {1, 0, 1, 0, 1};
+    for (int i = 0; i < 5; i++) {
+        CuAssertIntEquals(cuTest, expectedIds[i], ((PointVVT *) valueVectorGet(list, i))->id);
+        CuAssertDblEquals(cuTest, expectedIds[i] * 2.0, ((PointVVT *) valueVectorGet(list, i))->y, 0);
+    }
+
+    // an item before the insertion index isn't moved.
+    valueVectorInsert(list, 3, valueVectorGet(list, 1));
+    valueVectorSet(list, 0, valueVectorGet(list, 0));
+
+    int expectedIdsAfterInsert[] = {1, 0, 1, 0, 0, 1};
+    CuAssertIntEquals(cuTest, 6, valueVectorGetLength(list));
+    for (int i = 0; i < 6; i++)
+        CuAssertIntEquals(cuTest, expectedIdsAfterInsert[i], ((PointVVT *) valueVectorGet(list, i))->id);
+
+    destroyValueVector(list);
+
+}
+
+
+void testValueVectorSortAndBinarySearch(CuTest *cuTest) {
+
+    ValueVector *list = valueVectorInitialization(sizeof(int), 16, compareIntPointersVVT);
+
+    for (int i = 0; i < 1000; i++) {
+        int item = (i * 7919) % 1000 * 2;
+        valueVectorPush(list, &item);
+    }
+
+    valueVectorSort(list, compareIntPointersVVT);
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, i * 2, *(int *) valueVectorGet(list, i));
+
+    for (int i = 0; i < 2000; i++)
+        CuAssertIntEquals(cuTest, i % 2 == 0 ? i / 2 : -1, valueVectorBinarySearch(list, &i));
+
+    ERROR_TEST->errorCode = -1;
+    valueVectorSort(list, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyValueVector(list);
+
+    list = valueVectorInitialization(sizeof(int), 16, NULL);
+    int item = 0;
+    valueVectorPush(list, &item);
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertIntEquals(cuTest, -1, valueVectorBinarySearch(list, &item));
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    destroyValueVector(list);
+
+}
+
+
+void testDestroyValueVector(CuTest *cuTest) {
+
+    destroyValueVector(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createValueVectorTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidValueVectorInitialization);
+    SUITE_ADD_TEST(suite, testValueVectorPushAndGet);
+    SUITE_ADD_TEST(suite, testValueVectorPop);
+    SUITE_ADD_TEST(suite, testValueVectorInsertAndErase);
+    SUITE_ADD_TEST(suite, testValueVectorPushAndInsertOwnItem);
+    SUITE_ADD_TEST(suite, testValueVectorSortAndBinarySearch);
+    SUITE_ADD_TEST(suite, testDestroyValueVector);
+
+    return suite;
+
+}
+
+
+
+void valueVectorUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Value Vector Test**\n");
+
+    CuSuite *suite = createValueVectorTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
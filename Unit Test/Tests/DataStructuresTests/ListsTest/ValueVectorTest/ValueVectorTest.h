@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_VALUEVECTORTEST_H
+#define C_DATASTRUCTURES_VALUEVECTORTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void valueVectorUnitTest();
+
+#endif //C_DATASTRUCTURES_VALUEVECTORTEST_H
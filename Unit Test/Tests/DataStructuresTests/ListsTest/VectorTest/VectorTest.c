@@ -26,6 +26,20 @@ int *generateIntPointerVT(int integer) {
 
 
 
+/** This function will take an integer pointer,
+ * then it will return one if the integer is even, other wise it will return zero.
+ *
+ * @param integer the integer pointer
+ * @return it will return one if the integer is even, other wise it will return zero
+ */
+
+int isEvenIntPointerVT(const void *integer) {
+    return *(int *) integer % 2 == 0;
+}
+
+
+
+
 /** This function will compare to integers pointers,
  * then it will return zero if they are equal, negative number if the second integer is bigger,
  * and positive number if the first integer is bigger.
@@ -42,6 +56,61 @@ int compareIntPointersVT(const void *a, const void *b) {
 
 
 
+/** This function will take an integer pointer,
+ * then it will increment the integer by one.
+ *
+ * @param integer the integer pointer
+ */
+
+void incrementIntPointerVT(void *integer) {
+    (*(int *) integer)++;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will allocate a new integer that holds the double of the integer value, and return it.
+ *
+ * @param integer the integer pointer
+ * @return it will return the new allocated integer pointer
+ */
+
+void *doubleIntPointerVT(const void *integer) {
+    return generateIntPointerVT(*(int *) integer * 2);
+}
+
+
+
+
+/** This function will take a partial sum pointer, and an integer pointer,
+ * then it will add the integer to the partial sum.
+ *
+ * @param partial the partial sum pointer
+ * @param integer the integer pointer
+ */
+
+void sumIntPointersVT(void *partial, const void *integer) {
+    *(long long *) partial += *(int *) integer;
+}
+
+
+
+
+/** This function will take a sum pointer, and a partial sum pointer,
+ * then it will add the partial sum to the sum.
+ *
+ * @param sum the sum pointer
+ * @param partial the partial sum pointer
+ */
+
+void combineSumsVT(void *sum, const void *partial) {
+    *(long long *) sum += *(long long *) partial;
+}
+
+
+
+
 /** This function will take a char array
  * then it will allocate a new one and copy the original char array into the new one,
  * and finally return the new allocated char array.
@@ -308,6 +377,233 @@ void testVectorExpansion(CuTest *cuTest) {
 
 
 
+void testVectorReserveAndShrinkToFit(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(1, free, compareIntPointersVT);
+
+    vectorReserve(vector, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    vectorReserve(vector, 100);
+    CuAssertIntEquals(cuTest, 100, vectorGetCapacity(vector));
+
+    vectorReserve(vector, 10);
+    CuAssertIntEquals(cuTest, 100, vectorGetCapacity(vector));
+
+    for (int i = 0; i < 100; i++)
+        vectorAdd(vector, generateIntPointerVT(i));
+
+    CuAssertIntEquals(cuTest, 100, vectorGetCapacity(vector));
+
+    for (int i = 0; i < 90; i++)
+        vectorRemove(vector);
+
+    vectorShrinkToFit(vector);
+    CuAssertIntEquals(cuTest, 10, vectorGetCapacity(vector));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) vectorGet(vector, i));
+
+    clearVector(vector);
+    vectorShrinkToFit(vector);
+    CuAssertIntEquals(cuTest, 1, vectorGetCapacity(vector));
+
+    destroyVector(vector);
+
+}
+
+
+
+
+void testVectorGrowthPolicy(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(2, free, compareIntPointersVT);
+
+    vectorSetGrowthPolicy(vector, 1, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    vectorSetGrowthPolicy(vector, 2, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    // the length doubles until it reaches the maximum growth, then it grows by the maximum growth.
+    vectorSetGrowthPolicy(vector, 2, 8);
+    int expectedCapacities[] = {2, 4, 8, 16, 24, 32};
+    for (int i = 0, expectedIndex = 0; i < 32; i++) {
+        if (i == vectorGetCapacity(vector))
+            expectedIndex++;
+
+        vectorAdd(vector, generateIntPointerVT(i));
+        CuAssertIntEquals(cuTest, expectedCapacities[expectedIndex], vectorGetCapacity(vector));
+    }
+
+    // adding an array grows the memory one time only, to fit all the items.
+    void *items[100];
+    for (int i = 0; i < 100; i++)
+        items[i] = generateIntPointerVT(i + 32);
+
+    vectorAddAll(vector, items, 100);
+    CuAssertIntEquals(cuTest, 132, vectorGetLength(vector));
+    CuAssertIntEquals(cuTest, 132, vectorGetCapacity(vector));
+    for (int i = 0; i < 132; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) vectorGet(vector, i));
+
+    destroyVector(vector);
+
+}
+
+
+
+
+void testVectorInsertRange(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(2, free, compareIntPointersVT);
+
+    vectorInsertRange(NULL, 0, NULL, 0);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    vectorInsertRange(vector, 0, NULL, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 4; i++)
+        vectorAdd(vector, generateIntPointerVT(i * 10));
+
+    void *items[3] = {generateIntPointerVT(11), generateIntPointerVT(12), generateIntPointerVT(13)};
+    vectorInsertRange(vector, 5, items, 3);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    vectorInsertRange(vector, 2, items, 3);
+
+    // 0, 10, 11, 12, 13, 20, 30
+    int expected[] = {0, 10, 11, 12, 13, 20, 30};
+    CuAssertIntEquals(cuTest, 7, vectorGetLength(vector));
+    for (int i = 0; i < 7; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) vectorGet(vector, i));
+
+    void *lastItems[2] = {generateIntPointerVT(40), generateIntPointerVT(50)};
+    vectorInsertRange(vector, 7, lastItems, 2);
+    CuAssertIntEquals(cuTest, 9, vectorGetLength(vector));
+    CuAssertIntEquals(cuTest, 50, *(int *) vectorGet(vector, 8));
+
+    destroyVector(vector);
+
+}
+
+
+
+
+void testVectorRemoveRange(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(2, free, compareIntPointersVT);
+
+    for (int i = 0; i < 10; i++)
+        vectorAdd(vector, generateIntPointerVT(i));
+
+    vectorRemoveRange(vector, 5, 11);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    vectorRemoveRange(vector, 6, 5);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    vectorRemoveRange(vector, 2, 5);
+
+    // 0, 1, 5, 6, 7, 8, 9
+    int expected[] = {0, 1, 5, 6, 7, 8, 9};
+    CuAssertIntEquals(cuTest, 7, vectorGetLength(vector));
+    for (int i = 0; i < 7; i++)
+        CuAssertIntEquals(cuTest, expected[i], *(int *) vectorGet(vector, i));
+
+    int *lastItem = (int *) vectorGet(vector, 6);
+    vectorRemoveRangeWtFr(vector, 6, 7);
+    CuAssertIntEquals(cuTest, 6, vectorGetLength(vector));
+    CuAssertIntEquals(cuTest, 9, *lastItem);
+    free(lastItem);
+
+    vectorRemoveRange(vector, 0, 6);
+    CuAssertIntEquals(cuTest, 1, vectorIsEmpty(vector));
+
+    destroyVector(vector);
+
+}
+
+
+
+
+void testVectorRemoveIf(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(2, free, compareIntPointersVT);
+
+    vectorRemoveIf(vector, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 20; i++)
+        vectorAdd(vector, generateIntPointerVT(i));
+
+    CuAssertIntEquals(cuTest, 10, vectorRemoveIf(vector, isEvenIntPointerVT));
+    CuAssertIntEquals(cuTest, 10, vectorGetLength(vector));
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i * 2 + 1, *(int *) vectorGet(vector, i));
+
+    CuAssertIntEquals(cuTest, 0, vectorRemoveIf(vector, isEvenIntPointerVT));
+
+    int *evenItem = generateIntPointerVT(100);
+    vectorAdd(vector, evenItem);
+    CuAssertIntEquals(cuTest, 1, vectorRemoveIfWtFr(vector, isEvenIntPointerVT));
+    CuAssertIntEquals(cuTest, 100, *evenItem);
+    free(evenItem);
+
+    destroyVector(vector);
+
+}
+
+
+
+
+void testVectorParallelOperations(CuTest *cuTest) {
+    Vector *vector = vectorInitialization(2, free, compareIntPointersVT);
+
+    vectorParallelForEach(vector, NULL, 4);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    vectorParallelForEach(vector, incrementIntPointerVT, 0);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 10000; i++)
+        vectorAdd(vector, generateIntPointerVT(i));
+
+    vectorParallelForEach(vector, incrementIntPointerVT, 4);
+    for (int i = 0; i < 10000; i++)
+        CuAssertIntEquals(cuTest, i + 1, *(int *) vectorGet(vector, i));
+
+    void **output = (void **) malloc(sizeof(void *) * 10000);
+    vectorParallelMap(vector, output, doubleIntPointerVT, 3);
+    for (int i = 0; i < 10000; i++) {
+        CuAssertIntEquals(cuTest, (i + 1) * 2, *(int *) output[i]);
+        free(output[i]);
+    }
+
+    // 1, 2, 3, ... 10000 so the even items are 2, 4, 6, ... 10000.
+    CuAssertIntEquals(cuTest, 5000, vectorParallelFilter(vector, output, isEvenIntPointerVT, 7));
+    for (int i = 0; i < 5000; i++)
+        CuAssertIntEquals(cuTest, (i + 1) * 2, *(int *) output[i]);
+
+    free(output);
+
+    long long sum = 0;
+    vectorParallelReduce(vector, &sum, sizeof(long long), sumIntPointersVT, combineSumsVT, 8);
+    CuAssertTrue(cuTest, sum == 10000LL * 10001 / 2);
+
+    // more threads than items.
+    vectorRemoveRange(vector, 3, 10000);
+    sum = 0;
+    vectorParallelReduce(vector, &sum, sizeof(long long), sumIntPointersVT, combineSumsVT, 16);
+    CuAssertTrue(cuTest, sum == 6);
+
+    clearVector(vector);
+    sum = 0;
+    vectorParallelReduce(vector, &sum, sizeof(long long), sumIntPointersVT, combineSumsVT, 4);
+    CuAssertTrue(cuTest, sum == 0);
+
+    destroyVector(vector);
+
+}
+
+
+
+
 void testVectorContains(CuTest *cuTest) {
     Vector *vector = vectorInitialization(1, free, compareIntPointersVT);
 
@@ -836,6 +1132,12 @@ CuSuite *createVectorTestsSuite() {
     SUITE_ADD_TEST(suite, testVectorRemoveAtIndex);
     SUITE_ADD_TEST(suite, testVectorRemoveAtIndexWtoFr);
     SUITE_ADD_TEST(suite, testVectorExpansion);
+    SUITE_ADD_TEST(suite, testVectorReserveAndShrinkToFit);
+    SUITE_ADD_TEST(suite, testVectorGrowthPolicy);
+    SUITE_ADD_TEST(suite, testVectorInsertRange);
+    SUITE_ADD_TEST(suite, testVectorRemoveRange);
+    SUITE_ADD_TEST(suite, testVectorRemoveIf);
+    SUITE_ADD_TEST(suite, testVectorParallelOperations);
     SUITE_ADD_TEST(suite, testVectorContains);
     SUITE_ADD_TEST(suite, testVectorGetIndex);
     SUITE_ADD_TEST(suite, testVectorGetLastIndex);
@@ -294,6 +294,44 @@ void testLinkedListQueueToArray(CuTest *cuTest) {
 
 
 
+void testLinkedListQueueCursor(CuTest *cuTest) {
+
+    LinkedListQueue *queue = linkedListQueueInitialization(free);
+
+    for (int i = 0; i < 6; i++)
+        lLQueueEnqueue(queue, generateIntPointerLLQT(i));
+
+    LinkedListCursor cursor;
+    lLQueueCursorInitialization(&cursor, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    // drop the even items from the middle of the queue.
+    lLQueueCursorInitialization(&cursor, queue);
+    for (int *item; (item = (int *) linkedListCursorGet(&cursor)) != NULL; ) {
+        if (*item % 2 == 0)
+            linkedListCursorRemove(&cursor);
+        else
+            linkedListCursorNext(&cursor);
+
+    }
+
+    CuAssertIntEquals(cuTest, 3, lLQueueGetLength(queue));
+
+    for (int i = 0; i < 3; i++) {
+        int *item = (int *) lLQueueDequeue(queue);
+        CuAssertIntEquals(cuTest, i * 2 + 1, *item);
+        free(item);
+    }
+
+    destroyLLQueue(queue);
+
+}
+
+
+
+
+
+
 void testClearLinkedListQueue(CuTest *cuTest) {
 
     LinkedListQueue *llQueue = linkedListQueueInitialization(free);
@@ -462,6 +500,7 @@ CuSuite *createLinkedListQueueTestsSuite() {
     SUITE_ADD_TEST(suite, testLinkedListQueueGetLength);
     SUITE_ADD_TEST(suite, testLinkedListQueueIsEmpty);
     SUITE_ADD_TEST(suite, testLinkedListQueueToArray);
+    SUITE_ADD_TEST(suite, testLinkedListQueueCursor);
     SUITE_ADD_TEST(suite, testClearLinkedListQueue);
     SUITE_ADD_TEST(suite, testDestroyLinkedListQueue);
 
@@ -0,0 +1,421 @@
+#include "MPMCQueueTest.h"
+#include <pthread.h>
+#include <sched.h>
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Queues/Headers/MPMCQueue.h"
+
+
+
+#define MPMC_QUEUE_TEST_THREADS 4
+#define MPMC_QUEUE_TEST_ITEMS_PER_THREAD 20000
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerMPMCQT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** The parameters of the mpmc queue test threads. */
+
+typedef struct MPMCQueueTestThreadArgs {
+    MPMCQueue *queue;
+    int threadIndex;
+    int blocking;
+    char *seen;
+    int duplicatesCount;
+} MPMCQueueTestThreadArgs;
+
+
+
+
+/** This function will enqueue a unique range of numbers as pointers, and it will be called from many producer threads.
+ *
+ * @param args the thread arguments pointer
+ * @return it will return NULL
+ */
+
+void *producerThreadFunMPMCQT(void *args) {
+    MPMCQueueTestThreadArgs *threadArgs = (MPMCQueueTestThreadArgs *) args;
+    int start = threadArgs->threadIndex * MPMC_QUEUE_TEST_ITEMS_PER_THREAD + 1;
+
+    for (int i = start; i < start + MPMC_QUEUE_TEST_ITEMS_PER_THREAD; i++) {
+        if (threadArgs->blocking)
+            mpmcQueueEnqueue(threadArgs->queue, (void *) (intptr_t) i);
+        else {
+            while (!mpmcQueueTryEnqueue(threadArgs->queue, (void *) (intptr_t) i))
+                sched_yield();
+
+        }
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+/** This function will dequeue MPMC_QUEUE_TEST_ITEMS_PER_THREAD items, and it will mark every item in the shared seen array,
+ * and it will count the items that were seen before, and it will be called from many consumer threads.
+ *
+ * @param args the thread arguments pointer
+ * @return it will return NULL
+ */
+
+void *consumerThreadFunMPMCQT(void *args) {
+    MPMCQueueTestThreadArgs *threadArgs = (MPMCQueueTestThreadArgs *) args;
+
+    for (int i = 0; i < MPMC_QUEUE_TEST_ITEMS_PER_THREAD; i++) {
+        void *item;
+
+        if (threadArgs->blocking)
+            item = mpmcQueueDequeue(threadArgs->queue);
+        else {
+            while ((item = mpmcQueueTryDequeue(threadArgs->queue)) == NULL)
+                sched_yield();
+
+        }
+
+        // every consumer writes different items, so the seen array doesn't need a lock.
+        if (threadArgs->seen[(intptr_t) item])
+            threadArgs->duplicatesCount++;
+
+        threadArgs->seen[(intptr_t) item] = 1;
+    }
+
+    return NULL;
+
+}
+
+
+
+
+/** This function will run MPMC_QUEUE_TEST_THREADS producers and MPMC_QUEUE_TEST_THREADS consumers on the queue,
+ * then it will return the number of the items that were dequeued more than once or never dequeued.
+ *
+ * @param queue the queue address
+ * @param blocking one to use the blocking functions, or zero to use the try functions
+ * @return it will return the number of the wrong items
+ */
+
+int runProducersAndConsumersMPMCQT(MPMCQueue *queue, int blocking) {
+    pthread_t producers[MPMC_QUEUE_TEST_THREADS], consumers[MPMC_QUEUE_TEST_THREADS];
+    MPMCQueueTestThreadArgs args[MPMC_QUEUE_TEST_THREADS];
+    int itemsCount = MPMC_QUEUE_TEST_THREADS * MPMC_QUEUE_TEST_ITEMS_PER_THREAD;
+    char *seen = (char *) calloc(itemsCount + 1, sizeof(char));
+
+    for (int i = 0; i < MPMC_QUEUE_TEST_THREADS; i++) {
+        args[i].queue = queue;
+        args[i].threadIndex = i;
+        args[i].blocking = blocking;
+        args[i].seen = seen;
+        args[i].duplicatesCount = 0;
+        pthread_create(consumers + i, NULL, consumerThreadFunMPMCQT, args + i);
+    }
+
+    for (int i = 0; i < MPMC_QUEUE_TEST_THREADS; i++)
+        pthread_create(producers + i, NULL, producerThreadFunMPMCQT, args + i);
+
+    for (int i = 0; i < MPMC_QUEUE_TEST_THREADS; i++) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    int wrongItemsCount = 0;
+    for (int i = 0; i < MPMC_QUEUE_TEST_THREADS; i++)
+        wrongItemsCount += args[i].duplicatesCount;
+
+    for (int i = 1; i <= itemsCount; i++)
+        wrongItemsCount += !seen[i];
+
+    free(seen);
+
+    return wrongItemsCount;
+
+}
+
+
+
+
+
+void testInvalidMPMCQueueInitialization(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(0, free);
+    CuAssertPtrEquals(cuTest, NULL, queue);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    queue = mpmcQueueInitialization(8, NULL);
+    CuAssertPtrEquals(cuTest, NULL, queue);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+void testValidMPMCQueueInitialization(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(10, free);
+    CuAssertPtrNotNull(cuTest, queue);
+
+    CuAssertIntEquals(cuTest, 16, mpmcQueueGetCapacity(queue));
+    CuAssertIntEquals(cuTest, 0, mpmcQueueGetLength(queue));
+    CuAssertIntEquals(cuTest, 1, mpmcQueueIsEmpty(queue));
+
+    destroyMPMCQueue(queue);
+
+    queue = mpmcQueueInitialization(1, free);
+    CuAssertIntEquals(cuTest, 2, mpmcQueueGetCapacity(queue));
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testMPMCQueueTryEnqueueAndDequeue(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(4, free);
+
+    mpmcQueueTryEnqueue(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    mpmcQueueTryEnqueue(queue, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    mpmcQueueTryDequeue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    CuAssertPtrEquals(cuTest, NULL, mpmcQueueTryDequeue(queue));
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++)
+            CuAssertIntEquals(cuTest, 1, mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(round * 4 + i)));
+
+        int *extraItem = generateIntPointerMPMCQT(-1);
+        CuAssertIntEquals(cuTest, 0, mpmcQueueTryEnqueue(queue, extraItem));
+        free(extraItem);
+
+        CuAssertIntEquals(cuTest, 4, mpmcQueueGetLength(queue));
+
+        for (int i = 0; i < 4; i++) {
+            int *item = (int *) mpmcQueueTryDequeue(queue);
+            CuAssertIntEquals(cuTest, round * 4 + i, *item);
+            free(item);
+        }
+
+        CuAssertPtrEquals(cuTest, NULL, mpmcQueueTryDequeue(queue));
+    }
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testMPMCQueueBlockingEnqueueAndDequeue(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(4, free);
+
+    mpmcQueueEnqueue(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    mpmcQueueEnqueue(queue, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    mpmcQueueDequeue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 4; i++)
+        mpmcQueueEnqueue(queue, generateIntPointerMPMCQT(i));
+
+    for (int i = 0; i < 4; i++) {
+        int *item = (int *) mpmcQueueDequeue(queue);
+        CuAssertIntEquals(cuTest, i, *item);
+        free(item);
+    }
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testMPMCQueueStats(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(2, free);
+    MPMCQueueStats stats;
+
+    mpmcQueueGetStats(NULL, &stats);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    mpmcQueueGetStats(queue, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    mpmcQueueResetStats(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    mpmcQueueTryDequeue(queue);
+    mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(1));
+    mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(2));
+
+    int *extraItem = generateIntPointerMPMCQT(3);
+    mpmcQueueTryEnqueue(queue, extraItem);
+    mpmcQueueTryEnqueue(queue, extraItem);
+    free(extraItem);
+
+    mpmcQueueGetStats(queue, &stats);
+
+    #ifdef MPMC_QUEUE_STATS
+        CuAssertIntEquals(cuTest, 2, (int) stats.fullFailures);
+        CuAssertIntEquals(cuTest, 1, (int) stats.emptyFailures);
+    #else
+        CuAssertIntEquals(cuTest, 0, (int) stats.fullFailures);
+        CuAssertIntEquals(cuTest, 0, (int) stats.emptyFailures);
+    #endif
+
+    CuAssertIntEquals(cuTest, 0, (int) stats.producerParks);
+    CuAssertIntEquals(cuTest, 0, (int) stats.consumerParks);
+
+    mpmcQueueResetStats(queue);
+    mpmcQueueGetStats(queue, &stats);
+    CuAssertIntEquals(cuTest, 0, (int) stats.fullFailures);
+    CuAssertIntEquals(cuTest, 0, (int) stats.emptyFailures);
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testMPMCQueueMultiThreaded(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(64, free);
+
+    CuAssertIntEquals(cuTest, 0, runProducersAndConsumersMPMCQT(queue, 0));
+    CuAssertIntEquals(cuTest, 1, mpmcQueueIsEmpty(queue));
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testMPMCQueueBlockingMultiThreaded(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(2, free);
+
+    CuAssertIntEquals(cuTest, 0, runProducersAndConsumersMPMCQT(queue, 1));
+    CuAssertIntEquals(cuTest, 1, mpmcQueueIsEmpty(queue));
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testClearMPMCQueue(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(8, free);
+
+    clearMPMCQueue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 8; i++)
+        mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(i));
+
+    free(mpmcQueueTryDequeue(queue));
+    CuAssertIntEquals(cuTest, 7, mpmcQueueGetLength(queue));
+
+    clearMPMCQueue(queue);
+
+    CuAssertIntEquals(cuTest, 0, mpmcQueueGetLength(queue));
+    CuAssertIntEquals(cuTest, 1, mpmcQueueIsEmpty(queue));
+
+    for (int i = 0; i < 8; i++)
+        CuAssertIntEquals(cuTest, 1, mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(i)));
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+void testDestroyMPMCQueue(CuTest *cuTest) {
+
+    MPMCQueue *queue = mpmcQueueInitialization(8, free);
+
+    destroyMPMCQueue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 4; i++)
+        mpmcQueueTryEnqueue(queue, generateIntPointerMPMCQT(i));
+
+    destroyMPMCQueue(queue);
+
+}
+
+
+
+
+
+CuSuite *createMPMCQueueTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidMPMCQueueInitialization);
+    SUITE_ADD_TEST(suite, testValidMPMCQueueInitialization);
+    SUITE_ADD_TEST(suite, testMPMCQueueTryEnqueueAndDequeue);
+    SUITE_ADD_TEST(suite, testMPMCQueueBlockingEnqueueAndDequeue);
+    SUITE_ADD_TEST(suite, testMPMCQueueStats);
+    SUITE_ADD_TEST(suite, testMPMCQueueMultiThreaded);
+    SUITE_ADD_TEST(suite, testMPMCQueueBlockingMultiThreaded);
+    SUITE_ADD_TEST(suite, testClearMPMCQueue);
+    SUITE_ADD_TEST(suite, testDestroyMPMCQueue);
+
+    return suite;
+
+}
+
+
+
+void mpmcQueueUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**MPMC Queue Test**\n");
+
+    CuSuite *suite = createMPMCQueueTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
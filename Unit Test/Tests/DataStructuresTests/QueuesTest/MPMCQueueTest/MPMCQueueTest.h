@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_MPMCQUEUETEST_H
+#define C_DATASTRUCTURES_MPMCQUEUETEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void mpmcQueueUnitTest();
+
+#endif //C_DATASTRUCTURES_MPMCQUEUETEST_H
@@ -343,6 +343,88 @@ void testDestroyQueue(CuTest *cuTest) {
 
 
 
+void testQueueWrapAround(CuTest *cuTest) {
+
+    Queue *queue = queueInitialization(free);
+
+    for (int i = 0; i < QUEUE_MIN_CAPACITY; i++)
+        queueEnqueue(queue, generateIntPointerQT(i + 1));
+
+    for (int i = 0; i < QUEUE_MIN_CAPACITY / 2; i++)
+        free(queueDequeue(queue));
+
+    for (int i = QUEUE_MIN_CAPACITY; i < QUEUE_MIN_CAPACITY + QUEUE_MIN_CAPACITY / 2; i++)
+        queueEnqueue(queue, generateIntPointerQT(i + 1));
+
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY, queue->allocated);
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY, queueGetLength(queue));
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY / 2 + 1, *(int *) queuePeek(queue));
+
+    int **arr = (int **) queueToArray(queue);
+    for (int i = 0; i < queueGetLength(queue); i++)
+        CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY / 2 + i + 1, *arr[i]);
+
+    free(arr);
+
+    queueEnqueue(queue, generateIntPointerQT(QUEUE_MIN_CAPACITY + QUEUE_MIN_CAPACITY / 2 + 1));
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY * 2, queue->allocated);
+
+    for (int i = QUEUE_MIN_CAPACITY / 2; i <= QUEUE_MIN_CAPACITY + QUEUE_MIN_CAPACITY / 2; i++) {
+        int *item = (int *) queueDequeue(queue);
+        CuAssertIntEquals(cuTest, i + 1, *item);
+        free(item);
+    }
+
+    CuAssertIntEquals(cuTest, 1, queueIsEmpty(queue));
+
+    queueDestroy(queue);
+
+}
+
+
+
+
+
+void testQueueShrinkPolicy(CuTest *cuTest) {
+
+    Queue *queue = queueInitialization(free);
+
+    queueSetShrinkPolicy(NULL, 1);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < QUEUE_MIN_CAPACITY * 8; i++)
+        queueEnqueue(queue, generateIntPointerQT(i + 1));
+
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY * 8, queue->allocated);
+
+    for (int i = 0; i < QUEUE_MIN_CAPACITY * 6; i++)
+        free(queueDequeue(queue));
+
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY * 8, queue->allocated);
+
+    queueSetShrinkPolicy(queue, 1);
+
+    free(queueDequeue(queue));
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY * 4, queue->allocated);
+
+    for (int i = QUEUE_MIN_CAPACITY * 6 + 1; i < QUEUE_MIN_CAPACITY * 8; i++) {
+        int *item = (int *) queueDequeue(queue);
+        CuAssertIntEquals(cuTest, i + 1, *item);
+        free(item);
+    }
+
+    CuAssertIntEquals(cuTest, QUEUE_MIN_CAPACITY, queue->allocated);
+    CuAssertIntEquals(cuTest, 0, queueGetLength(queue));
+
+    queueDestroy(queue);
+
+}
+
+
+
+
+
+
 typedef struct QueueTestStruct {
 
     int iData;
@@ -463,6 +545,8 @@ CuSuite *createQueueTestsSuite() {
     SUITE_ADD_TEST(suite, testQueueToArray);
     SUITE_ADD_TEST(suite, testClearQueue);
     SUITE_ADD_TEST(suite, testDestroyQueue);
+    SUITE_ADD_TEST(suite, testQueueWrapAround);
+    SUITE_ADD_TEST(suite, testQueueShrinkPolicy);
 
     SUITE_ADD_TEST(suite, generalQueueTest);
 
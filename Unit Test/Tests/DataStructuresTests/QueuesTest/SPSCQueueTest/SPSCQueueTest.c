@@ -0,0 +1,345 @@
+#include "SPSCQueueTest.h"
+#include <pthread.h>
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Queues/Headers/SPSCQueue.h"
+
+
+
+#define SPSC_QUEUE_TEST_ITEMS 100000
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerSPSCQT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will enqueue the numbers from one to SPSC_QUEUE_TEST_ITEMS as pointers,
+ * while alternating between the single and the batch enqueue, and it will be called from the producer thread.
+ *
+ * @param queue the queue address
+ * @return it will return NULL
+ */
+
+void *producerThreadFunSPSCQT(void *queue) {
+    void *batch[7];
+    int next = 1;
+
+    while (next <= SPSC_QUEUE_TEST_ITEMS) {
+        if (next % 2 == 0) {
+            if (spscQueueTryEnqueue((SPSCQueue *) queue, (void *) (intptr_t) next))
+                next++;
+
+        } else {
+            int batchLength = 0;
+            while (batchLength < 7 && next + batchLength <= SPSC_QUEUE_TEST_ITEMS) {
+                batch[batchLength] = (void *) (intptr_t) (next + batchLength);
+                batchLength++;
+            }
+
+            next += spscQueueEnqueueBatch((SPSCQueue *) queue, batch, batchLength);
+        }
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+/** The parameters of the spsc queue test consumer thread. */
+
+typedef struct SPSCQueueTestConsumerArgs {
+    SPSCQueue *queue;
+    int outOfOrderCount;
+} SPSCQueueTestConsumerArgs;
+
+
+
+
+/** This function will dequeue SPSC_QUEUE_TEST_ITEMS items, while alternating between the single and the batch dequeue,
+ * and it will count the items that didn't come in the enqueue order, and it will be called from the consumer thread.
+ *
+ * @param args the consumer arguments pointer
+ * @return it will return NULL
+ */
+
+void *consumerThreadFunSPSCQT(void *args) {
+    SPSCQueueTestConsumerArgs *consumerArgs = (SPSCQueueTestConsumerArgs *) args;
+    void *batch[5];
+    int expected = 1;
+
+    while (expected <= SPSC_QUEUE_TEST_ITEMS) {
+        if (expected % 3 == 0) {
+            void *item = spscQueueTryDequeue(consumerArgs->queue);
+            if (item != NULL) {
+                if ((int) (intptr_t) item != expected)
+                    consumerArgs->outOfOrderCount++;
+
+                expected++;
+            }
+
+        } else {
+            int batchLength = spscQueueDequeueBatch(consumerArgs->queue, batch, 5);
+            for (int i = 0; i < batchLength; i++, expected++) {
+                if ((int) (intptr_t) batch[i] != expected)
+                    consumerArgs->outOfOrderCount++;
+
+            }
+
+        }
+
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+void testInvalidSPSCQueueInitialization(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(0, free);
+    CuAssertPtrEquals(cuTest, NULL, queue);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    queue = spscQueueInitialization(8, NULL);
+    CuAssertPtrEquals(cuTest, NULL, queue);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+void testValidSPSCQueueInitialization(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(10, free);
+    CuAssertPtrNotNull(cuTest, queue);
+
+    CuAssertIntEquals(cuTest, 16, spscQueueGetCapacity(queue));
+    CuAssertIntEquals(cuTest, 0, spscQueueGetLength(queue));
+    CuAssertIntEquals(cuTest, 1, spscQueueIsEmpty(queue));
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+void testSPSCQueueTryEnqueueAndDequeue(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(4, free);
+
+    spscQueueTryEnqueue(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    spscQueueTryEnqueue(queue, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    spscQueueTryDequeue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    CuAssertPtrEquals(cuTest, NULL, spscQueueTryDequeue(queue));
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++)
+            CuAssertIntEquals(cuTest, 1, spscQueueTryEnqueue(queue, generateIntPointerSPSCQT(round * 4 + i)));
+
+        int *extraItem = generateIntPointerSPSCQT(-1);
+        CuAssertIntEquals(cuTest, 0, spscQueueTryEnqueue(queue, extraItem));
+        free(extraItem);
+
+        CuAssertIntEquals(cuTest, 4, spscQueueGetLength(queue));
+
+        for (int i = 0; i < 4; i++) {
+            int *item = (int *) spscQueueTryDequeue(queue);
+            CuAssertIntEquals(cuTest, round * 4 + i, *item);
+            free(item);
+        }
+
+        CuAssertPtrEquals(cuTest, NULL, spscQueueTryDequeue(queue));
+    }
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+void testSPSCQueueBatch(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(8, free);
+    void *items[10];
+    int *output[10];
+
+    spscQueueEnqueueBatch(NULL, items, 1);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    spscQueueEnqueueBatch(queue, NULL, 1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    spscQueueDequeueBatch(queue, NULL, 1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 5; i++)
+        spscQueueTryEnqueue(queue, generateIntPointerSPSCQT(i));
+
+    CuAssertIntEquals(cuTest, 5, spscQueueDequeueBatch(queue, (void **) output, 10));
+    for (int i = 0; i < 5; i++) {
+        CuAssertIntEquals(cuTest, i, *output[i]);
+        free(output[i]);
+    }
+
+    for (int i = 0; i < 10; i++)
+        items[i] = generateIntPointerSPSCQT(i + 5);
+
+    // the batch wraps around the end of the ring memory, and only the first eight items can fit.
+    CuAssertIntEquals(cuTest, 8, spscQueueEnqueueBatch(queue, items, 10));
+    CuAssertIntEquals(cuTest, 0, spscQueueEnqueueBatch(queue, items + 8, 2));
+
+    CuAssertIntEquals(cuTest, 3, spscQueueDequeueBatch(queue, (void **) output, 3));
+    CuAssertIntEquals(cuTest, 2, spscQueueEnqueueBatch(queue, items + 8, 2));
+
+    CuAssertIntEquals(cuTest, 7, spscQueueDequeueBatch(queue, (void **) output + 3, 10));
+    for (int i = 0; i < 10; i++) {
+        CuAssertIntEquals(cuTest, i + 5, *output[i]);
+        free(output[i]);
+    }
+
+    CuAssertIntEquals(cuTest, 0, spscQueueDequeueBatch(queue, (void **) output, 10));
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+void testSPSCQueueMultiThreaded(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(64, free);
+
+    pthread_t producer, consumer;
+    SPSCQueueTestConsumerArgs consumerArgs;
+    consumerArgs.queue = queue;
+    consumerArgs.outOfOrderCount = 0;
+
+    pthread_create(&consumer, NULL, consumerThreadFunSPSCQT, &consumerArgs);
+    pthread_create(&producer, NULL, producerThreadFunSPSCQT, queue);
+
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    CuAssertIntEquals(cuTest, 0, consumerArgs.outOfOrderCount);
+    CuAssertIntEquals(cuTest, 1, spscQueueIsEmpty(queue));
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+void testClearSPSCQueue(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(8, free);
+
+    clearSPSCQueue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 6; i++)
+        spscQueueTryEnqueue(queue, generateIntPointerSPSCQT(i));
+
+    free(spscQueueTryDequeue(queue));
+    CuAssertIntEquals(cuTest, 5, spscQueueGetLength(queue));
+
+    clearSPSCQueue(queue);
+
+    CuAssertIntEquals(cuTest, 0, spscQueueGetLength(queue));
+    CuAssertIntEquals(cuTest, 1, spscQueueIsEmpty(queue));
+
+    for (int i = 0; i < 8; i++)
+        CuAssertIntEquals(cuTest, 1, spscQueueTryEnqueue(queue, generateIntPointerSPSCQT(i)));
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+void testDestroySPSCQueue(CuTest *cuTest) {
+
+    SPSCQueue *queue = spscQueueInitialization(8, free);
+
+    destroySPSCQueue(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 4; i++)
+        spscQueueTryEnqueue(queue, generateIntPointerSPSCQT(i));
+
+    destroySPSCQueue(queue);
+
+}
+
+
+
+
+
+CuSuite *createSPSCQueueTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidSPSCQueueInitialization);
+    SUITE_ADD_TEST(suite, testValidSPSCQueueInitialization);
+    SUITE_ADD_TEST(suite, testSPSCQueueTryEnqueueAndDequeue);
+    SUITE_ADD_TEST(suite, testSPSCQueueBatch);
+    SUITE_ADD_TEST(suite, testSPSCQueueMultiThreaded);
+    SUITE_ADD_TEST(suite, testClearSPSCQueue);
+    SUITE_ADD_TEST(suite, testDestroySPSCQueue);
+
+    return suite;
+
+}
+
+
+
+void spscQueueUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**SPSC Queue Test**\n");
+
+    CuSuite *suite = createSPSCQueueTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_SPSCQUEUETEST_H
+#define C_DATASTRUCTURES_SPSCQUEUETEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void spscQueueUnitTest();
+
+#endif //C_DATASTRUCTURES_SPSCQUEUETEST_H
@@ -3,6 +3,7 @@
 #include "../../../../../System/Utils.h"
 #include "../../../../../DataStructure/Strings/Headers/String.h"
 #include "../../../../../DataStructure/Lists/Headers/Vector.h"
+#include "../../../../../DataStructure/Lists/Headers/GapBuffer.h"
 
 
 
@@ -240,6 +241,44 @@ void testStringChangeStringS(CuTest *cuTest) {
 
 
 
+void testStringGapBuffer(CuTest *cuTest) {
+
+    String *string = stringInitialization(1);
+    stringChangeStringC(string, "hello world");
+
+    stringToGapBuffer(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    GapBuffer *buffer = stringToGapBuffer(string);
+    CuAssertIntEquals(cuTest, 11, gapBufferGetLength(buffer));
+
+    gapBufferRemoveRange(buffer, 6, 11);
+    gapBufferAddArrayAtIndex(buffer, 6, "there", 5);
+    char c = ',';
+    gapBufferAddAtIndex(buffer, 5, &c);
+
+    stringChangeStringG(string, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    stringChangeStringG(string, buffer);
+    CuAssertStrEquals(cuTest, "hello, there", string->string);
+    CuAssertIntEquals(cuTest, 12, stringGetLength(string));
+
+    destroyGapBuffer(buffer);
+
+    buffer = gapBufferInitialization(sizeof(int), 4);
+    ERROR_TEST->errorCode = -1;
+    stringChangeStringG(string, buffer);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyGapBuffer(buffer);
+    destroyString(string);
+
+}
+
+
+
+
 void testStringGetIndex(CuTest *cuTest) {
 
     String *string = stringInitialization(1);
@@ -809,6 +848,7 @@ CuSuite *createStringTestsSuite() {
     SUITE_ADD_TEST(suite, testStringAppendS);
     SUITE_ADD_TEST(suite, testStringChangeStringC);
     SUITE_ADD_TEST(suite, testStringChangeStringS);
+    SUITE_ADD_TEST(suite, testStringGapBuffer);
     SUITE_ADD_TEST(suite, testStringGetIndex);
     SUITE_ADD_TEST(suite, testStringGet);
     SUITE_ADD_TEST(suite, testStringSubStringC);
@@ -0,0 +1,160 @@
+#include "BloomFilterTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/BloomFilter.h"
+
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunBFT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+void testInvalidBloomFilterInitialization(CuTest *cuTest) {
+
+    bloomFilterInitialization(0, 0.01, intHashFunBFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    bloomFilterInitialization(100, 0, intHashFunBFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    bloomFilterInitialization(100, 1, intHashFunBFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    bloomFilterInitialization(100, 0.01, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testValidBloomFilterInitialization(CuTest *cuTest) {
+
+    BloomFilter *filter = bloomFilterInitialization(100, 0.01, intHashFunBFT);
+    CuAssertPtrNotNull(cuTest, filter);
+    CuAssertIntEquals(cuTest, 0, (int) ((uintptr_t) filter->blocks % 64));
+    CuAssertIntEquals(cuTest, 0, bloomFilterGetLength(filter));
+
+    destroyBloomFilter(filter);
+
+}
+
+
+void testBloomFilterInsertAndContains(CuTest *cuTest) {
+
+    BloomFilter *filter = bloomFilterInitialization(1000, 0.01, intHashFunBFT);
+
+    for (int i = 0; i < 1000; i++)
+        bloomFilterInsert(filter, &i);
+
+    CuAssertIntEquals(cuTest, 1000, bloomFilterGetLength(filter));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 1, bloomFilterContains(filter, &i));
+
+    ERROR_TEST->errorCode = -1;
+    bloomFilterInsert(NULL, filter);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    bloomFilterInsert(filter, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, -1, bloomFilterContains(filter, NULL));
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyBloomFilter(filter);
+
+}
+
+
+void testBloomFilterFalsePositiveRate(CuTest *cuTest) {
+
+    BloomFilter *filter = bloomFilterInitialization(10000, 0.01, intHashFunBFT);
+
+    for (int i = 0; i < 10000; i++)
+        bloomFilterInsert(filter, &i);
+
+    int falsePositives = 0;
+    for (int i = 10000; i < 110000; i++)
+        falsePositives += bloomFilterContains(filter, &i);
+
+    CuAssertTrue(cuTest, falsePositives < 2000);
+
+    destroyBloomFilter(filter);
+
+}
+
+
+void testClearBloomFilter(CuTest *cuTest) {
+
+    BloomFilter *filter = bloomFilterInitialization(100, 0.01, intHashFunBFT);
+
+    for (int i = 0; i < 100; i++)
+        bloomFilterInsert(filter, &i);
+
+    clearBloomFilter(filter);
+    CuAssertIntEquals(cuTest, 0, bloomFilterGetLength(filter));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, 0, bloomFilterContains(filter, &i));
+
+    destroyBloomFilter(filter);
+
+}
+
+
+void testDestroyBloomFilter(CuTest *cuTest) {
+
+    destroyBloomFilter(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createBloomFilterTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidBloomFilterInitialization);
+    SUITE_ADD_TEST(suite, testValidBloomFilterInitialization);
+    SUITE_ADD_TEST(suite, testBloomFilterInsertAndContains);
+    SUITE_ADD_TEST(suite, testBloomFilterFalsePositiveRate);
+    SUITE_ADD_TEST(suite, testClearBloomFilter);
+    SUITE_ADD_TEST(suite, testDestroyBloomFilter);
+
+    return suite;
+
+}
+
+
+
+void bloomFilterUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Bloom Filter Test**\n");
+
+    CuSuite *suite = createBloomFilterTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_BLOOMFILTERTEST_H
+#define C_DATASTRUCTURES_BLOOMFILTERTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void bloomFilterUnitTest();
+
+#endif //C_DATASTRUCTURES_BLOOMFILTERTEST_H
@@ -0,0 +1,383 @@
+#include "CacheTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/Cache.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerCT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersCT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunCT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+int evictedCountCT = 0;
+int lastEvictedKeyCT = -1;
+
+
+
+
+/** This function will take the evicted key and item as a parameters,
+ * then it will count the eviction and save the evicted key value.
+ *
+ * @param key the evicted key pointer
+ * @param item the evicted item pointer
+ */
+
+void evictionFunCT(void *key, void *item) {
+    (void) item;
+    evictedCountCT++;
+    lastEvictedKeyCT = *(int *) key;
+}
+
+
+
+
+/** This function will take a key and an item as a parameters,
+ * then it will return the item value as the entry weight.
+ *
+ * @param key the key pointer
+ * @param item the integer item pointer
+ * @return it will return the item value
+ */
+
+long itemWeightFunCT(const void *key, const void *item) {
+    (void) key;
+    return *(int *) item;
+}
+
+
+
+
+
+void testInvalidCacheInitialization(CuTest *cuTest) {
+
+    cacheInitialization(CACHE_LRU, 0, NULL, free, free, compareIntPointersCT, intHashFunCT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cacheInitialization((CachePolicy) 5, 10, NULL, free, free, compareIntPointersCT, intHashFunCT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cacheInitialization(CACHE_LRU, 10, NULL, NULL, free, compareIntPointersCT, intHashFunCT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cacheInitialization(CACHE_LRU, 10, NULL, free, NULL, compareIntPointersCT, intHashFunCT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cacheInitialization(CACHE_LRU, 10, NULL, free, free, NULL, intHashFunCT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cacheInitialization(CACHE_LRU, 10, NULL, free, free, compareIntPointersCT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testCacheLRUEviction(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LRU, 3, NULL, free, free, compareIntPointersCT, intHashFunCT);
+
+    for (int i = 0; i < 3; i++)
+        cachePut(cache, generateIntPointerCT(i), generateIntPointerCT(i * 10));
+
+    // using the key zero makes the key one the least recently used.
+    int key = 0;
+    CuAssertIntEquals(cuTest, 0, *(int *) cacheGet(cache, &key));
+
+    cachePut(cache, generateIntPointerCT(3), generateIntPointerCT(30));
+    CuAssertIntEquals(cuTest, 3, cacheGetLength(cache));
+
+    key = 1;
+    CuAssertIntEquals(cuTest, 0, cacheContains(cache, &key));
+
+    cachePut(cache, generateIntPointerCT(4), generateIntPointerCT(40));
+
+    key = 2;
+    CuAssertIntEquals(cuTest, 0, cacheContains(cache, &key));
+
+    for (key = 0; key < 5; key += 3)
+        CuAssertIntEquals(cuTest, key * 10, *(int *) cacheGet(cache, &key));
+
+    key = 4;
+    CuAssertIntEquals(cuTest, 40, *(int *) cacheGet(cache, &key));
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheLFUEviction(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LFU, 3, NULL, free, free, compareIntPointersCT, intHashFunCT);
+
+    for (int i = 0; i < 3; i++)
+        cachePut(cache, generateIntPointerCT(i), generateIntPointerCT(i));
+
+    int key = 0;
+    cacheGet(cache, &key);
+    cacheGet(cache, &key);
+    key = 1;
+    cacheGet(cache, &key);
+
+    // the key two is the least frequently used.
+    cachePut(cache, generateIntPointerCT(3), generateIntPointerCT(3));
+    key = 2;
+    CuAssertIntEquals(cuTest, 0, cacheContains(cache, &key));
+
+    // the key three has one use only, so it goes before the key one.
+    cachePut(cache, generateIntPointerCT(4), generateIntPointerCT(4));
+    key = 3;
+    CuAssertIntEquals(cuTest, 0, cacheContains(cache, &key));
+
+    key = 0;
+    CuAssertIntEquals(cuTest, 1, cacheContains(cache, &key));
+    key = 1;
+    CuAssertIntEquals(cuTest, 1, cacheContains(cache, &key));
+    key = 4;
+    CuAssertIntEquals(cuTest, 1, cacheContains(cache, &key));
+
+    // now every key was used at least twice, and between the keys one and four the key one is the least recently used.
+    cacheGet(cache, &key);
+    cachePut(cache, generateIntPointerCT(5), generateIntPointerCT(50));
+    key = 1;
+    CuAssertIntEquals(cuTest, 0, cacheContains(cache, &key));
+    key = 0;
+    CuAssertIntEquals(cuTest, 1, cacheContains(cache, &key));
+    key = 4;
+    CuAssertIntEquals(cuTest, 1, cacheContains(cache, &key));
+
+    // the new key is kept even though it has the lowest frequency.
+    key = 5;
+    CuAssertIntEquals(cuTest, 50, *(int *) cacheGet(cache, &key));
+    CuAssertIntEquals(cuTest, 3, cacheGetLength(cache));
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheWeightCapacity(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LRU, 100, itemWeightFunCT, free, free, compareIntPointersCT, intHashFunCT);
+
+    cachePut(cache, generateIntPointerCT(1), generateIntPointerCT(40));
+    cachePut(cache, generateIntPointerCT(2), generateIntPointerCT(40));
+    CuAssertIntEquals(cuTest, 80, (int) cacheGetWeight(cache));
+
+    cachePut(cache, generateIntPointerCT(3), generateIntPointerCT(30));
+    CuAssertIntEquals(cuTest, 70, (int) cacheGetWeight(cache));
+    CuAssertIntEquals(cuTest, 2, cacheGetLength(cache));
+
+    // replacing an item updates the weight.
+    cachePut(cache, generateIntPointerCT(3), generateIntPointerCT(10));
+    CuAssertIntEquals(cuTest, 50, (int) cacheGetWeight(cache));
+
+    // an entry heavier than the capacity can't stay.
+    cachePut(cache, generateIntPointerCT(4), generateIntPointerCT(150));
+    CuAssertIntEquals(cuTest, 0, cacheGetLength(cache));
+    CuAssertIntEquals(cuTest, 0, (int) cacheGetWeight(cache));
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheEvictionFun(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LRU, 10, NULL, free, free, compareIntPointersCT, intHashFunCT);
+    cacheSetEvictionFun(cache, evictionFunCT);
+    evictedCountCT = 0;
+
+    for (int i = 0; i < 25; i++)
+        cachePut(cache, generateIntPointerCT(i), generateIntPointerCT(i));
+
+    CuAssertIntEquals(cuTest, 15, evictedCountCT);
+    CuAssertIntEquals(cuTest, 14, lastEvictedKeyCT);
+
+    int key = 20;
+    cacheDelete(cache, &key);
+    clearCache(cache);
+    CuAssertIntEquals(cuTest, 15, evictedCountCT);
+    CuAssertIntEquals(cuTest, 0, cacheGetLength(cache));
+
+    ERROR_TEST->errorCode = -1;
+    cacheSetEvictionFun(NULL, evictionFunCT);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheCounters(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LFU, 10, NULL, free, free, compareIntPointersCT, intHashFunCT);
+
+    for (int i = 0; i < 5; i++)
+        cachePut(cache, generateIntPointerCT(i), generateIntPointerCT(i));
+
+    for (int i = 0; i < 10; i++)
+        cacheGet(cache, &i);
+
+    int key = 1;
+    cacheContains(cache, &key);
+
+    CuAssertIntEquals(cuTest, 5, (int) cacheGetHitsCount(cache));
+    CuAssertIntEquals(cuTest, 5, (int) cacheGetMissesCount(cache));
+
+    cacheResetCounters(cache);
+    CuAssertIntEquals(cuTest, 0, (int) cacheGetHitsCount(cache));
+    CuAssertIntEquals(cuTest, 0, (int) cacheGetMissesCount(cache));
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheDelete(CuTest *cuTest) {
+
+    Cache *cache = cacheInitialization(CACHE_LFU, 10, NULL, free, free, compareIntPointersCT, intHashFunCT);
+
+    for (int i = 0; i < 10; i++)
+        cachePut(cache, generateIntPointerCT(i), generateIntPointerCT(i));
+
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < i; j++)
+            cacheGet(cache, &i);
+    }
+
+    for (int i = 0; i < 10; i += 2)
+        cacheDelete(cache, &i);
+
+    CuAssertIntEquals(cuTest, 5, cacheGetLength(cache));
+
+    for (int i = 0; i < 10; i++)
+        CuAssertIntEquals(cuTest, i % 2, cacheContains(cache, &i));
+
+    ERROR_TEST->errorCode = -1;
+    cacheDelete(cache, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyCache(cache);
+
+}
+
+
+void testCacheManyOperations(CuTest *cuTest) {
+
+    CachePolicy policies[] = {CACHE_LRU, CACHE_LFU};
+
+    for (int p = 0; p < 2; p++) {
+        Cache *cache = cacheInitialization(policies[p], 100, NULL, free, free, compareIntPointersCT, intHashFunCT);
+
+        unsigned int seed = 7;
+        for (int i = 0; i < 20000; i++) {
+            seed = seed * 1103515245 + 12345;
+            int key = (int) ((seed >> 16) % 300);
+
+            if (cacheGet(cache, &key) == NULL)
+                cachePut(cache, generateIntPointerCT(key), generateIntPointerCT(key));
+
+            CuAssertTrue(cuTest, cacheGetLength(cache) <= 100);
+        }
+
+        CuAssertIntEquals(cuTest, 100, cacheGetLength(cache));
+        CuAssertIntEquals(cuTest, 20000, (int) (cacheGetHitsCount(cache) + cacheGetMissesCount(cache)));
+
+        destroyCache(cache);
+    }
+
+}
+
+
+void testDestroyCache(CuTest *cuTest) {
+
+    destroyCache(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createCacheTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidCacheInitialization);
+    SUITE_ADD_TEST(suite, testCacheLRUEviction);
+    SUITE_ADD_TEST(suite, testCacheLFUEviction);
+    SUITE_ADD_TEST(suite, testCacheWeightCapacity);
+    SUITE_ADD_TEST(suite, testCacheEvictionFun);
+    SUITE_ADD_TEST(suite, testCacheCounters);
+    SUITE_ADD_TEST(suite, testCacheDelete);
+    SUITE_ADD_TEST(suite, testCacheManyOperations);
+    SUITE_ADD_TEST(suite, testDestroyCache);
+
+    return suite;
+
+}
+
+
+
+void cacheUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Cache Test**\n");
+
+    CuSuite *suite = createCacheTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
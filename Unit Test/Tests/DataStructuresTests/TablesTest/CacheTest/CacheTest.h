@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_CACHETEST_H
+#define C_DATASTRUCTURES_CACHETEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void cacheUnitTest();
+
+#endif //C_DATASTRUCTURES_CACHETEST_H
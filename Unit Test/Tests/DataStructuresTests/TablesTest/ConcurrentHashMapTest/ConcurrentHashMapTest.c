@@ -0,0 +1,485 @@
+#include "ConcurrentHashMapTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/ConcurrentHashMap.h"
+
+
+
+#define C_HASH_MAP_TEST_THREADS 4
+#define C_HASH_MAP_TEST_ITEMS_PER_THREAD 2000
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerCHMT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersCHMT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunCHMT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+/** This function will take a key pointer,
+ * then it will return a new allocated integer that equals the key value multiplied by ten.
+ *
+ * @param key the integer key pointer
+ * @return it will return the new item pointer
+ */
+
+void *tenTimesMappingFunCHMT(const void *key) {
+    return generateIntPointerCHMT(*(int *) key * 10);
+}
+
+
+
+
+/** This function will take an integer item pointer, and an integer argument pointer,
+ * then it will add the argument value to the item.
+ *
+ * @param item the integer item pointer
+ * @param arg the integer argument pointer
+ */
+
+void addUpdateFunCHMT(void *item, void *arg) {
+    *(int *) item += *(int *) arg;
+}
+
+
+
+
+/** This function will take an integer item pointer, and an integer output pointer,
+ * then it will copy the item value into the output.
+ *
+ * @param item the integer item pointer
+ * @param output the integer output pointer
+ */
+
+void copyVisitFunCHMT(const void *item, void *output) {
+    *(int *) output = *(const int *) item;
+}
+
+
+
+
+/** The parameters of the concurrent hash map test threads. */
+
+typedef struct CHashMapTestThreadArgs {
+    ConcurrentHashMap *map;
+    int threadIndex;
+} CHashMapTestThreadArgs;
+
+
+
+
+/** This function will insert a unique range of keys into the map, then it will increment a shared counter key,
+ * and it will be called from many threads at the same time.
+ *
+ * @param args the thread arguments pointer
+ * @return it will return NULL
+ */
+
+void *insertThreadFunCHMT(void *args) {
+    CHashMapTestThreadArgs *threadArgs = (CHashMapTestThreadArgs *) args;
+    int start = threadArgs->threadIndex * C_HASH_MAP_TEST_ITEMS_PER_THREAD;
+    int counterKey = -1, one = 1;
+
+    for (int i = start; i < start + C_HASH_MAP_TEST_ITEMS_PER_THREAD; i++) {
+        concurrentHashMapInsert(threadArgs->map, generateIntPointerCHMT(i), generateIntPointerCHMT(i));
+
+        concurrentHashMapComputeIfAbsent(threadArgs->map, generateIntPointerCHMT(counterKey), tenTimesMappingFunCHMT);
+        concurrentHashMapUpdate(threadArgs->map, &counterKey, addUpdateFunCHMT, &one);
+    }
+
+    return NULL;
+
+}
+
+
+
+
+
+void testInvalidConcurrentHashMapInitialization(CuTest *cuTest) {
+
+    concurrentHashMapInitialization(0, free, free, compareIntPointersCHMT, intHashFunCHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    concurrentHashMapInitialization(4, NULL, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    concurrentHashMapInitialization(4, free, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    concurrentHashMapInitialization(4, free, free, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+void testValidConcurrentHashMapInitialization(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(5, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    CuAssertPtrNotNull(cuTest, map);
+    CuAssertIntEquals(cuTest, 8, map->segmentsNum);
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapInsertAndGet(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapInsert(NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapInsert(map, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    int tempKey = 10;
+    concurrentHashMapInsert(map, &tempKey, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 1000; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i * 2));
+
+    concurrentHashMapInsert(map, generateIntPointerCHMT(7), generateIntPointerCHMT(-7));
+
+    CuAssertIntEquals(cuTest, 1000, concurrentHashMapGetLength(map));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, i == 7 ? -7 : i * 2, *(int *) concurrentHashMapGet(map, &i));
+
+    tempKey = 1000;
+    CuAssertPtrEquals(cuTest, NULL, concurrentHashMapGet(map, &tempKey));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapContains(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapContains(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapContains(map, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 100; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i));
+
+    for (int i = 0; i < 200; i++)
+        CuAssertIntEquals(cuTest, i < 100, concurrentHashMapContains(map, &i));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapComputeIfAbsent(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapComputeIfAbsent(NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapComputeIfAbsent(map, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    int tempKey = 3;
+    concurrentHashMapComputeIfAbsent(map, &tempKey, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 30, *(int *) concurrentHashMapComputeIfAbsent(map, generateIntPointerCHMT(3), tenTimesMappingFunCHMT));
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapGetLength(map));
+
+    *(int *) concurrentHashMapGet(map, &tempKey) = 5;
+    CuAssertIntEquals(cuTest, 5, *(int *) concurrentHashMapComputeIfAbsent(map, generateIntPointerCHMT(3), tenTimesMappingFunCHMT));
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapGetLength(map));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapUpdate(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapUpdate(NULL, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapUpdate(map, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    int tempKey = 1, addValue = 4;
+    concurrentHashMapUpdate(map, &tempKey, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 0, concurrentHashMapUpdate(map, &tempKey, addUpdateFunCHMT, &addValue));
+
+    concurrentHashMapInsert(map, generateIntPointerCHMT(1), generateIntPointerCHMT(10));
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapUpdate(map, &tempKey, addUpdateFunCHMT, &addValue));
+    CuAssertIntEquals(cuTest, 14, *(int *) concurrentHashMapGet(map, &tempKey));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapVisit(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapVisit(NULL, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapVisit(map, NULL, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    int tempKey = 1, output = 0;
+    concurrentHashMapVisit(map, &tempKey, NULL, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 0, concurrentHashMapVisit(map, &tempKey, copyVisitFunCHMT, &output));
+    CuAssertIntEquals(cuTest, 0, output);
+
+    concurrentHashMapInsert(map, generateIntPointerCHMT(1), generateIntPointerCHMT(10));
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapVisit(map, &tempKey, copyVisitFunCHMT, &output));
+    CuAssertIntEquals(cuTest, 10, output);
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapDelete(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapDelete(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapDelete(map, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 500; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i));
+
+    for (int i = 0; i < 500; i += 2)
+        concurrentHashMapDelete(map, &i);
+
+    CuAssertIntEquals(cuTest, 250, concurrentHashMapGetLength(map));
+
+    for (int i = 0; i < 500; i++)
+        CuAssertIntEquals(cuTest, i % 2, concurrentHashMapContains(map, &i));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapDeleteWtoFr(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    concurrentHashMapDeleteWtoFr(NULL, NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    concurrentHashMapDeleteWtoFr(map, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 50; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i * 3));
+
+    for (int i = 0; i < 50; i++) {
+        int *item = (int *) concurrentHashMapDeleteWtoFr(map, &i);
+        CuAssertIntEquals(cuTest, i * 3, *item);
+        free(item);
+    }
+
+    int tempKey = 5;
+    CuAssertPtrEquals(cuTest, NULL, concurrentHashMapDeleteWtoFr(map, &tempKey));
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapIsEmpty(map));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testConcurrentHashMapMultiThreaded(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(8, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    pthread_t threads[C_HASH_MAP_TEST_THREADS];
+    CHashMapTestThreadArgs args[C_HASH_MAP_TEST_THREADS];
+
+    for (int i = 0; i < C_HASH_MAP_TEST_THREADS; i++) {
+        args[i].map = map;
+        args[i].threadIndex = i;
+        pthread_create(threads + i, NULL, insertThreadFunCHMT, args + i);
+    }
+
+    for (int i = 0; i < C_HASH_MAP_TEST_THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    CuAssertIntEquals(cuTest, C_HASH_MAP_TEST_THREADS * C_HASH_MAP_TEST_ITEMS_PER_THREAD + 1, concurrentHashMapGetLength(map));
+
+    for (int i = 0; i < C_HASH_MAP_TEST_THREADS * C_HASH_MAP_TEST_ITEMS_PER_THREAD; i++)
+        CuAssertIntEquals(cuTest, i, *(int *) concurrentHashMapGet(map, &i));
+
+    int counterKey = -1;
+    CuAssertIntEquals(cuTest, -10 + C_HASH_MAP_TEST_THREADS * C_HASH_MAP_TEST_ITEMS_PER_THREAD, *(int *) concurrentHashMapGet(map, &counterKey));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testClearConcurrentHashMap(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    clearConcurrentHashMap(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 100; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i));
+
+    CuAssertIntEquals(cuTest, 0, concurrentHashMapIsEmpty(map));
+
+    clearConcurrentHashMap(map);
+
+    CuAssertIntEquals(cuTest, 1, concurrentHashMapIsEmpty(map));
+    CuAssertIntEquals(cuTest, 0, concurrentHashMapGetLength(map));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+void testDestroyConcurrentHashMap(CuTest *cuTest) {
+
+    ConcurrentHashMap *map = concurrentHashMapInitialization(4, free, free, compareIntPointersCHMT, intHashFunCHMT);
+
+    destroyConcurrentHashMap(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 100; i++)
+        concurrentHashMapInsert(map, generateIntPointerCHMT(i), generateIntPointerCHMT(i));
+
+    destroyConcurrentHashMap(map);
+
+}
+
+
+
+
+
+CuSuite *createConcurrentHashMapTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidConcurrentHashMapInitialization);
+    SUITE_ADD_TEST(suite, testValidConcurrentHashMapInitialization);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapInsertAndGet);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapContains);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapComputeIfAbsent);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapUpdate);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapVisit);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapDelete);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapDeleteWtoFr);
+    SUITE_ADD_TEST(suite, testConcurrentHashMapMultiThreaded);
+    SUITE_ADD_TEST(suite, testClearConcurrentHashMap);
+    SUITE_ADD_TEST(suite, testDestroyConcurrentHashMap);
+
+    return suite;
+
+}
+
+
+
+void concurrentHashMapUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Concurrent Hashmap Test**\n");
+
+    CuSuite *suite = createConcurrentHashMapTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
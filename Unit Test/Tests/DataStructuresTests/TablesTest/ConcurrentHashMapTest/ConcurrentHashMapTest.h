@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_CONCURRENTHASHMAPTEST_H
+#define C_DATASTRUCTURES_CONCURRENTHASHMAPTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void concurrentHashMapUnitTest();
+
+#endif //C_DATASTRUCTURES_CONCURRENTHASHMAPTEST_H
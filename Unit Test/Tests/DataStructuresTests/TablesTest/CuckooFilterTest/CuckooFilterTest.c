@@ -0,0 +1,219 @@
+#include "CuckooFilterTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/CuckooFilter.h"
+
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunCFT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+void testInvalidCuckooFilterInitialization(CuTest *cuTest) {
+
+    cuckooFilterInitialization(0, 0.01, intHashFunCFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cuckooFilterInitialization(100, 0, intHashFunCFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cuckooFilterInitialization(100, 1, intHashFunCFT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    cuckooFilterInitialization(100, 0.01, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testValidCuckooFilterInitialization(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(100, 0.01, intHashFunCFT);
+    CuAssertPtrNotNull(cuTest, filter);
+    CuAssertIntEquals(cuTest, 32, filter->bucketsNum);
+    CuAssertIntEquals(cuTest, 0, cuckooFilterGetLength(filter));
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testCuckooFilterInsertAndContains(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(1000, 0.01, intHashFunCFT);
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 1, cuckooFilterInsert(filter, &i));
+
+    CuAssertIntEquals(cuTest, 1000, cuckooFilterGetLength(filter));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 1, cuckooFilterContains(filter, &i));
+
+    ERROR_TEST->errorCode = -1;
+    cuckooFilterInsert(NULL, filter);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    cuckooFilterInsert(filter, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, -1, cuckooFilterContains(filter, NULL));
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testCuckooFilterDelete(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(1000, 0.001, intHashFunCFT);
+
+    for (int i = 0; i < 1000; i++)
+        cuckooFilterInsert(filter, &i);
+
+    for (int i = 0; i < 1000; i += 2)
+        CuAssertIntEquals(cuTest, 1, cuckooFilterDelete(filter, &i));
+
+    CuAssertIntEquals(cuTest, 500, cuckooFilterGetLength(filter));
+
+    int stillFound = 0;
+    for (int i = 1; i < 1000; i += 2)
+        CuAssertIntEquals(cuTest, 1, cuckooFilterContains(filter, &i));
+
+    for (int i = 0; i < 1000; i += 2)
+        stillFound += cuckooFilterContains(filter, &i);
+
+    CuAssertTrue(cuTest, stillFound < 25);
+
+    int missing = 5000;
+    CuAssertIntEquals(cuTest, 0, cuckooFilterDelete(filter, &missing));
+
+    ERROR_TEST->errorCode = -1;
+    cuckooFilterDelete(filter, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testCuckooFilterFull(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(100, 0.01, intHashFunCFT);
+
+    int inserted = 0;
+    while (cuckooFilterInsert(filter, &inserted))
+        inserted++;
+
+    // the filter has 32 buckets of four slots, and it should fill most of them before refusing.
+    CuAssertTrue(cuTest, inserted > 110 && inserted <= 128);
+    CuAssertIntEquals(cuTest, inserted, cuckooFilterGetLength(filter));
+
+    for (int i = 0; i < inserted; i++)
+        CuAssertIntEquals(cuTest, 1, cuckooFilterContains(filter, &i));
+
+    int item = 0;
+    cuckooFilterDelete(filter, &item);
+    CuAssertIntEquals(cuTest, 1, cuckooFilterInsert(filter, &item));
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testCuckooFilterFalsePositiveRate(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(10000, 0.01, intHashFunCFT);
+
+    for (int i = 0; i < 10000; i++)
+        cuckooFilterInsert(filter, &i);
+
+    int falsePositives = 0;
+    for (int i = 10000; i < 110000; i++)
+        falsePositives += cuckooFilterContains(filter, &i);
+
+    CuAssertTrue(cuTest, falsePositives < 2000);
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testClearCuckooFilter(CuTest *cuTest) {
+
+    CuckooFilter *filter = cuckooFilterInitialization(100, 0.01, intHashFunCFT);
+
+    for (int i = 0; i < 100; i++)
+        cuckooFilterInsert(filter, &i);
+
+    clearCuckooFilter(filter);
+    CuAssertIntEquals(cuTest, 0, cuckooFilterGetLength(filter));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, 0, cuckooFilterContains(filter, &i));
+
+    destroyCuckooFilter(filter);
+
+}
+
+
+void testDestroyCuckooFilter(CuTest *cuTest) {
+
+    destroyCuckooFilter(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createCuckooFilterTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidCuckooFilterInitialization);
+    SUITE_ADD_TEST(suite, testValidCuckooFilterInitialization);
+    SUITE_ADD_TEST(suite, testCuckooFilterInsertAndContains);
+    SUITE_ADD_TEST(suite, testCuckooFilterDelete);
+    SUITE_ADD_TEST(suite, testCuckooFilterFull);
+    SUITE_ADD_TEST(suite, testCuckooFilterFalsePositiveRate);
+    SUITE_ADD_TEST(suite, testClearCuckooFilter);
+    SUITE_ADD_TEST(suite, testDestroyCuckooFilter);
+
+    return suite;
+
+}
+
+
+
+void cuckooFilterUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Cuckoo Filter Test**\n");
+
+    CuSuite *suite = createCuckooFilterTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_CUCKOOFILTERTEST_H
+#define C_DATASTRUCTURES_CUCKOOFILTERTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void cuckooFilterUnitTest();
+
+#endif //C_DATASTRUCTURES_CUCKOOFILTERTEST_H
@@ -39,6 +39,21 @@ int compareIntPointersDLLHMT(const void *a, const void *b) {
 
 
 
+/** This function will compare two char arrays,
+ * then it will return zero if they are equal, negative number if the first char array is smaller,
+ * and positive number if the first char array is bigger.
+ * @param a the first char array pointer
+ * @param b the second char array pointer
+ * @return it will return the result of comparing the two char arrays using strcmp
+ */
+
+int compareCharArraysDLLHMT(const void *a, const void *b) {
+    return strcmp((const char *) a, (const char *) b);
+}
+
+
+
+
 /** This function will take an integer pointer,
  * then it will return the value of the integer.
  *
@@ -153,11 +168,8 @@ void testDLLHashMapInsert(CuTest *cuTest) {
     int arr[13] = {0};
     for (int i = 0; i < llHashMap->length; i++) {
 
-            if (llHashMap->arr[i] ==  NULL)
-                continue;
-
-            for (int j = 0; j < doublyLinkedListGetLength(llHashMap->arr[i]); j++) {
-                Entry *currentEntry = (Entry *) doublyLinkedListGet(llHashMap->arr[i], j);
+            for (LLHashMapNode *node = llHashMap->arr[i]; node != NULL; node = node->next) {
+                Entry *currentEntry = &node->entry;
                 CuAssertStrEquals(cuTest, numbersArr[*(int *)currentEntry->key - 1], (char *) currentEntry->item);
                 arr[*(int *) currentEntry->key - 1]++;
             }
@@ -174,6 +186,50 @@ void testDLLHashMapInsert(CuTest *cuTest) {
 
 
 
+void testDLLHashMapGrowth(CuTest *cuTest) {
+
+    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareIntPointersDLLHMT, intHashFunDLLHMT);
+
+    for (int i = 0; i < 1000; i++)
+        lLHashMapInsert(llHashMap, generateIntPointerDLLHMT(i), generateIntPointerDLLHMT(i));
+
+    CuAssertIntEquals(cuTest, 1000, lLHashMapGetLength(llHashMap));
+    CuAssertTrue(cuTest, llHashMap->length * 3 >= llHashMap->count * 4);
+
+    for (int i = 0; i < 1000; i++)
+        lLHashMapInsert(llHashMap, generateIntPointerDLLHMT(i), generateIntPointerDLLHMT(i * 2));
+
+    CuAssertIntEquals(cuTest, 1000, lLHashMapGetLength(llHashMap));
+
+    for (int i = 0; i < 1000; i += 2)
+        lLHashMapDelete(llHashMap, &i);
+
+    for (int i = 1000; i < 1500; i++)
+        lLHashMapInsert(llHashMap, generateIntPointerDLLHMT(i), generateIntPointerDLLHMT(i * 2));
+
+    CuAssertIntEquals(cuTest, 1000, lLHashMapGetLength(llHashMap));
+
+    for (int i = 0; i < 1500; i++) {
+        if (i < 1000 && i % 2 == 0)
+            CuAssertIntEquals(cuTest, 0, lLHashMapContains(llHashMap, &i));
+        else
+            CuAssertIntEquals(cuTest, i * 2, *(int *) lLHashMapGet(llHashMap, &i));
+
+    }
+
+    clearLLHashMap(llHashMap);
+    CuAssertIntEquals(cuTest, 1, lLHashMapIsEmpty(llHashMap));
+
+    lLHashMapInsert(llHashMap, generateIntPointerDLLHMT(1), generateIntPointerDLLHMT(1));
+    CuAssertIntEquals(cuTest, 1, lLHashMapGetLength(llHashMap));
+
+    destroyLLHashMap(llHashMap);
+
+}
+
+
+
+
 void testDLLHashMapContains(CuTest *cuTest) {
 
     LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareIntPointersDLLHMT, intHashFunDLLHMT);
@@ -416,7 +472,7 @@ void testDLLHashMapDeleteWtoFrAll(CuTest *cuTest) {
 
 void testDLLHashMapToArray(CuTest *cuTest) {
 
-    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, strcmp, charArrHashFunDLLHMT);
+    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareCharArraysDLLHMT, charArrHashFunDLLHMT);
 
     char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
 
@@ -446,7 +502,7 @@ void testDLLHashMapToArray(CuTest *cuTest) {
 
 void testDLLHashMapToEntryArray(CuTest *cuTest) {
 
-    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, strcmp, charArrHashFunDLLHMT);
+    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareCharArraysDLLHMT, charArrHashFunDLLHMT);
 
     char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
 
@@ -478,6 +534,53 @@ void testDLLHashMapToEntryArray(CuTest *cuTest) {
 
 
 
+void testDLLHashMapIterator(CuTest *cuTest) {
+
+    LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareCharArraysDLLHMT, charArrHashFunDLLHMT);
+
+    char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
+
+    LLHashMapIterator iterator;
+    lLHashMapIteratorBegin(NULL, &iterator);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    lLHashMapIteratorBegin(llHashMap, &iterator);
+    CuAssertIntEquals(cuTest, 0, lLHashMapIteratorNext(&iterator));
+
+    for (int i = 0; i < 13; i++)
+        lLHashMapInsert(llHashMap, generateCharPointerDLLHMT(numbersArr[i]), generateIntPointerDLLHMT(i + 1));
+
+    int arr[13] = {0};
+    lLHashMapIteratorBegin(llHashMap, &iterator);
+    while (lLHashMapIteratorNext(&iterator)) {
+        int value = *(int *) lLHashMapIteratorValue(&iterator);
+        arr[value - 1]++;
+        CuAssertStrEquals(cuTest, numbersArr[value - 1], (char *) lLHashMapIteratorKey(&iterator));
+
+        if (value % 2 == 0)
+            lLHashMapIteratorRemove(&iterator);
+
+    }
+
+    for (int i = 0; i < 13; i++)
+        CuAssertIntEquals(cuTest, 1, arr[i]);
+
+    lLHashMapIteratorRemove(&iterator);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 7, lLHashMapGetLength(llHashMap));
+    for (int i = 0; i < 13; i++)
+        CuAssertIntEquals(cuTest, i % 2 == 0, lLHashMapContains(llHashMap, numbersArr[i]));
+
+    destroyLLHashMap(llHashMap);
+
+}
+
+
+
+
+
+
 void testDLLHashMapGetLength(CuTest *cuTest) {
 
     LinkedListHashMap *llHashMap = linkedListHashMapInitialization(3, free, free, compareIntPointersDLLHMT, intHashFunDLLHMT);
@@ -604,6 +707,7 @@ CuSuite *createDoublyLinkedListHashMapTestsSuite() {
     SUITE_ADD_TEST(suite, testInvalidDLLHashMapInitialization);
     SUITE_ADD_TEST(suite, testValidDLLHashMapInitialization);
     SUITE_ADD_TEST(suite, testDLLHashMapInsert);
+    SUITE_ADD_TEST(suite, testDLLHashMapGrowth);
     SUITE_ADD_TEST(suite, testDLLHashMapContains);
     SUITE_ADD_TEST(suite, testDLLHashMapGet);
     SUITE_ADD_TEST(suite, testDLLHashMapGetKey);
@@ -612,6 +716,7 @@ CuSuite *createDoublyLinkedListHashMapTestsSuite() {
     SUITE_ADD_TEST(suite, testDLLHashMapDeleteWtoFrAll);
     SUITE_ADD_TEST(suite, testDLLHashMapToArray);
     SUITE_ADD_TEST(suite, testDLLHashMapToEntryArray);
+    SUITE_ADD_TEST(suite, testDLLHashMapIterator);
     SUITE_ADD_TEST(suite, testDLLHashMapGetLength);
     SUITE_ADD_TEST(suite, testDLLHashMapIsEmpty);
     SUITE_ADD_TEST(suite, testClearDLLHashMap);
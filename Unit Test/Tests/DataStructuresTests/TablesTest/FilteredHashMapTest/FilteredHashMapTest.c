@@ -0,0 +1,250 @@
+#include "FilteredHashMapTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/FilteredHashMap.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerFHMT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersFHMT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunFHMT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+void testFilteredHashMapInitialization(CuTest *cuTest) {
+
+    filteredHashMapInitialization(100, 0.01, free, free, compareIntPointersFHMT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    filteredHashMapInitialization(100, 2, free, free, compareIntPointersFHMT, intHashFunFHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    FilteredHashMap *map = filteredHashMapInitialization(100, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+    CuAssertPtrNotNull(cuTest, map);
+    CuAssertIntEquals(cuTest, 0, filteredHashMapGetLength(map));
+
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testFilteredHashMapInsertAndGet(CuTest *cuTest) {
+
+    FilteredHashMap *map = filteredHashMapInitialization(100, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashMapInsert(map, generateIntPointerFHMT(i), generateIntPointerFHMT(i * 10));
+
+    // replacing an existing key should not add another fingerprint.
+    filteredHashMapInsert(map, generateIntPointerFHMT(5), generateIntPointerFHMT(55));
+
+    CuAssertIntEquals(cuTest, 100, filteredHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, 100, cuckooFilterGetLength(map->filter));
+
+    int key = 5;
+    CuAssertIntEquals(cuTest, 55, *(int *) filteredHashMapGet(map, &key));
+
+    for (key = 6; key < 100; key++)
+        CuAssertIntEquals(cuTest, key * 10, *(int *) filteredHashMapGet(map, &key));
+
+    for (key = 100; key < 1000; key++) {
+        CuAssertPtrEquals(cuTest, NULL, filteredHashMapGet(map, &key));
+        CuAssertIntEquals(cuTest, 0, filteredHashMapContains(map, &key));
+    }
+
+    ERROR_TEST->errorCode = -1;
+    filteredHashMapInsert(map, &key, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    filteredHashMapGet(NULL, &key);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testFilteredHashMapDelete(CuTest *cuTest) {
+
+    FilteredHashMap *map = filteredHashMapInitialization(100, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashMapInsert(map, generateIntPointerFHMT(i), generateIntPointerFHMT(i * 10));
+
+    for (int i = 0; i < 100; i += 2)
+        filteredHashMapDelete(map, &i);
+
+    int missing = 1000;
+    filteredHashMapDelete(map, &missing);
+
+    CuAssertIntEquals(cuTest, 50, filteredHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, 50, cuckooFilterGetLength(map->filter));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, i % 2, filteredHashMapContains(map, &i));
+
+    ERROR_TEST->errorCode = -1;
+    filteredHashMapDelete(map, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testFilteredHashMapFilterGrowth(CuTest *cuTest) {
+
+    FilteredHashMap *map = filteredHashMapInitialization(10, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+    int oldBucketsNum = map->filter->bucketsNum;
+
+    for (int i = 0; i < 1000; i++)
+        filteredHashMapInsert(map, generateIntPointerFHMT(i), generateIntPointerFHMT(i));
+
+    CuAssertTrue(cuTest, map->filter->bucketsNum > oldBucketsNum);
+    CuAssertIntEquals(cuTest, 1000, filteredHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, 1000, cuckooFilterGetLength(map->filter));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 1, filteredHashMapContains(map, &i));
+
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testFilteredHashMapFailedFilterGrowth(CuTest *cuTest) {
+
+    FilteredHashMap *map = filteredHashMapInitialization(10, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+
+    // an invalid false positive rate makes the filter rebuild fail once the filter is full.
+    map->falsePositiveRate = 0;
+    ERROR_TEST->errorCode = -1;
+
+    int i = 0;
+    int *key, *item;
+    for (; ERROR_TEST->errorCode != FAILED_ALLOCATION && i < 1000; i++)
+        filteredHashMapInsert(map, key = generateIntPointerFHMT(i), item = generateIntPointerFHMT(i));
+
+    CuAssertIntEquals(cuTest, FAILED_ALLOCATION, ERROR_TEST->errorCode);
+    CuAssertIntEquals(cuTest, i - 1, filteredHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, i - 1, cuckooFilterGetLength(map->filter));
+    CuAssertIntEquals(cuTest, 0, filteredHashMapContains(map, key));
+
+    for (int j = 0; j < i - 1; j++)
+        CuAssertIntEquals(cuTest, 1, filteredHashMapContains(map, &j));
+
+    free(key);
+    free(item);
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testClearFilteredHashMap(CuTest *cuTest) {
+
+    FilteredHashMap *map = filteredHashMapInitialization(100, 0.01, free, free, compareIntPointersFHMT, intHashFunFHMT);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashMapInsert(map, generateIntPointerFHMT(i), generateIntPointerFHMT(i));
+
+    clearFilteredHashMap(map);
+    CuAssertIntEquals(cuTest, 0, filteredHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, 0, cuckooFilterGetLength(map->filter));
+
+    int key = 5;
+    CuAssertIntEquals(cuTest, 0, filteredHashMapContains(map, &key));
+
+    destroyFilteredHashMap(map);
+
+}
+
+
+void testDestroyFilteredHashMap(CuTest *cuTest) {
+
+    destroyFilteredHashMap(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createFilteredHashMapTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testFilteredHashMapInitialization);
+    SUITE_ADD_TEST(suite, testFilteredHashMapInsertAndGet);
+    SUITE_ADD_TEST(suite, testFilteredHashMapDelete);
+    SUITE_ADD_TEST(suite, testFilteredHashMapFilterGrowth);
+    SUITE_ADD_TEST(suite, testFilteredHashMapFailedFilterGrowth);
+    SUITE_ADD_TEST(suite, testClearFilteredHashMap);
+    SUITE_ADD_TEST(suite, testDestroyFilteredHashMap);
+
+    return suite;
+
+}
+
+
+
+void filteredHashMapUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Filtered Hashmap Test**\n");
+
+    CuSuite *suite = createFilteredHashMapTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_FILTEREDHASHMAPTEST_H
+#define C_DATASTRUCTURES_FILTEREDHASHMAPTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void filteredHashMapUnitTest();
+
+#endif //C_DATASTRUCTURES_FILTEREDHASHMAPTEST_H
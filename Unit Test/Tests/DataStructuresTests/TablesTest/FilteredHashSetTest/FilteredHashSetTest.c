@@ -0,0 +1,246 @@
+#include "FilteredHashSetTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/FilteredHashSet.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerFHST(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersFHST(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunFHST(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+void testFilteredHashSetInitialization(CuTest *cuTest) {
+
+    filteredHashSetInitialization(100, 0.01, free, compareIntPointersFHST, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    filteredHashSetInitialization(100, 2, free, compareIntPointersFHST, intHashFunFHST);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    FilteredHashSet *set = filteredHashSetInitialization(100, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+    CuAssertPtrNotNull(cuTest, set);
+    CuAssertIntEquals(cuTest, 0, filteredHashSetGetLength(set));
+
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testFilteredHashSetInsertAndContains(CuTest *cuTest) {
+
+    FilteredHashSet *set = filteredHashSetInitialization(100, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashSetInsert(set, generateIntPointerFHST(i));
+
+    CuAssertIntEquals(cuTest, 100, filteredHashSetGetLength(set));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, 1, filteredHashSetContains(set, &i));
+
+    for (int i = 100; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 0, filteredHashSetContains(set, &i));
+
+    int item = 50;
+    CuAssertIntEquals(cuTest, 50, *(int *) filteredHashSetGet(set, &item));
+
+    item = 500;
+    CuAssertPtrEquals(cuTest, NULL, filteredHashSetGet(set, &item));
+
+    ERROR_TEST->errorCode = -1;
+    filteredHashSetInsert(set, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    filteredHashSetContains(NULL, &item);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testFilteredHashSetDelete(CuTest *cuTest) {
+
+    FilteredHashSet *set = filteredHashSetInitialization(100, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashSetInsert(set, generateIntPointerFHST(i));
+
+    for (int i = 0; i < 100; i += 2)
+        filteredHashSetDelete(set, &i);
+
+    int missing = 1000;
+    filteredHashSetDelete(set, &missing);
+
+    CuAssertIntEquals(cuTest, 50, filteredHashSetGetLength(set));
+    CuAssertIntEquals(cuTest, 50, cuckooFilterGetLength(set->filter));
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, i % 2, filteredHashSetContains(set, &i));
+
+    ERROR_TEST->errorCode = -1;
+    filteredHashSetDelete(set, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testFilteredHashSetFilterGrowth(CuTest *cuTest) {
+
+    FilteredHashSet *set = filteredHashSetInitialization(10, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+    int oldBucketsNum = set->filter->bucketsNum;
+
+    for (int i = 0; i < 1000; i++)
+        filteredHashSetInsert(set, generateIntPointerFHST(i));
+
+    CuAssertTrue(cuTest, set->filter->bucketsNum > oldBucketsNum);
+    CuAssertIntEquals(cuTest, 1000, filteredHashSetGetLength(set));
+    CuAssertIntEquals(cuTest, 1000, cuckooFilterGetLength(set->filter));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, 1, filteredHashSetContains(set, &i));
+
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testFilteredHashSetFailedFilterGrowth(CuTest *cuTest) {
+
+    FilteredHashSet *set = filteredHashSetInitialization(10, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+
+    // an invalid false positive rate makes the filter rebuild fail once the filter is full.
+    set->falsePositiveRate = 0;
+    ERROR_TEST->errorCode = -1;
+
+    int i = 0;
+    int *item;
+    for (; ERROR_TEST->errorCode != FAILED_ALLOCATION && i < 1000; i++)
+        filteredHashSetInsert(set, item = generateIntPointerFHST(i));
+
+    CuAssertIntEquals(cuTest, FAILED_ALLOCATION, ERROR_TEST->errorCode);
+    CuAssertIntEquals(cuTest, i - 1, filteredHashSetGetLength(set));
+    CuAssertIntEquals(cuTest, i - 1, cuckooFilterGetLength(set->filter));
+    CuAssertIntEquals(cuTest, 0, filteredHashSetContains(set, item));
+
+    for (int j = 0; j < i - 1; j++)
+        CuAssertIntEquals(cuTest, 1, filteredHashSetContains(set, &j));
+
+    free(item);
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testClearFilteredHashSet(CuTest *cuTest) {
+
+    FilteredHashSet *set = filteredHashSetInitialization(100, 0.01, free, compareIntPointersFHST, intHashFunFHST);
+
+    for (int i = 0; i < 100; i++)
+        filteredHashSetInsert(set, generateIntPointerFHST(i));
+
+    clearFilteredHashSet(set);
+    CuAssertIntEquals(cuTest, 0, filteredHashSetGetLength(set));
+    CuAssertIntEquals(cuTest, 0, cuckooFilterGetLength(set->filter));
+
+    int item = 5;
+    CuAssertIntEquals(cuTest, 0, filteredHashSetContains(set, &item));
+
+    destroyFilteredHashSet(set);
+
+}
+
+
+void testDestroyFilteredHashSet(CuTest *cuTest) {
+
+    destroyFilteredHashSet(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createFilteredHashSetTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testFilteredHashSetInitialization);
+    SUITE_ADD_TEST(suite, testFilteredHashSetInsertAndContains);
+    SUITE_ADD_TEST(suite, testFilteredHashSetDelete);
+    SUITE_ADD_TEST(suite, testFilteredHashSetFilterGrowth);
+    SUITE_ADD_TEST(suite, testFilteredHashSetFailedFilterGrowth);
+    SUITE_ADD_TEST(suite, testClearFilteredHashSet);
+    SUITE_ADD_TEST(suite, testDestroyFilteredHashSet);
+
+    return suite;
+
+}
+
+
+
+void filteredHashSetUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Filtered Hashset Test**\n");
+
+    CuSuite *suite = createFilteredHashSetTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_FILTEREDHASHSETTEST_H
+#define C_DATASTRUCTURES_FILTEREDHASHSETTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void filteredHashSetUnitTest();
+
+#endif //C_DATASTRUCTURES_FILTEREDHASHSETTEST_H
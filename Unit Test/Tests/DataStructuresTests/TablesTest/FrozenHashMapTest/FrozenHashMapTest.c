@@ -0,0 +1,323 @@
+#include "FrozenHashMapTest.h"
+#include "../../../../CuTest/CuTest.h"
+#include "../../../../../System/Utils.h"
+#include "../../../../../DataStructure/Tables/Headers/FrozenHashMap.h"
+
+
+
+
+
+/** This function will take an integer,
+ * then it will allocate a new integer and copy the passed integer value into the new pointer,
+ * and finally return the new integer pointer.
+ * @param integer the integer value
+ * @return it will return the new allocated integer pointer
+ */
+
+int *generateIntPointerFZHMT(int integer) {
+    int *newInt = (int *) malloc(sizeof(int));
+
+    *newInt = integer;
+    return newInt;
+
+}
+
+
+
+
+/** This function will compare to integers pointers,
+ * then it will return zero if they are equal, negative number if the second integer is bigger,
+ * and positive number if the first integer is bigger.
+ * @param a the first integer pointer
+ * @param b the second integer pointer
+ * @return it will return zero if they are equal, negative number if the second integer is bigger, and positive number if the first integer is bigger.
+ */
+
+int compareIntPointersFZHMT(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value
+ */
+
+int intHashFunFZHMT(const void *integer) {
+    return *(int *) integer;
+}
+
+
+
+
+/** This function will take an integer pointer,
+ * then it will return the value of the integer divided by four, so every four following integers have the same hash.
+ *
+ * @param integer the integer pointer
+ * @return it will return the passed integer pointer value divided by four
+ */
+
+int collidingHashFunFZHMT(const void *integer) {
+    return *(int *) integer / 4;
+}
+
+
+
+
+void testInvalidFrozenHashMapBuild(CuTest *cuTest) {
+
+    int key = 1;
+    void *keys[] = {&key};
+
+    frozenHashMapBuild(NULL, sizeof(int), sizeof(int));
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    frozenHashMapBuildFromArrays(NULL, keys, 1, sizeof(int), sizeof(int), compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    frozenHashMapBuildFromArrays(keys, keys, -1, sizeof(int), sizeof(int), compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    frozenHashMapBuildFromArrays(keys, keys, 1, 0, sizeof(int), compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    frozenHashMapBuildFromArrays(keys, keys, 1, sizeof(int), sizeof(int), NULL, intHashFunFZHMT);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    frozenHashMapBuildFromArrays(keys, keys, 1, sizeof(int), sizeof(int), compareIntPointersFZHMT, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testFrozenHashMapBuildFromArrays(CuTest *cuTest) {
+
+    int keysValues[1000], itemsValues[1000];
+    void *keys[1000], *items[1000];
+    for (int i = 0; i < 1000; i++) {
+        keysValues[i] = i * 7;
+        itemsValues[i] = i * 100;
+        keys[i] = keysValues + i;
+        items[i] = itemsValues + i;
+    }
+
+    FrozenHashMap *map = frozenHashMapBuildFromArrays(keys, items, 1000, sizeof(int), sizeof(int), compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertPtrNotNull(cuTest, map);
+    CuAssertIntEquals(cuTest, 1000, frozenHashMapGetLength(map));
+
+    // the map holds copies, so changing the arrays shouldn't affect it.
+    for (int i = 0; i < 1000; i++)
+        itemsValues[i] = -1;
+
+    for (int i = 0; i < 1000; i++) {
+        int key = i * 7;
+        CuAssertIntEquals(cuTest, i * 100, *(int *) frozenHashMapGet(map, &key));
+        CuAssertIntEquals(cuTest, 1, frozenHashMapContains(map, &key));
+
+        key++;
+        CuAssertPtrEquals(cuTest, NULL, frozenHashMapGet(map, &key));
+        CuAssertIntEquals(cuTest, 0, frozenHashMapContains(map, &key));
+    }
+
+    ERROR_TEST->errorCode = -1;
+    frozenHashMapGet(map, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    frozenHashMapGet(NULL, keys[0]);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    destroyFrozenHashMap(map);
+
+}
+
+
+void testFrozenHashMapBuildFromHashMap(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersFZHMT, intHashFunFZHMT);
+    for (int i = 0; i < 500; i++)
+        hashMapInsert(hashMap, generateIntPointerFZHMT(i), generateIntPointerFZHMT(i + 1));
+
+    FrozenHashMap *map = frozenHashMapBuild(hashMap, sizeof(int), sizeof(int));
+    destroyHashMap(hashMap);
+
+    CuAssertIntEquals(cuTest, 500, frozenHashMapGetLength(map));
+    for (int i = 0; i < 500; i++)
+        CuAssertIntEquals(cuTest, i + 1, *(int *) frozenHashMapGet(map, &i));
+
+    destroyFrozenHashMap(map);
+
+}
+
+
+void testFrozenHashMapEmpty(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersFZHMT, intHashFunFZHMT);
+    FrozenHashMap *map = frozenHashMapBuild(hashMap, sizeof(int), sizeof(int));
+    destroyHashMap(hashMap);
+
+    int key = 0;
+    CuAssertIntEquals(cuTest, 0, frozenHashMapGetLength(map));
+    CuAssertPtrEquals(cuTest, NULL, frozenHashMapGet(map, &key));
+
+    destroyFrozenHashMap(map);
+
+}
+
+
+void testFrozenHashMapDuplicateKeys(CuTest *cuTest) {
+
+    int keysValues[] = {1, 2, 3, 2};
+    void *keys[] = {keysValues, keysValues + 1, keysValues + 2, keysValues + 3};
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, frozenHashMapBuildFromArrays(keys, keys, 4, sizeof(int), sizeof(int), compareIntPointersFZHMT, intHashFunFZHMT));
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testFrozenHashMapSameHashKeys(CuTest *cuTest) {
+
+    int keysValues[1000], itemsValues[1000];
+    void *keys[1000], *items[1000];
+    for (int i = 0; i < 1000; i++) {
+        keysValues[i] = i * 2;
+        itemsValues[i] = i * 100;
+        keys[i] = keysValues + i;
+        items[i] = itemsValues + i;
+    }
+
+    FrozenHashMap *map = frozenHashMapBuildFromArrays(keys, items, 1000, sizeof(int), sizeof(int), compareIntPointersFZHMT, collidingHashFunFZHMT);
+    CuAssertPtrNotNull(cuTest, map);
+    CuAssertIntEquals(cuTest, 1000, frozenHashMapGetLength(map));
+    CuAssertIntEquals(cuTest, 500, map->overflowNum);
+
+    for (int i = 0; i < 1000; i++) {
+        int key = i * 2;
+        CuAssertIntEquals(cuTest, i * 100, *(int *) frozenHashMapGet(map, &key));
+
+        // the odd keys have the same hashes of the map keys, but they aren't in the map.
+        key++;
+        CuAssertIntEquals(cuTest, 0, frozenHashMapContains(map, &key));
+    }
+
+    frozenHashMapSave(map, "frozenHashMapTest.bin");
+    FrozenHashMap *loadedMap = frozenHashMapLoad("frozenHashMapTest.bin", compareIntPointersFZHMT, collidingHashFunFZHMT);
+    remove("frozenHashMapTest.bin");
+
+    CuAssertPtrNotNull(cuTest, loadedMap);
+    CuAssertIntEquals(cuTest, 500, loadedMap->overflowNum);
+    for (int i = 0; i < 1000; i++) {
+        int key = i * 2;
+        CuAssertIntEquals(cuTest, i * 100, *(int *) frozenHashMapGet(loadedMap, &key));
+    }
+
+    destroyFrozenHashMap(map);
+    destroyFrozenHashMap(loadedMap);
+
+    int duplicatedValues[] = {4, 5, 6, 5};
+    void *duplicatedKeys[] = {duplicatedValues, duplicatedValues + 1, duplicatedValues + 2, duplicatedValues + 3};
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, frozenHashMapBuildFromArrays(duplicatedKeys, duplicatedKeys, 4, sizeof(int), sizeof(int), compareIntPointersFZHMT, collidingHashFunFZHMT));
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+}
+
+
+void testFrozenHashMapSaveAndLoad(CuTest *cuTest) {
+
+    int keysValues[300];
+    double itemsValues[300];
+    void *keys[300], *items[300];
+    for (int i = 0; i < 300; i++) {
+        keysValues[i] = i * 3;
+        itemsValues[i] = i / 2.0;
+        keys[i] = keysValues + i;
+        items[i] = itemsValues + i;
+    }
+
+    FrozenHashMap *map = frozenHashMapBuildFromArrays(keys, items, 300, sizeof(int), sizeof(double), compareIntPointersFZHMT, intHashFunFZHMT);
+    frozenHashMapSave(map, "frozenHashMapTest.bin");
+
+    FrozenHashMap *loadedMap = frozenHashMapLoad("frozenHashMapTest.bin", compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertPtrNotNull(cuTest, loadedMap);
+    CuAssertIntEquals(cuTest, 300, frozenHashMapGetLength(loadedMap));
+    CuAssertIntEquals(cuTest, (int) map->memorySize, (int) loadedMap->memorySize);
+
+    for (int i = 0; i < 300; i++) {
+        int key = i * 3;
+        CuAssertDblEquals(cuTest, i / 2.0, *(double *) frozenHashMapGet(loadedMap, &key), 0);
+    }
+
+    destroyFrozenHashMap(map);
+    destroyFrozenHashMap(loadedMap);
+
+    FILE *file = fopen("frozenHashMapTest.bin", "wb");
+    fputs("not a frozen map", file);
+    fclose(file);
+
+    ERROR_TEST->errorCode = -1;
+    CuAssertPtrEquals(cuTest, NULL, frozenHashMapLoad("frozenHashMapTest.bin", compareIntPointersFZHMT, intHashFunFZHMT));
+    CuAssertIntEquals(cuTest, SOMETHING_WENT_WRONG, ERROR_TEST->errorCode);
+
+    remove("frozenHashMapTest.bin");
+
+    ERROR_TEST->errorCode = -1;
+    frozenHashMapLoad("frozenHashMapTest.bin", compareIntPointersFZHMT, intHashFunFZHMT);
+    CuAssertIntEquals(cuTest, SOMETHING_WENT_WRONG, ERROR_TEST->errorCode);
+
+}
+
+
+void testDestroyFrozenHashMap(CuTest *cuTest) {
+
+    destroyFrozenHashMap(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+}
+
+
+
+
+
+CuSuite *createFrozenHashMapTestsSuite() {
+
+    CuSuite *suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, testInvalidFrozenHashMapBuild);
+    SUITE_ADD_TEST(suite, testFrozenHashMapBuildFromArrays);
+    SUITE_ADD_TEST(suite, testFrozenHashMapBuildFromHashMap);
+    SUITE_ADD_TEST(suite, testFrozenHashMapEmpty);
+    SUITE_ADD_TEST(suite, testFrozenHashMapDuplicateKeys);
+    SUITE_ADD_TEST(suite, testFrozenHashMapSameHashKeys);
+    SUITE_ADD_TEST(suite, testFrozenHashMapSaveAndLoad);
+    SUITE_ADD_TEST(suite, testDestroyFrozenHashMap);
+
+    return suite;
+
+}
+
+
+
+void frozenHashMapUnitTest() {
+
+    ERROR_TEST =  (ErrorTestStruct*) malloc(sizeof(ErrorTestStruct));
+
+    CuString *output = CuStringNew();
+    CuStringAppend(output, "**Frozen Hashmap Test**\n");
+
+    CuSuite *suite = createFrozenHashMapTestsSuite();
+
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    free(ERROR_TEST);
+
+}
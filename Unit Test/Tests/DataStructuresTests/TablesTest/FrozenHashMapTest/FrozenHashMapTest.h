@@ -0,0 +1,8 @@
+#ifndef C_DATASTRUCTURES_FROZENHASHMAPTEST_H
+#define C_DATASTRUCTURES_FROZENHASHMAPTEST_H
+
+#include "../../../../ErrorsTestStruct.h"
+
+void frozenHashMapUnitTest();
+
+#endif //C_DATASTRUCTURES_FROZENHASHMAPTEST_H
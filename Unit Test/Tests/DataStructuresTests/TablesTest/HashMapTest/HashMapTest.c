@@ -37,6 +37,21 @@ int compareIntPointersHMT(const void *a, const void *b) {
 
 
 
+/** This function will compare two char arrays,
+ * then it will return zero if they are equal, negative number if the first char array is smaller,
+ * and positive number if the first char array is bigger.
+ * @param a the first char array pointer
+ * @param b the second char array pointer
+ * @return it will return the result of comparing the two char arrays using strcmp
+ */
+
+int compareCharArraysHMT(const void *a, const void *b) {
+    return strcmp((const char *) a, (const char *) b);
+}
+
+
+
+
 /** This function will take an integer pointer,
  * then it will return the value of the integer.
  *
@@ -118,6 +133,31 @@ void testValidHashMapInitialization(CuTest *cuTest) {
     HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
 
     CuAssertPtrNotNull(cuTest, hashMap);
+    CuAssertIntEquals(cuTest, 11, hashMap->length);
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
+void testHashMapInitializationWithCapacity(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitializationWithCapacity(0, free, free, compareIntPointersHMT, intHashFunHMT);
+    CuAssertPtrEquals(cuTest, NULL, hashMap);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashMap = hashMapInitializationWithCapacity(1000, free, free, compareIntPointersHMT, intHashFunHMT);
+    CuAssertPtrNotNull(cuTest, hashMap);
+    CuAssertTrue(cuTest, hashMap->length * 3 >= 1000 * 4);
+
+    Entry **arr = hashMap->arr;
+    for (int i = 0; i < 1000; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i), generateIntPointerHMT(i));
+
+    CuAssertPtrEquals(cuTest, arr, hashMap->arr);
+    CuAssertIntEquals(cuTest, 1000, hashMapGetLength(hashMap));
 
     destroyHashMap(hashMap);
 
@@ -232,6 +272,120 @@ void testHashMapGet(CuTest *cuTest) {
 
 
 
+void testHashMapInsertBatch(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
+
+    void *keys[100], *items[100];
+
+    hashMapInsertBatch(NULL, keys, items, 100);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashMapInsertBatch(hashMap, NULL, items, 100);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashMapInsertBatch(hashMap, keys, NULL, 100);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashMapInsertBatch(hashMap, keys, items, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 100; i++) {
+        keys[i] = generateIntPointerHMT(i % 80);
+        items[i] = generateIntPointerHMT(i);
+    }
+
+    hashMapInsertBatch(hashMap, keys, items, 100);
+
+    CuAssertIntEquals(cuTest, 80, hashMapGetLength(hashMap));
+
+    for (int i = 0; i < 80; i++)
+        CuAssertIntEquals(cuTest, i < 20 ? i + 80 : i, *(int *) hashMapGet(hashMap, &i));
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
+void testHashMapContainsBatch(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
+
+    int keysValues[100], results[100];
+    void *keys[100];
+
+    hashMapContainsBatch(NULL, keys, 100, results);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashMapContainsBatch(hashMap, NULL, 100, results);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashMapContainsBatch(hashMap, keys, 100, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 50; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i * 2), generateIntPointerHMT(i));
+
+    for (int i = 0; i < 100; i++) {
+        keysValues[i] = i;
+        keys[i] = keysValues + i;
+    }
+
+    hashMapContainsBatch(hashMap, keys, 100, results);
+
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, i % 2 == 0, results[i]);
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
+void testHashMapGetBatch(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
+
+    int keysValues[100];
+    void *keys[100], *items[100];
+
+    hashMapGetBatch(NULL, keys, 100, items);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashMapGetBatch(hashMap, NULL, 100, items);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashMapGetBatch(hashMap, keys, 100, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 50; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i), generateIntPointerHMT(i * 10));
+
+    for (int i = 0; i < 100; i++) {
+        keysValues[i] = 99 - i;
+        keys[i] = keysValues + i;
+    }
+
+    hashMapGetBatch(hashMap, keys, 100, items);
+
+    for (int i = 0; i < 100; i++) {
+        if (keysValues[i] < 50)
+            CuAssertIntEquals(cuTest, keysValues[i] * 10, *(int *) items[i]);
+        else
+            CuAssertPtrEquals(cuTest, NULL, items[i]);
+
+    }
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
 void testHashMapGetKey(CuTest *cuTest) {
 
     HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
@@ -408,7 +562,7 @@ void testHashMapDeleteWtoFrAll(CuTest *cuTest) {
 
 void testHashMapToArray(CuTest *cuTest) {
 
-    HashMap *hashMap = hashMapInitialization(free, free, strcmp, charArrHashFunHMT);
+    HashMap *hashMap = hashMapInitialization(free, free, compareCharArraysHMT, charArrHashFunHMT);
 
     char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
 
@@ -438,7 +592,7 @@ void testHashMapToArray(CuTest *cuTest) {
 
 void testHashMapToEntryArray(CuTest *cuTest) {
 
-    HashMap *hashMap = hashMapInitialization(free, free, strcmp, charArrHashFunHMT);
+    HashMap *hashMap = hashMapInitialization(free, free, compareCharArraysHMT, charArrHashFunHMT);
 
     char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
 
@@ -470,6 +624,129 @@ void testHashMapToEntryArray(CuTest *cuTest) {
 
 
 
+void testHashMapIterator(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareCharArraysHMT, charArrHashFunHMT);
+
+    char numbersArr[13][10] = {"one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "eleven", "twelve", "thirteen"};
+
+    HashMapIterator iterator;
+    hashMapIteratorBegin(NULL, &iterator);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashMapIteratorBegin(hashMap, &iterator);
+    CuAssertIntEquals(cuTest, 0, hashMapIteratorNext(&iterator));
+
+    for (int i = 0; i < 13; i++)
+        hashMapInsert(hashMap, generateCharPointerHMT(numbersArr[i]), generateIntPointerHMT(i + 1));
+
+    int arr[13] = {0};
+    hashMapIteratorBegin(hashMap, &iterator);
+    while (hashMapIteratorNext(&iterator)) {
+        int value = *(int *) hashMapIteratorValue(&iterator);
+        arr[value - 1]++;
+        CuAssertStrEquals(cuTest, numbersArr[value - 1], (char *) hashMapIteratorKey(&iterator));
+
+        if (value % 2 == 0)
+            hashMapIteratorRemove(&iterator);
+
+    }
+
+    for (int i = 0; i < 13; i++)
+        CuAssertIntEquals(cuTest, 1, arr[i]);
+
+    hashMapIteratorRemove(&iterator);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 7, hashMapGetLength(hashMap));
+    for (int i = 0; i < 13; i++)
+        CuAssertIntEquals(cuTest, i % 2 == 0, hashMapContains(hashMap, numbersArr[i]));
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
+
+
+void testHashMapReserve(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
+
+    hashMapReserve(NULL, 10);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashMapReserve(hashMap, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 10; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i), generateIntPointerHMT(i * 2));
+
+    hashMapReserve(hashMap, 500);
+    CuAssertTrue(cuTest, hashMap->length * 3 >= 500 * 4);
+
+    int length = hashMap->length;
+    for (int i = 10; i < 500; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i), generateIntPointerHMT(i * 2));
+
+    CuAssertIntEquals(cuTest, length, hashMap->length);
+    CuAssertIntEquals(cuTest, 500, hashMapGetLength(hashMap));
+
+    for (int i = 0; i < 500; i++)
+        CuAssertIntEquals(cuTest, i * 2, *(int *) hashMapGet(hashMap, &i));
+
+    hashMapReserve(hashMap, 20);
+    CuAssertIntEquals(cuTest, length, hashMap->length);
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
+void testHashMapShrinkToFit(CuTest *cuTest) {
+
+    HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
+
+    hashMapShrinkToFit(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 1000; i++)
+        hashMapInsert(hashMap, generateIntPointerHMT(i), generateIntPointerHMT(i * 2));
+
+    for (int i = 0; i < 1000; i++) {
+        if (i % 50 != 0)
+            hashMapDelete(hashMap, &i);
+    }
+
+    int length = hashMap->length;
+    hashMapShrinkToFit(hashMap);
+    CuAssertTrue(cuTest, hashMap->length < length);
+    CuAssertTrue(cuTest, hashMap->length * 3 >= 20 * 4);
+    CuAssertIntEquals(cuTest, 20, hashMapGetLength(hashMap));
+
+    for (int i = 0; i < 1000; i++) {
+        if (i % 50 == 0)
+            CuAssertIntEquals(cuTest, i * 2, *(int *) hashMapGet(hashMap, &i));
+        else
+            CuAssertIntEquals(cuTest, 0, hashMapContains(hashMap, &i));
+
+    }
+
+    clearHashMap(hashMap);
+    hashMapShrinkToFit(hashMap);
+    CuAssertIntEquals(cuTest, 11, hashMap->length);
+
+    destroyHashMap(hashMap);
+
+}
+
+
+
+
 void testHashMapGetLength(CuTest *cuTest) {
 
     HashMap *hashMap = hashMapInitialization(free, free, compareIntPointersHMT, intHashFunHMT);
@@ -595,15 +872,22 @@ CuSuite *createHashMapTestsSuite() {
 
     SUITE_ADD_TEST(suite, testInvalidHashMapInitialization);
     SUITE_ADD_TEST(suite, testValidHashMapInitialization);
+    SUITE_ADD_TEST(suite, testHashMapInitializationWithCapacity);
     SUITE_ADD_TEST(suite, testHashMapInsert);
     SUITE_ADD_TEST(suite, testHashMapContains);
     SUITE_ADD_TEST(suite, testHashMapGet);
+    SUITE_ADD_TEST(suite, testHashMapInsertBatch);
+    SUITE_ADD_TEST(suite, testHashMapContainsBatch);
+    SUITE_ADD_TEST(suite, testHashMapGetBatch);
     SUITE_ADD_TEST(suite, testHashMapGetKey);
     SUITE_ADD_TEST(suite, testHashMapDelete);
     SUITE_ADD_TEST(suite, testHashMapDeleteWtoFr);
     SUITE_ADD_TEST(suite, testHashMapDeleteWtoFrAll);
     SUITE_ADD_TEST(suite, testHashMapToArray);
     SUITE_ADD_TEST(suite, testHashMapToEntryArray);
+    SUITE_ADD_TEST(suite, testHashMapIterator);
+    SUITE_ADD_TEST(suite, testHashMapReserve);
+    SUITE_ADD_TEST(suite, testHashMapShrinkToFit);
     SUITE_ADD_TEST(suite, testHashMapGetLength);
     SUITE_ADD_TEST(suite, testHashMapIsEmpty);
     SUITE_ADD_TEST(suite, testClearHashMap);
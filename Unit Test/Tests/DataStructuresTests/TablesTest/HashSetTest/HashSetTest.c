@@ -72,6 +72,30 @@ void testValidHashSetInitialization(CuTest *cuTest) {
 
     HashSet *hashSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
     CuAssertPtrNotNull(cuTest, hashSet);
+    CuAssertIntEquals(cuTest, 11, hashSet->length);
+
+    destroyHashSet(hashSet);
+
+}
+
+
+
+void testHashSetInitializationWithCapacity(CuTest *cuTest) {
+
+    HashSet *hashSet = hashSetInitializationWithCapacity(0, free, compareIntPointersHST, intHashFunHST);
+    CuAssertPtrEquals(cuTest, NULL, hashSet);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    hashSet = hashSetInitializationWithCapacity(1000, free, compareIntPointersHST, intHashFunHST);
+    CuAssertPtrNotNull(cuTest, hashSet);
+    CuAssertTrue(cuTest, hashSet->length * 3 >= 1000 * 4);
+
+    void **arr = hashSet->arr;
+    for (int i = 0; i < 1000; i++)
+        hashSetInsert(hashSet, generateIntPointerHST(i));
+
+    CuAssertPtrEquals(cuTest, arr, hashSet->arr);
+    CuAssertIntEquals(cuTest, 1000, hashSetGetLength(hashSet));
 
     destroyHashSet(hashSet);
 
@@ -281,6 +305,269 @@ void testHashSetToArray(CuTest *cuTest) {
 
 
 
+void testHashSetIterator(CuTest *cuTest) {
+
+    HashSet *hashSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    HashSetIterator iterator;
+    hashSetIteratorBegin(NULL, &iterator);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashSetIteratorBegin(hashSet, &iterator);
+    CuAssertIntEquals(cuTest, 0, hashSetIteratorNext(&iterator));
+
+    for (int i = 0; i < 20; i++)
+        hashSetInsert(hashSet, generateIntPointerHST(i + 1));
+
+    int arr[20] = {0};
+    hashSetIteratorBegin(hashSet, &iterator);
+    while (hashSetIteratorNext(&iterator)) {
+        int value = *(int *) hashSetIteratorItem(&iterator);
+        arr[value - 1]++;
+
+        if (value % 2 == 0)
+            hashSetIteratorRemove(&iterator);
+
+    }
+
+    for (int i = 0; i < 20; i++)
+        CuAssertIntEquals(cuTest, 1, arr[i]);
+
+    hashSetIteratorRemove(&iterator);
+    CuAssertIntEquals(cuTest, OUT_OF_RANGE, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 10, hashSetGetLength(hashSet));
+    for (int i = 0; i < 20; i++) {
+        int value = i + 1;
+        CuAssertIntEquals(cuTest, value % 2 != 0, hashSetContains(hashSet, &value));
+    }
+
+    destroyHashSet(hashSet);
+
+}
+
+
+
+void nullFreeFunHST(void *item) {
+    (void) item;
+}
+
+
+
+void testHashSetUnion(CuTest *cuTest) {
+
+    HashSet *firstSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+    HashSet *secondSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetUnion(NULL, secondSet, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashSetUnion(firstSet, secondSet, NULL);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 30; i++)
+        hashSetInsert(firstSet, generateIntPointerHST(i));
+
+    for (int i = 20; i < 40; i++)
+        hashSetInsert(secondSet, generateIntPointerHST(i));
+
+    HashSet *unionSet = hashSetUnion(firstSet, secondSet, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, 40, hashSetGetLength(unionSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, 1, hashSetContains(unionSet, &i));
+
+    destroyHashSet(unionSet);
+
+    HashSet *unionInPlaceSet = hashSetInitialization(nullFreeFunHST, compareIntPointersHST, intHashFunHST);
+    hashSetUnionInPlace(unionInPlaceSet, firstSet);
+    hashSetUnionInPlace(unionInPlaceSet, secondSet);
+    CuAssertIntEquals(cuTest, 40, hashSetGetLength(unionInPlaceSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, 1, hashSetContains(unionInPlaceSet, &i));
+
+    destroyHashSet(unionInPlaceSet);
+    destroyHashSet(firstSet);
+    destroyHashSet(secondSet);
+
+}
+
+
+
+void testHashSetIntersection(CuTest *cuTest) {
+
+    HashSet *firstSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+    HashSet *secondSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetIntersection(firstSet, NULL, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 30; i++)
+        hashSetInsert(firstSet, generateIntPointerHST(i));
+
+    for (int i = 20; i < 40; i++)
+        hashSetInsert(secondSet, generateIntPointerHST(i));
+
+    HashSet *intersectionSet = hashSetIntersection(firstSet, secondSet, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, 10, hashSetGetLength(intersectionSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, i >= 20 && i < 30, hashSetContains(intersectionSet, &i));
+
+    destroyHashSet(intersectionSet);
+
+    hashSetIntersectionInPlace(firstSet, secondSet);
+    CuAssertIntEquals(cuTest, 10, hashSetGetLength(firstSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, i >= 20 && i < 30, hashSetContains(firstSet, &i));
+
+    int item = 35;
+    hashSetDelete(secondSet, &item);
+    item = 25;
+    hashSetDelete(secondSet, &item);
+
+    hashSetIntersectionInPlace(firstSet, secondSet);
+    CuAssertIntEquals(cuTest, 9, hashSetGetLength(firstSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, i >= 20 && i < 30 && i != 25, hashSetContains(firstSet, &i));
+
+    destroyHashSet(firstSet);
+    destroyHashSet(secondSet);
+
+}
+
+
+
+void testHashSetDifference(CuTest *cuTest) {
+
+    HashSet *firstSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+    HashSet *secondSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetDifference(NULL, NULL, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 30; i++)
+        hashSetInsert(firstSet, generateIntPointerHST(i));
+
+    for (int i = 20; i < 40; i++)
+        hashSetInsert(secondSet, generateIntPointerHST(i));
+
+    HashSet *differenceSet = hashSetDifference(firstSet, secondSet, nullFreeFunHST);
+    CuAssertIntEquals(cuTest, 20, hashSetGetLength(differenceSet));
+    for (int i = 0; i < 40; i++)
+        CuAssertIntEquals(cuTest, i < 20, hashSetContains(differenceSet, &i));
+
+    destroyHashSet(differenceSet);
+
+    HashSet *bigSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+    for (int i = 0; i < 100; i++)
+        hashSetInsert(bigSet, generateIntPointerHST(i));
+
+    hashSetDifferenceInPlace(secondSet, bigSet);
+    CuAssertIntEquals(cuTest, 1, hashSetIsEmpty(secondSet));
+
+    hashSetDifferenceInPlace(bigSet, firstSet);
+    CuAssertIntEquals(cuTest, 70, hashSetGetLength(bigSet));
+    for (int i = 0; i < 100; i++)
+        CuAssertIntEquals(cuTest, i >= 30, hashSetContains(bigSet, &i));
+
+    destroyHashSet(bigSet);
+    destroyHashSet(firstSet);
+    destroyHashSet(secondSet);
+
+}
+
+
+
+void testHashSetIsSubset(CuTest *cuTest) {
+
+    HashSet *firstSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+    HashSet *secondSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetIsSubset(NULL, secondSet);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    CuAssertIntEquals(cuTest, 1, hashSetIsSubset(firstSet, secondSet));
+
+    for (int i = 0; i < 10; i++)
+        hashSetInsert(firstSet, generateIntPointerHST(i * 2));
+
+    for (int i = 0; i < 30; i++)
+        hashSetInsert(secondSet, generateIntPointerHST(i));
+
+    CuAssertIntEquals(cuTest, 1, hashSetIsSubset(firstSet, secondSet));
+    CuAssertIntEquals(cuTest, 0, hashSetIsSubset(secondSet, firstSet));
+
+    hashSetInsert(firstSet, generateIntPointerHST(100));
+    CuAssertIntEquals(cuTest, 0, hashSetIsSubset(firstSet, secondSet));
+
+    destroyHashSet(firstSet);
+    destroyHashSet(secondSet);
+
+}
+
+
+
+void testHashSetReserve(CuTest *cuTest) {
+
+    HashSet *hashSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetReserve(NULL, 10);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    hashSetReserve(hashSet, -1);
+    CuAssertIntEquals(cuTest, INVALID_ARG, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 10; i++)
+        hashSetInsert(hashSet, generateIntPointerHST(i));
+
+    hashSetReserve(hashSet, 500);
+    CuAssertTrue(cuTest, hashSet->length * 3 >= 500 * 4);
+
+    int length = hashSet->length;
+    for (int i = 10; i < 500; i++)
+        hashSetInsert(hashSet, generateIntPointerHST(i));
+
+    CuAssertIntEquals(cuTest, length, hashSet->length);
+    CuAssertIntEquals(cuTest, 500, hashSetGetLength(hashSet));
+
+    for (int i = 0; i < 500; i++)
+        CuAssertIntEquals(cuTest, 1, hashSetContains(hashSet, &i));
+
+    destroyHashSet(hashSet);
+
+}
+
+
+
+void testHashSetShrinkToFit(CuTest *cuTest) {
+
+    HashSet *hashSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
+
+    hashSetShrinkToFit(NULL);
+    CuAssertIntEquals(cuTest, NULL_POINTER, ERROR_TEST->errorCode);
+
+    for (int i = 0; i < 1000; i++)
+        hashSetInsert(hashSet, generateIntPointerHST(i));
+
+    for (int i = 0; i < 1000; i++) {
+        if (i % 50 != 0)
+            hashSetDelete(hashSet, &i);
+    }
+
+    int length = hashSet->length;
+    hashSetShrinkToFit(hashSet);
+    CuAssertTrue(cuTest, hashSet->length < length);
+    CuAssertTrue(cuTest, hashSet->length * 3 >= 20 * 4);
+    CuAssertIntEquals(cuTest, 20, hashSetGetLength(hashSet));
+
+    for (int i = 0; i < 1000; i++)
+        CuAssertIntEquals(cuTest, i % 50 == 0, hashSetContains(hashSet, &i));
+
+    destroyHashSet(hashSet);
+
+}
+
+
+
 void testHashSetGetLength(CuTest *cuTest) {
 
     HashSet *hashSet = hashSetInitialization(free, compareIntPointersHST, intHashFunHST);
@@ -395,12 +682,20 @@ CuSuite *createHashSetTestsSuite() {
 
     SUITE_ADD_TEST(suite, testInvalidHashSetInitialization);
     SUITE_ADD_TEST(suite, testValidHashSetInitialization);
+    SUITE_ADD_TEST(suite, testHashSetInitializationWithCapacity);
     SUITE_ADD_TEST(suite, testHashSetInsert);
     SUITE_ADD_TEST(suite, testHashSetDelete);
     SUITE_ADD_TEST(suite, testHashSetDeleteWtoFr);
     SUITE_ADD_TEST(suite, testHashSetContains);
     SUITE_ADD_TEST(suite, testHashSetGet);
     SUITE_ADD_TEST(suite, testHashSetToArray);
+    SUITE_ADD_TEST(suite, testHashSetIterator);
+    SUITE_ADD_TEST(suite, testHashSetUnion);
+    SUITE_ADD_TEST(suite, testHashSetIntersection);
+    SUITE_ADD_TEST(suite, testHashSetDifference);
+    SUITE_ADD_TEST(suite, testHashSetIsSubset);
+    SUITE_ADD_TEST(suite, testHashSetReserve);
+    SUITE_ADD_TEST(suite, testHashSetShrinkToFit);
     SUITE_ADD_TEST(suite, testHashSetGetLength);
     SUITE_ADD_TEST(suite, testHashSetIsEmpty);
     SUITE_ADD_TEST(suite, testClearHashSet);
@@ -1,13 +1,22 @@
 #include "DataStructuresTests/ListsTest/VectorTest/VectorTest.h"
 #include "DataStructuresTests/ListsTest/ArrayListTest/ArrayListTest.h"
+#include "DataStructuresTests/ListsTest/ValueVectorTest/ValueVectorTest.h"
+#include "DataStructuresTests/ListsTest/SmallVectorTest/SmallVectorTest.h"
+#include "DataStructuresTests/ListsTest/GapBufferTest/GapBufferTest.h"
+#include "DataStructuresTests/ListsTest/SegmentedVectorTest/SegmentedVectorTest.h"
 #include "DataStructuresTests/LinkedListsTest/LinkedListTest/LinkedListTest.h"
 #include "DataStructuresTests/LinkedListsTest/DoublyLinkedListTest/DoublyLinkedListTest.h"
+#include "DataStructuresTests/LinkedListsTest/NodePoolTest/NodePoolTest.h"
+#include "DataStructuresTests/LinkedListsTest/UnrolledLinkedListTest/UnrolledLinkedListTest.h"
+#include "DataStructuresTests/LinkedListsTest/SkipListTest/SkipListTest.h"
 #include "DataStructuresTests/StacksTest/StackTest/StackTest.h"
 #include "DataStructuresTests/StacksTest/DLinkedListStackTest/DLinkedListStackTest.h"
 #include "DataStructuresTests/QueuesTest/QueueTest/QueueTest.h"
 #include "DataStructuresTests/QueuesTest/StackQueueTest/StackQueueTest.h"
 #include "DataStructuresTests/QueuesTest/LinkedListQueueTest/LinkedListQueueTest.h"
 #include "DataStructuresTests/QueuesTest/PriorityQueueTest/PriorityQueueTest.h"
+#include "DataStructuresTests/QueuesTest/SPSCQueueTest/SPSCQueueTest.h"
+#include "DataStructuresTests/QueuesTest/MPMCQueueTest/MPMCQueueTest.h"
 #include "DataStructuresTests/DequesTest/DequeTest/DequeTest.h"
 #include "DataStructuresTests/DequesTest/DoublyLinkedListDequeTest/DoublyLinkedListDequeTest.h"
 #include "DataStructuresTests/MatricesTest/MatrixTest/MatrixTest.h"
@@ -15,6 +24,13 @@
 #include "DataStructuresTests/TablesTest/HashMapTest/HashMapTest.h"
 #include "DataStructuresTests/TablesTest/DounlyLinkedListHashMapTest/DoublyLinkedListHashMapTest.h"
 #include "DataStructuresTests/TablesTest/HashSetTest/HashSetTest.h"
+#include "DataStructuresTests/TablesTest/ConcurrentHashMapTest/ConcurrentHashMapTest.h"
+#include "DataStructuresTests/TablesTest/BloomFilterTest/BloomFilterTest.h"
+#include "DataStructuresTests/TablesTest/CuckooFilterTest/CuckooFilterTest.h"
+#include "DataStructuresTests/TablesTest/FilteredHashSetTest/FilteredHashSetTest.h"
+#include "DataStructuresTests/TablesTest/FilteredHashMapTest/FilteredHashMapTest.h"
+#include "DataStructuresTests/TablesTest/FrozenHashMapTest/FrozenHashMapTest.h"
+#include "DataStructuresTests/TablesTest/CacheTest/CacheTest.h"
 #include "DataStructuresTests/GraphsTest/DirectedGraphTest/DirectedGraphTest.h"
 #include "DataStructuresTests/GraphsTest/UndirectedGraphTest/UndirectedGraphTest.h"
 #include "DataStructuresTests/TreesTest/TrieTest/TrieTest.h"
@@ -30,6 +46,7 @@
 #include "AlgorithmsTests/ArraysAlgTest/ArraysAlgTest.h"
 #include "FilesHandlersTests/TxtFileLoaderTest/TxtFileLoaderTest.h"
 #include "AlgorithmsTests/CharArrayAlgTest/CharArrayAlgTest.h"
+#include "AlgorithmsTests/SketchesTest/SketchesTest.h"
 
 
 
@@ -39,14 +56,23 @@ int main(void) {
     // Data structure tests:
     vectorUnitTest();
     arrayListUnitTest();
+    valueVectorUnitTest();
+    smallVectorUnitTest();
+    gapBufferUnitTest();
+    segmentedVectorUnitTest();
     linkedListUnitTest();
     doublyLinkedListUnitTest();
+    nodePoolUnitTest();
+    unrolledLinkedListUnitTest();
+    skipListUnitTest();
     stackUnitTest();
     doublyLinkedListStackUnitTest();
     queueUnitTest();
     stackQueueUnitTest();
     linkedListQueueUnitTest();
     priorityQueueUnitTest();
+    spscQueueUnitTest();
+    mpmcQueueUnitTest();
     dequeUnitTest();
     doublyLinkedListDequeUnitTest();
     matrixUnitTest();
@@ -54,6 +80,13 @@ int main(void) {
     hashMapUnitTest();
     doublyLinkedListHashMapUnitTest();
     hashSetUnitTest();
+    concurrentHashMapUnitTest();
+    bloomFilterUnitTest();
+    cuckooFilterUnitTest();
+    filteredHashSetUnitTest();
+    filteredHashMapUnitTest();
+    frozenHashMapUnitTest();
+    cacheUnitTest();
     directedGraphUnitTest();
     undirectedGraphUnitTest();
     trieUnitTest();
@@ -78,6 +111,10 @@ int main(void) {
     charArrayAlgUnitTest();
 
 
+    // Sketches tests:
+    sketchesUnitTest();
+
+
     // FilesHandler Handlers tests:
     txtFileLoaderAlgUnitTest();
     inputScannerUnitTest();